@@ -0,0 +1,259 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Measures the cost of the layout system without opening a window.
+// Usage: layout-benchmark [widgetCount...]   (default: 1000 10000 100000)
+
+#include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <string>
+#include <vector>
+
+TGUI_IMPORT_LAYOUT_BIND_FUNCTIONS
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Bytes that are currently allocated on the heap, kept up-to-date by the replaced operator new and delete below
+    std::size_t allocatedBytes = 0;
+
+    // Highest value that allocatedBytes reached since it was last reset
+    std::size_t peakAllocatedBytes = 0;
+
+    // Every allocation is prefixed with its size so that it can be subtracted again when the memory is freed
+    const std::size_t allocationHeaderSize = 16;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void* allocate(std::size_t size)
+    {
+        void* memory = std::malloc(size + allocationHeaderSize);
+        if (!memory)
+            throw std::bad_alloc{};
+
+        *static_cast<std::size_t*>(memory) = size;
+        allocatedBytes += size;
+        peakAllocatedBytes = std::max(peakAllocatedBytes, allocatedBytes);
+        return static_cast<char*>(memory) + allocationHeaderSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void deallocate(void* pointer)
+    {
+        if (!pointer)
+            return;
+
+        void* memory = static_cast<char*>(pointer) - allocationHeaderSize;
+        allocatedBytes -= *static_cast<std::size_t*>(memory);
+        std::free(memory);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    double millisecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct Scenario
+    {
+        const char* name;
+
+        // Gives the widget its position and size. The widget has already been added to the panel.
+        std::function<void(const std::vector<tgui::Widget::Ptr>& widgets, std::size_t index, const tgui::Panel::Ptr& panel)> setLayouts;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Widgets are placed next to each other in chains of this length, each widget depending on the one before it
+    const std::size_t chainLength = 50;
+
+    std::vector<Scenario> createScenarios()
+    {
+        std::vector<Scenario> scenarios;
+
+        scenarios.push_back({"constants", [](const std::vector<tgui::Widget::Ptr>& widgets, std::size_t i, const tgui::Panel::Ptr&)
+            {
+                widgets[i]->setPosition(static_cast<float>(i % 100), static_cast<float>(i / 100));
+                widgets[i]->setSize(20, 10);
+            }});
+
+        scenarios.push_back({"operators (fan-out)", [](const std::vector<tgui::Widget::Ptr>& widgets, std::size_t i, const tgui::Panel::Ptr& panel)
+            {
+                widgets[i]->setPosition(bindWidth(panel) * 0.1f + static_cast<float>(i % 100), bindHeight(panel) * 0.2f);
+                widgets[i]->setSize(bindWidth(panel) * 0.25f, bindHeight(panel) / 10);
+            }});
+
+        scenarios.push_back({"operators (chains)", [](const std::vector<tgui::Widget::Ptr>& widgets, std::size_t i, const tgui::Panel::Ptr& panel)
+            {
+                if (i % chainLength == 0)
+                    widgets[i]->setPosition(bindLeft(panel), static_cast<float>(i / chainLength));
+                else
+                    widgets[i]->setPosition(bindRight(widgets[i-1]) + 2, bindTop(widgets[i-1]));
+
+                widgets[i]->setSize(bindWidth(panel) / static_cast<float>(chainLength), 10);
+            }});
+
+        scenarios.push_back({"bindStr", [](const std::vector<tgui::Widget::Ptr>& widgets, std::size_t i, const tgui::Panel::Ptr&)
+            {
+                widgets[i]->setPosition(bindStr2d("{(parent.width - width) / 2, " + std::to_string(i % 100) + " + parent.top}"));
+                widgets[i]->setSize(bindStr2d("{&.w / 4, min(&.h / 10, 30)}"));
+            }});
+
+        scenarios.push_back({"bindIf / bindRange", [](const std::vector<tgui::Widget::Ptr>& widgets, std::size_t i, const tgui::Panel::Ptr& panel)
+            {
+                widgets[i]->setPosition(bindIf(bindWidth(panel) > 500, bindWidth(panel) - 200, 10), static_cast<float>(i % 100));
+                widgets[i]->setSize(bindRange(10, 200, bindWidth(panel) / 4), bindIf(bindHeight(panel) > 400, 40, 20));
+            }});
+
+        return scenarios;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void runScenario(const Scenario& scenario, std::size_t widgetCount, bool deferred)
+    {
+        const unsigned int resizeCount = 10;
+
+        tgui::LayoutImpl::setDeferredUpdates(deferred);
+
+        const std::size_t bytesBefore = allocatedBytes;
+        peakAllocatedBytes = allocatedBytes;
+        auto start = std::chrono::steady_clock::now();
+
+        auto panel = std::make_shared<tgui::Panel>();
+        panel->setSize(800, 600);
+
+        std::vector<tgui::Widget::Ptr> widgets;
+        widgets.reserve(widgetCount);
+        for (std::size_t i = 0; i < widgetCount; ++i)
+        {
+            widgets.push_back(std::make_shared<tgui::ClickableWidget>());
+            panel->add(widgets.back());
+            scenario.setLayouts(widgets, i, panel);
+        }
+        tgui::LayoutImpl::recalculateDirtyLayouts();
+
+        const double constructionTime = millisecondsSince(start);
+        const double bytesPerWidget = static_cast<double>(allocatedBytes - bytesBefore) / widgetCount;
+
+        // Every resize of the panel has to be propagated to the widgets
+        const unsigned long long calculationsBefore = tgui::LayoutImpl::getCalculationCount();
+        start = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < resizeCount; ++i)
+        {
+            panel->setSize(800.f + 10 * (i + 1), 600.f + 10 * (i + 1));
+            tgui::LayoutImpl::recalculateDirtyLayouts();
+        }
+
+        const double resizeTime = millisecondsSince(start) / resizeCount;
+        const unsigned long long calculations = (tgui::LayoutImpl::getCalculationCount() - calculationsBefore) / resizeCount;
+
+        // Every widget has four layouts (left, top, width and height)
+        const double peakBytesPerLayout = static_cast<double>(peakAllocatedBytes - bytesBefore) / (4 * widgetCount);
+
+        start = std::chrono::steady_clock::now();
+        widgets.clear();
+        panel = nullptr;
+        const double destructionTime = millisecondsSince(start);
+
+        tgui::LayoutImpl::setDeferredUpdates(false);
+
+        std::printf("%-22s %-9s %8u %12.2f %12.3f %14llu %12.1f %14.1f %12.2f\n",
+                    scenario.name, deferred ? "deferred" : "immediate", static_cast<unsigned int>(widgetCount),
+                    constructionTime, resizeTime, calculations, bytesPerWidget, peakBytesPerLayout, destructionTime);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void* operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    deallocate(pointer);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::size_t> widgetCounts;
+    for (int i = 1; i < argc; ++i)
+        widgetCounts.push_back(static_cast<std::size_t>(std::strtoul(argv[i], nullptr, 10)));
+
+    if (widgetCounts.empty())
+        widgetCounts = {1000, 10000, 100000};
+
+    std::printf("%-22s %-9s %8s %12s %12s %14s %12s %14s %12s\n", "scenario", "updates", "widgets",
+                "build (ms)", "resize (ms)", "calcs/resize", "B/widget", "peak B/layout", "destroy (ms)");
+
+    for (auto& scenario : createScenarios())
+    {
+        for (auto widgetCount : widgetCounts)
+        {
+            if (widgetCount == 0)
+                continue;
+
+            runScenario(scenario, widgetCount, false);
+            runScenario(scenario, widgetCount, true);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
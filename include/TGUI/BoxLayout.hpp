@@ -146,6 +146,46 @@ namespace tgui
         bool remove(std::size_t index);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple widgets at the end of the layout
+        ///
+        /// @param widgets      Pointers to the widgets you would like to add
+        /// @param widgetNames  Names of the widgets, or an empty list when the widgets don't need a name
+        ///
+        /// @throw Exception when the amount of names doesn't match the amount of widgets
+        ///
+        /// The widgets will have ratio 1. The positions of the widgets are only recalculated once.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addWidgets(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames = {}) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets for which the predicate returns true
+        ///
+        /// @param predicate  Function that is called once for every widget, in the order of the widgets in the layout
+        ///
+        /// @return Amount of widgets that were removed
+        ///
+        /// The remaining widgets keep their ratio and fixed size. The positions of the widgets are only recalculated once.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t removeIf(const std::function<bool(const Widget::Ptr&)>& predicate) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the order of all widgets in the layout at once
+        ///
+        /// @param permutation  For every position in the new order, the current index of the widget that should go there
+        ///
+        /// @throw Exception when the permutation doesn't contain every index of the widgets exactly once
+        ///
+        /// The ratios and fixed sizes move together with their widgets.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reorder(const std::vector<std::size_t>& permutation) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the widget at the given index in the layout.
         ///
@@ -0,0 +1,146 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_CLIPPING_HPP
+#define TGUI_CLIPPING_HPP
+
+
+#include <TGUI/Global.hpp>
+
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    /// @brief Stack of areas to which the drawing is limited while the widgets are being drawn
+    ///
+    /// Widgets that may only draw inside part of their area push that part on the stack and pop it again afterwards.
+    /// Every area is intersected with the one below it. The scissor box is only changed when the visible area changes
+    /// and it never has to be read back from OpenGL while the gui is being drawn. Every thread has its own stack.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Clipping
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts drawing to a target
+        ///
+        /// @param target  Target to which will be drawn
+        /// @param left    Left side of the scissor box that is currently set
+        /// @param bottom  Bottom side of the scissor box that is currently set, in OpenGL coordinates
+        /// @param width   Width of the scissor box that is currently set
+        /// @param height  Height of the scissor box that is currently set
+        ///
+        /// Every call to this function has to be followed by a call to endDrawing.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void beginDrawing(const sf::RenderTarget& target, int left, int bottom, int width, int height);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts drawing to a render texture
+        ///
+        /// @param target  Render texture to which will be drawn
+        /// @param area    Part of the render texture to which the drawing is limited, in pixels with the origin in the top left corner
+        ///
+        /// The render texture is activated and clipping is enabled in its context. The clipping areas that were pushed
+        /// before this call are ignored until endDrawing is called.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void beginDrawing(sf::RenderTexture& target, const sf::IntRect& area);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops drawing to the target that was passed to the last beginDrawing call
+        ///
+        /// The scissor box isn't changed, the caller of beginDrawing is responsible for restoring it.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void endDrawing();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Limits the drawing to an area inside the current clipping area
+        ///
+        /// @param target               Target to which is being drawn
+        /// @param topLeftPosition      Top left corner of the area, in the coordinates of the view with its viewport applied
+        /// @param bottomRightPosition  Bottom right corner of the area, in the same coordinates as the top left corner
+        ///
+        /// When nothing is being drawn between beginDrawing and endDrawing (e.g. a widget is drawn directly on a window)
+        /// then the area is intersected with the scissor box that is set at that moment.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void push(const sf::RenderTarget& target, sf::Vector2f topLeftPosition, sf::Vector2f bottomRightPosition);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Restores the clipping area that was used before the last call to push
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void pop();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the area to which the drawing is currently limited
+        ///
+        /// @return Visible area in pixels, with the origin in the top left corner of the target.
+        ///         The area is empty when nothing is being drawn.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static sf::IntRect getArea();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        struct Area
+        {
+            int left;
+            int top;
+            int right;
+            int bottom;
+            int targetHeight;
+            bool base;      // Set by beginDrawing or read from OpenGL, the scissor box doesn't have to be restored afterwards
+            bool implicit;  // Read from OpenGL because push was called without beginDrawing
+        };
+
+        // Passes the area to glScissor
+        static void apply(const Area& area);
+
+        // Returns the stack of the current thread, guis that are drawn on different threads each have their own stack
+        static std::vector<Area>& getAreas();
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_CLIPPING_HPP
@@ -27,14 +27,28 @@
 #define TGUI_CONTAINER_HPP
 
 
+#include <functional>
 #include <list>
 
 #include <TGUI/Widget.hpp>
+#include <TGUI/SpatialIndex.hpp>
+#include <TGUI/NameIndex.hpp>
+#include <TGUI/FocusChain.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Statistics about the render cache of a container
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API RenderCacheStats
+    {
+        std::size_t hits = 0;      ///< Amount of times that the cached image of the widgets was drawn without redrawing the widgets
+        std::size_t redraws = 0;   ///< Amount of times that the widgets had to be drawn on the cached image again
+    };
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Container widget
     ///
@@ -176,6 +190,47 @@ namespace tgui
         virtual void removeAllWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple widgets to the container at once
+        ///
+        /// @param widgets      Pointers to the widgets you would like to add, in the order in which they should be added
+        /// @param widgetNames  Names of the widgets, or an empty list when the widgets don't need a name
+        ///
+        /// @throw Exception when the amount of names doesn't match the amount of widgets
+        ///
+        /// This gives the same result as calling add for every widget, but the container only has to update itself once.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void addWidgets(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets for which the predicate returns true
+        ///
+        /// @param predicate  Function that is called once for every widget, in the order of the widgets in the container
+        ///
+        /// @return Amount of widgets that were removed
+        ///
+        /// The remaining widgets keep their order. Unlike calling remove for every widget, the widgets are removed in a single
+        /// pass over the container.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::size_t removeIf(const std::function<bool(const Widget::Ptr&)>& predicate);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the order of all widgets in the container at once
+        ///
+        /// @param permutation  For every position in the new order, the current index of the widget that should go there
+        ///
+        /// @throw Exception when the permutation doesn't contain every index of the widgets exactly once
+        ///
+        /// The order of the widgets determines which widget is drawn on top of the others (the last one in the list).
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void reorder(const std::vector<std::size_t>& permutation);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the name of a widget.
         ///
@@ -313,6 +368,103 @@ namespace tgui
         void saveWidgetsToStream(std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Enables or disables the spatial index that is used to find the widget below the mouse
+        ///
+        /// @param enabled  Should the container keep track of where its widgets are located?
+        ///
+        /// By default the container checks every widget, from front to back, to find out which one is below the mouse.
+        /// When the container contains thousands of widgets, this becomes slow. With the spatial index enabled, the container
+        /// divides its area into cells and only checks the widgets that overlap the cell in which the mouse is located.
+        ///
+        /// Widgets whose clickable area isn't the rectangle defined by their position and size (e.g. a check box with clickable
+        /// text or a combo box with borders) are still checked for every mouse event.
+        ///
+        /// The spatial index is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the spatial index is used to find the widget below the mouse
+        ///
+        /// @return Is the spatial index enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSpatialIndexEnabled() const
+        {
+            return m_spatialIndex != nullptr;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the cells in the spatial index
+        ///
+        /// @param cellSize  Width and height of a single cell
+        ///
+        /// Ideally the cells are about as large as the widgets in the container. The default cell size is 64.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexCellSize(float cellSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the cells in the spatial index
+        ///
+        /// @return Width and height of a single cell
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getSpatialIndexCellSize() const
+        {
+            return m_spatialIndexCellSize;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Enables or disables drawing the widgets on a texture that is reused as long as they don't change
+        ///
+        /// @param enabled  Should the image of the widgets inside the container be cached?
+        ///
+        /// With the render cache enabled, the widgets are only drawn again after one of them changed. Every other frame
+        /// the container draws the cached image instead. This is useful for panels or child windows with many widgets that
+        /// rarely change.
+        ///
+        /// Widgets tell their parents about changes to their position, size, opacity, visibility, renderer properties,
+        /// text, value, hover and focus state and about the events that they receive. When a widget changes in any other
+        /// way (e.g. when calling a function on its renderer directly), call invalidate on the widget so that the cached
+        /// image gets redrawn.
+        ///
+        /// The render cache is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderCacheEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the widgets inside the container are drawn on a texture that is reused
+        ///
+        /// @return Is the image of the widgets cached?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRenderCacheEnabled() const
+        {
+            return m_renderCacheEnabled;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how often the cached image of the widgets was reused
+        ///
+        /// @return Amount of cache hits and redraws since the render cache was enabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const RenderCacheStats& getRenderCacheStats() const
+        {
+            return m_renderCacheStats;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -368,6 +520,21 @@ namespace tgui
         virtual Widget::Ptr askToolTip(sf::Vector2f mousePos) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // This function is called when the position or size of one of the widgets in this container changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetMouseAreaChanged(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // This function is called when a widget in this container is added, removed, shown, hidden, enabled or disabled,
+        // or when its tab index changes. It marks the focus chain of the container at the root of the widget tree as outdated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void focusOrderChanged();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -391,6 +558,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called every frame with the time passed since the last frame.
+        // Only the widgets inside the container that requested updates will be updated.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update(sf::Time elapsedTime) override;
 
@@ -402,6 +570,38 @@ namespace tgui
         bool handleEvent(sf::Event& event);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a widget at the back of the lists, without notifying the containers above this one that the widgets changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToContainer(const Widget::Ptr& widgetPtr, const sf::String& widgetName, NameIndex* globalNameIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the container itself or one of its widgets still needs to be updated every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isUpdateNeeded() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the shortest time until the container itself or one of the widgets that it updates changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time timeUntilNextUpdate() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the widget to the list of widgets that are updated every frame, and the container to the list of its own parent.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetNeedsUpdates(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when one of the widgets inside the container changed the way it looks. The area that has to be redrawn is
+        // given in the same coordinates as the absolute position of the widgets.
+        // The cached image of the widgets becomes outdated and the containers above this one are told about the change.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void widgetInvalidated(const sf::FloatRect& area);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Focuses the next widget in the container. If the last widget was focused then all widgets will be unfocused and
         // this function will return false.
@@ -417,6 +617,32 @@ namespace tgui
         bool tabKeyPressed();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the focus to the next or previous widget in the focus chain, anywhere in the widget tree.
+        // This function may only be called on a container that has a focus chain.
+        // The function will return true when another widget was focused.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool moveFocusInChain(bool forward);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the widgets that can be focused with the tab key inside the container, and inside the containers in it, to the chain.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addToFocusChain(FocusChain& chain, const Container& container);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the focused widget that lies the deepest in the widget tree, or nullptr when no widget is focused.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget* getDeepestFocusedWidget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Focuses a widget that lies somewhere inside this container, together with all the containers in between.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void focusWidgetInTree(Widget* widget);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Checks above which widget the mouse is standing.
         // If there is no widget below the mouse then this function will return a null pointer.
@@ -424,6 +650,49 @@ namespace tgui
         Widget::Ptr mouseOnWhichWidget(float x, float y);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Searches the widget with the given name by checking all widgets one by one.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr findWidgetByName(const sf::String& widgetName, bool recursive) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the widgets on which the mouse went down that the mouse has been released.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mouseNoLongerDownOnWidgets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the position of the widget in m_widgets, or the amount of widgets when it isn't part of this container.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getWidgetIndex(const Widget* widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function has to be called after the order of the widgets in m_widgets was changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetOrderChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates or destroys the index with the names of all widgets inside this container and the containers inside it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setGlobalNameIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the global name index of the container at the root of the widget tree, or nullptr when it doesn't have one.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        NameIndex* getGlobalNameIndex() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes a widget, and all widgets inside it when it is a container, to or from a name index.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addToNameIndex(NameIndex& index, const Widget::Ptr& widget, const sf::String& widgetName);
+        static void removeFromNameIndex(NameIndex& index, const Widget::Ptr& widget, const sf::String& widgetName);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function will call the draw function from all the widgets.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -438,12 +707,46 @@ namespace tgui
 
         Widget::Ptr m_widgetBelowMouse;
 
+        // Widgets on which the mouse went down since the mouse was last released, the last one is the one that can be dragged.
+        // The widget on which the mouse went down before the last release is kept in the list until the next release.
+        std::vector<Widget::Ptr> m_widgetsWithMouseDown;
+
+        // Widgets that are updated every frame because they requested it, in the order in which they requested it.
+        // The other list contains the widgets that are being updated, as the widgets can request updates while updating.
+        std::vector<Widget::Ptr> m_widgetsToUpdate;
+        std::vector<Widget::Ptr> m_updatingWidgets;
+
         // The id of the focused widget
         std::size_t m_focusedWidget = 0;
 
         // Did we enter handleEvent directly or because we got a MouseReleased event?
         bool m_handingMouseReleased = false;
 
+        // Finds the widgets in this container by name
+        NameIndex m_nameIndex;
+
+        // Position of every widget in m_widgets, rebuilt when needed after the order of the widgets changed
+        mutable std::unordered_map<const Widget*, std::size_t> m_widgetIndices;
+        mutable bool m_widgetIndicesValid = true;
+
+        // Finds widgets by name in this container and in all containers inside it.
+        // Only the container at the root of the widget tree uses it and only when it was enabled.
+        std::unique_ptr<NameIndex> m_globalNameIndex;
+
+        // Finds the widgets that may be below the mouse, only created when enabled
+        std::unique_ptr<SpatialIndex> m_spatialIndex;
+        float m_spatialIndexCellSize = 64;
+
+        // Order in which the widgets in the whole widget tree are focused with the tab key.
+        // Only the container of the gui has it, it is rebuilt when it is needed after it has been invalidated.
+        std::unique_ptr<FocusChain> m_focusChain;
+
+        // Image of the widgets that is drawn instead of the widgets themselves while they don't change
+        bool m_renderCacheEnabled = false;
+        mutable bool m_renderCacheValid = false;
+        mutable std::unique_ptr<sf::RenderTexture> m_renderCache;
+        mutable RenderCacheStats m_renderCacheStats;
+
 
         friend class Widget;
 
@@ -506,11 +809,20 @@ namespace tgui
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers the area that has to be redrawn until the gui draws the widgets again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void widgetInvalidated(const sf::FloatRect& area) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
         sf::RenderTarget* m_window = nullptr;
 
+        // Areas that changed since the widgets were last drawn, relative to the top left corner of the view
+        std::vector<sf::FloatRect> m_damagedAreas;
+
 
         friend class Gui;
 
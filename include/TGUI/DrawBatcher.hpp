@@ -0,0 +1,175 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_DRAW_BATCHER_HPP
+#define TGUI_DRAW_BATCHER_HPP
+
+
+#include <TGUI/Global.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Statistics about the drawing of the widgets
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API DrawStats
+    {
+        std::size_t drawCalls = 0;        ///< Amount of times that something was drawn on the render target
+        std::size_t batchedDraws = 0;     ///< Amount of draws that were merged into a batch instead of being drawn separately
+        std::size_t batchedVertices = 0; ///< Amount of vertices that were drawn as part of a batch
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Merges the geometry that widgets draw into as few draw calls as possible
+    ///
+    /// While the widgets inside a container are being drawn, textured triangles that use the same texture are collected
+    /// in a single vertex array instead of being drawn immediately. The collected triangles are drawn as soon as anything
+    /// else has to be drawn, the texture changes or the clipping area changes, so the widgets still end up on top of each
+    /// other in the same order.
+    ///
+    /// Widgets have to draw everything through this class for the order to remain correct. Custom widgets that draw directly
+    /// on the render target have to call flush first. Textures pass their vertices to this class themselves when they are
+    /// drawn on the render target. Batching is disabled by default.
+    ///
+    /// The state is kept per thread: enabling batching, the pending batch and the statistics only affect the guis that are
+    /// drawn on the calling thread.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API DrawBatcher
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the geometry of the widgets is merged into batches
+        ///
+        /// @param enabled  Should draws be batched?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the geometry of the widgets is merged into batches
+        ///
+        /// @return Are draws batched?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Starts drawing widgets, draws are only batched between beginDrawing and endDrawing
+        ///
+        /// The calls can be nested, only the outer call resets the statistics.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void beginDrawing();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Stops drawing widgets, everything that was batched is drawn when this is the outer call
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void endDrawing();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws vertices, or adds them to the current batch
+        ///
+        /// @param target       Render target to draw to
+        /// @param vertices     Pointer to the vertices
+        /// @param vertexCount  Number of vertices in the array
+        /// @param type         Type of primitives to draw
+        /// @param states       Render states to use for drawing
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount,
+                         sf::PrimitiveType type, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a drawable object on the render target, after drawing everything that was batched
+        ///
+        /// @param target    Render target to draw to
+        /// @param drawable  Object to draw
+        /// @param states    Render states to use for drawing
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a widget, which draws its own parts through this class
+        ///
+        /// @param target  Render target to draw to
+        /// @param widget  Widget to draw
+        /// @param states  Render states to use for drawing
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const Widget& widget, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws everything that was batched
+        ///
+        /// This has to be called before changing the state of the render target or OpenGL while drawing.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void flush();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the drawing
+        ///
+        /// @return Statistics since the start of the last outer beginDrawing call (e.g. the last time the gui was drawn)
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const DrawStats& getStats();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // Returns whether the draw can be added to the current batch
+        static bool canBatch(const sf::RenderTarget& target, const sf::RenderStates& states);
+
+        // Adds the vertices to the batch, as separate triangles in the coordinates of the render target
+        static void addToBatch(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::Transform& transform);
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_DRAW_BATCHER_HPP
@@ -0,0 +1,169 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_FOCUS_CHAIN_HPP
+#define TGUI_FOCUS_CHAIN_HPP
+
+
+#include <TGUI/Global.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    /// @brief List of all widgets that can be focused with the tab key, in the order in which they are focused
+    ///
+    /// The widgets are added in the order in which they are found in the widget tree. Afterwards they are sorted on their
+    /// tab index, widgets with the same tab index keep their order.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API FocusChain
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the chain as outdated
+        ///
+        /// The owner of the chain has to rebuild it before using it again.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate()
+        {
+            m_valid = false;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the chain is still up-to-date
+        ///
+        /// @return False when invalidate was called after the chain was last built
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isValid() const
+        {
+            return m_valid;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets from the chain before rebuilding it
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a widget at the end of the chain
+        ///
+        /// @param widget  Widget that can be focused
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void add(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Orders the widgets on their tab index and marks the chain as valid
+        ///
+        /// This function has to be called after all widgets have been added.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finish();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the widget that is focused after the given one
+        ///
+        /// @param focusedWidget  The widget that is currently focused, or nullptr when no widget is focused
+        ///
+        /// @return Next widget in the chain. When the focused widget is a container that isn't part of the chain, the first
+        ///         widget inside it is returned. The last widget in the chain is followed by the first one again.
+        ///         Returns nullptr when the chain is empty.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget* getNext(const Widget* focusedWidget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the widget that is focused before the given one
+        ///
+        /// @param focusedWidget  The widget that is currently focused, or nullptr when no widget is focused
+        ///
+        /// @return Previous widget in the chain. When the focused widget is a container that isn't part of the chain, the
+        ///         widget before the first widget inside it is returned. The first widget in the chain is preceded by the
+        ///         last one. Returns nullptr when the chain is empty.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget* getPrevious(const Widget* focusedWidget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of widgets in the chain
+        ///
+        /// @return Amount of widgets that can be focused
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t size() const
+        {
+            return m_widgets.size();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // Returns the position of the widget in the chain, or of the first widget inside it when it is a container.
+        // When the widget can't be found then the size of the chain is returned.
+        std::size_t findPosition(const Widget* widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        std::vector<Widget*> m_widgets;
+
+        // Position of every widget in m_widgets
+        std::unordered_map<const Widget*, std::size_t> m_positions;
+
+        // Position of the first widget in m_widgets that lies inside the container
+        std::unordered_map<const Widget*, std::size_t> m_containerPositions;
+
+        bool m_valid = false;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FOCUS_CHAIN_HPP
@@ -0,0 +1,129 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_FRAME_STATS_HPP
+#define TGUI_FRAME_STATS_HPP
+
+
+#include <TGUI/Global.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// The statements that collect the statistics only exist when TGUI was built with the TGUI_FRAME_STATS option
+// The define is only passed while building the library itself, so the macro may only be used in its source files
+#ifdef TGUI_ENABLE_FRAME_STATS
+    #define TGUI_FRAME_STATS(statement) statement
+#else
+    #define TGUI_FRAME_STATS(statement)
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Statistics about the work that was done during a frame
+    ///
+    /// The statistics are only collected when TGUI was built with the TGUI_FRAME_STATS CMake option, otherwise all values stay 0.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API FrameStats
+    {
+        std::size_t drawCalls = 0;              ///< Amount of times that something was drawn on a render target
+        std::size_t vertices = 0;               ///< Amount of vertices that were drawn, not counting the ones of sfml drawables such as texts
+        std::size_t textureBinds = 0;           ///< Amount of draw calls that used a different texture than the draw call before it
+        std::size_t scissorChanges = 0;         ///< Amount of times that the clipping area was changed
+        std::size_t widgetsDrawn = 0;           ///< Amount of visible widgets that were drawn
+        std::size_t widgetsCulled = 0;          ///< Amount of visible widgets that were skipped because they lie outside the clipping area
+        std::size_t updateCalls = 0;            ///< Amount of times that the update function of a widget was called
+        std::size_t layoutRecalculations = 0;   ///< Amount of times that the value of a layout was calculated
+        std::size_t signalsEmitted = 0;         ///< Amount of signals that were sent to connected functions
+        sf::Time handleEventTime;               ///< Time spent in Gui::handleEvent
+        sf::Time updateTime;                    ///< Time spent in Gui::updateTime, which is also part of the draw time
+        sf::Time drawTime;                      ///< Time spent in Gui::draw
+    };
+
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Counters of the work that was done on the current thread since it started
+        ///
+        /// A gui remembers the counters when a frame starts and subtracts them from the counters when the frame ends.
+        /// The counters are shared by all guis on the same thread.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API FrameStatsCounters
+        {
+        public:
+
+            // Adds an amount to one of the counters
+            static void add(std::size_t FrameStats::* counter, std::size_t amount = 1);
+
+            // Counts a draw call. The texture is compared to the one of the previous draw call to find out whether it had to be bound.
+            static void addDrawCall(const sf::Texture* texture, std::size_t vertexCount);
+
+            // Counts a draw call of an sfml drawable, which may use any texture
+            static void addDrawableDrawCall();
+
+            // Stores the current counters in the stats of the frame that starts, the times are reset to 0
+            static void startFrame(FrameStats& currentFrame);
+
+            // Calculates the stats of the frame that ends and starts the next frame
+            static void finishFrame(FrameStats& currentFrame, FrameStats& finishedFrame);
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Adds the time during which the object exists to one of the times of a frame
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API FrameStatsTimer
+        {
+        public:
+
+            FrameStatsTimer(FrameStats& stats, sf::Time FrameStats::* time);
+            ~FrameStatsTimer();
+
+            FrameStatsTimer(const FrameStatsTimer&) = delete;
+            FrameStatsTimer& operator=(const FrameStatsTimer&) = delete;
+
+        private:
+
+            FrameStats& m_stats;
+            sf::Time FrameStats::* m_time;
+            sf::Clock m_clock;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FRAME_STATS_HPP
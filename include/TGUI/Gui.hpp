@@ -30,6 +30,8 @@
 #include <queue>
 
 #include <TGUI/Container.hpp>
+#include <TGUI/FrameStats.hpp>
+#include <TGUI/TaskQueue.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -146,18 +148,130 @@ namespace tgui
         ///         When this function returns false, then the event was ignored by all widgets.
         ///
         /// You should call this function in your event loop.
+        /// Tasks that were posted to the gui are executed before the event is handled.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool handleEvent(sf::Event event);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Polls all pending events from the window and passes them to the widgets
+        ///
+        /// @param window        The window from which the events are polled
+        /// @param eventHandler  Optional function that is called for every event right before it is passed to the widgets
+        ///
+        /// This function can replace the pollEvent loop in which handleEvent is called. When multiple MouseMoved events
+        /// directly follow each other, only the last one is handled, because only the last mouse position matters.
+        /// All other events are handled in the order in which they were received.
+        ///
+        /// @code
+        /// gui.handleEvents(window, [&](const sf::Event& event){
+        ///     if (event.type == sf::Event::Closed)
+        ///         window.close();
+        /// });
+        /// @endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void handleEvents(sf::Window& window, const std::function<void(const sf::Event&)>& eventHandler = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Passes a list of events to the widgets, skipping mouse moves that are directly followed by another mouse move
+        ///
+        /// @param events        The events that were polled from the window, in the order in which they were received
+        /// @param eventHandler  Optional function that is called for every event right before it is passed to the widgets
+        ///
+        /// @return Amount of MouseMoved events that were skipped
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t handleEvents(const std::vector<sf::Event>& events, const std::function<void(const sf::Event&)>& eventHandler = nullptr);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws all the widgets that were added to the gui.
         ///
+        /// Tasks that were posted to the gui are executed before the widgets are drawn.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether draw only redraws the parts of the gui that changed
+        ///
+        /// @param enabled  Should the widgets be drawn on a back buffer in which only the changed areas are redrawn?
+        ///
+        /// When enabled, the widgets are drawn on a render texture with the size of the target. Every call to draw only
+        /// redraws the widgets inside the areas that changed since the previous call and then draws the render texture
+        /// on the target. This saves a lot of work when only a small part of a large gui changes, e.g. a blinking caret.
+        ///
+        /// Partial redrawing is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPartialRedrawEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether draw only redraws the parts of the gui that changed
+        ///
+        /// @return Are the widgets drawn on a back buffer in which only the changed areas are redrawn?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isPartialRedrawEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether any widget changed since the gui was last drawn
+        ///
+        /// @return Does the gui look different than after the last call to draw?
+        ///
+        /// When this function returns false and nothing else in the window changed, the application can skip clearing,
+        /// drawing and displaying the window entirely.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDirty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the gui has to be drawn again
+        ///
+        /// @return Did a widget change since the last call to draw, or is something waiting that changes the gui during draw?
+        ///
+        /// Together with timeUntilNextUpdate this allows the application to sleep instead of drawing every frame:
+        /// @code
+        /// while (window.isOpen())
+        /// {
+        ///     // Handle the events that arrived while sleeping
+        ///     ...
+        ///
+        ///     if (gui.needsRedraw())
+        ///     {
+        ///         window.clear();
+        ///         gui.draw();
+        ///         window.display();
+        ///     }
+        ///     else
+        ///         sf::sleep(std::min(gui.timeUntilNextUpdate(), sf::milliseconds(10)));
+        /// }
+        /// @endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool needsRedraw() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long the gui stays unchanged when no events arrive
+        ///
+        /// @return Time until the next blinking caret, running animation, tool tip or posted task changes the gui
+        ///
+        /// Zero is returned when the gui already has to be drawn again, e.g. when an animation is running or when layouts
+        /// or posted tasks are waiting to be processed. When nothing in the gui changes by itself, a time of the maximum
+        /// duration is returned and the application only has to wake up when an event arrives.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time timeUntilNextUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the container.
         ///
@@ -322,6 +436,40 @@ namespace tgui
         void removeAllWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple widgets at once to the container
+        ///
+        /// @param widgets      Pointers to the widgets you would like to add, in the order in which they should be added
+        /// @param widgetNames  Names of the widgets, or an empty list when the widgets don't need a name
+        ///
+        /// @throw Exception when the amount of names doesn't match the amount of widgets
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addWidgets(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets for which the predicate returns true
+        ///
+        /// @param predicate  Function that is called once for every widget, in the order of the widgets in the container
+        ///
+        /// @return Amount of widgets that were removed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t removeIf(const std::function<bool(const Widget::Ptr&)>& predicate);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the order of all widgets in the container at once
+        ///
+        /// @param permutation  For every position in the new order, the current index of the widget that should go there
+        ///
+        /// @throw Exception when the permutation doesn't contain every index of the widgets exactly once
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reorder(const std::vector<std::size_t>& permutation);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the name of a widget.
         ///
@@ -345,6 +493,31 @@ namespace tgui
         std::string getWidgetName(const Widget::Ptr& widget) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Enables or disables the index with the names of all widgets in the gui
+        ///
+        /// @param enabled  Should the gui keep track of the names of the widgets inside all of its containers?
+        ///
+        /// Every container can find its own widgets by name without checking them one by one. Searching recursively
+        /// (by passing true as second parameter to get) still has to visit every container though. With this index enabled,
+        /// the gui keeps the names of all widgets in the whole tree up-to-date, so that a recursive search for a name that
+        /// is used by only one widget no longer depends on the amount of widgets.
+        ///
+        /// The index is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setGlobalNameIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the gui keeps track of the names of all widgets in the gui
+        ///
+        /// @return Is the global name index enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isGlobalNameIndexEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses a widget.
         ///
@@ -359,8 +532,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget.
         ///
-        /// The currently focused widget will be unfocused, even if it was the only widget.
-        /// When no widget was focused, the first widget in the container will be focused.
+        /// This is the widget that would be focused when pressing the tab key. Containers are never focused themselves,
+        /// the widgets inside them are part of the same order as the other widgets in the gui.
+        /// When no widget was focused, the first widget will be focused.
+        ///
+        /// @see Widget::setTabIndex
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void focusNextWidget();
@@ -369,8 +545,10 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the previous widget.
         ///
-        /// The currently focused widget will be unfocused, even if it was the only widget.
-        /// When no widget was focused, the last widget in the container will be focused.
+        /// This is the widget that would be focused when pressing shift+tab, the opposite order of focusNextWidget.
+        /// When no widget was focused, the last widget will be focused.
+        ///
+        /// @see Widget::setTabIndex
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void focusPreviousWidget();
@@ -444,6 +622,122 @@ namespace tgui
         void saveWidgetsToStream(std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether layouts are recalculated immediately or only once per frame.
+        ///
+        /// @param deferred  Should changing the position or size of a widget only mark the layouts that depend on it as dirty?
+        ///
+        /// When layout updates are deferred, the dirty layouts are recalculated when draw, updateTime or flushLayouts is called.
+        /// Every layout is then recalculated only once, no matter how many of the widgets it depends on were changed.
+        /// This setting is shared by all gui objects that are used on the same thread. By default the layouts are recalculated immediately.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLayoutUpdatesDeferred(bool deferred);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether layouts are recalculated immediately or only once per frame.
+        ///
+        /// @return Are the layout updates deferred until the next draw, updateTime or flushLayouts call?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getLayoutUpdatesDeferred() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates all layouts that were marked as dirty while layout updates were deferred.
+        ///
+        /// This function is called automatically by draw and updateTime.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushLayouts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Posts a function that has to be executed on the thread that uses the gui
+        ///
+        /// @param task  Function to execute
+        ///
+        /// This is the only function of the gui that can safely be called from other threads.
+        /// The task is executed during the next call to draw or handleEvent.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> task);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Posts a function that changes a widget from another thread
+        ///
+        /// @param widget  The widget to change
+        /// @param update  Function that gets a reference to the widget, e.g. [](tgui::Label& label){ label.setText("Done"); }
+        ///
+        /// The gui does not keep the widget alive, the function is not executed when the widget no longer exists by the time
+        /// that the task is executed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename WidgetType, typename Func>
+        void post(const std::shared_ptr<WidgetType>& widget, Func update)
+        {
+            std::weak_ptr<WidgetType> weakWidget = widget;
+            post([weakWidget, update]() {
+                auto lockedWidget = weakWidget.lock();
+                if (lockedWidget)
+                    update(*lockedWidget);
+            });
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how many posted tasks are executed at most during one call to draw or handleEvent
+        ///
+        /// @param maxTasks  Maximum amount of tasks to execute at once
+        ///
+        /// Tasks that remain in the queue are executed during the next call. By default at most 1000 tasks are executed at once.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMaxTasksPerUpdate(std::size_t maxTasks);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many posted tasks are executed at most during one call to draw or handleEvent
+        ///
+        /// @return Maximum amount of tasks to execute at once
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getMaxTasksPerUpdate() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes the tasks that were posted to the gui
+        ///
+        /// This function is called automatically by draw and handleEvent.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void executePostedTasks();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the tasks that were posted to the gui
+        ///
+        /// @return Amount of waiting tasks and the amount of tasks and time spent during the last execution of tasks
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TaskQueueStats getTaskQueueStats() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the work that was done during the last frame
+        ///
+        /// @return Amount of draw calls, updated widgets, recalculated layouts, ... and the time spent in the gui functions
+        ///
+        /// A frame ends when draw returns, so the statistics include everything that happened on the thread between the
+        /// last two calls to draw. They are only collected when TGUI was built with the TGUI_FRAME_STATS CMake option,
+        /// otherwise all values are 0. A FrameStatsOverlay widget can show them on top of the gui.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FrameStats getFrameStats() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // Update the internal clock to make animation possible. This function is called automatically by the draw function.
@@ -452,6 +746,21 @@ namespace tgui
         void updateTime(const sf::Time& elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the widgets, the draw function only adds the collection of the frame statistics around it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawWidgets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Redraws the widgets on the back buffer inside the areas that changed since the last call
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void redrawDamagedAreas();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -474,6 +783,22 @@ namespace tgui
 
         sf::View m_view;
 
+        // Functions that were posted from other threads
+        TaskQueue m_tasks;
+        std::size_t m_maxTasksPerUpdate = 1000;
+
+        // Events that were polled by handleEvents, kept to reuse the memory
+        std::vector<sf::Event> m_polledEvents;
+
+        // Image of the widgets in which only the damaged areas are redrawn when partial redrawing is enabled
+        bool m_partialRedrawEnabled = false;
+        bool m_fullRedrawNeeded = true;
+        std::unique_ptr<sf::RenderTexture> m_backBuffer;
+
+        // Statistics of the last finished frame and the counters and times of the frame that is in progress
+        FrameStats m_frameStats;
+        FrameStats m_currentFrameStats;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -27,6 +27,7 @@
 #define TGUI_LAYOUT_HPP
 
 #include <SFML/System/Vector2.hpp>
+#include <SFML/System/String.hpp>
 #include <TGUI/Config.hpp>
 #include <functional>
 #include <memory>
@@ -72,6 +73,26 @@ namespace tgui
             Conditional
         };
 
+        /// Properties of a widget on which a layout can depend
+        enum class WidgetProperty
+        {
+            Left,
+            Top,
+            Width,
+            Height,
+            Right,
+            Bottom
+        };
+
+        /// Layout that has to be recalculated when the position or size of a widget changes
+        struct WidgetDependency
+        {
+            std::weak_ptr<LayoutImpl> layout; ///< Layout that depends on the widget
+            WidgetProperty property; ///< Property of the widget that is used by the layout
+            bool position; ///< Does the layout have to be recalculated when the position of the widget changes?
+            bool size; ///< Does the layout have to be recalculated when the size of the widget changes?
+        };
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
@@ -82,20 +103,92 @@ namespace tgui
         /// @brief Recalculate the value
         void recalculate();
 
+        /// @brief Recalculate the layout when the position and/or size of the widget changes
+        void addWidgetDependency(Widget* widget, WidgetProperty property, bool position, bool size);
+
+        /// @brief Recalculate the layouts that depend on the widget. Called when the widget is moved or resized.
+        static void widgetChanged(Widget* widget, bool positionChanged, bool sizeChanged);
+
+        /// @brief Forget about all layouts that depend on the widget. Called when the widget is destroyed.
+        static void removeWidgetDependencies(Widget* widget);
+
+        /// @brief Remember that the layout has to be recalculated during the next call to recalculateDirtyLayouts
+        void markDirty();
+
+        /// @brief Recalculate all layouts of the current thread that were marked as dirty and the layouts that depend on them.
+        /// Every affected layout is recalculated only once, after the layouts that it uses in its expression.
+        static void recalculateDirtyLayouts();
+
+        /// @brief Changes whether changes to widgets only mark the layouts as dirty instead of recalculating them immediately.
+        /// The setting only applies to the current thread.
+        static void setDeferredUpdates(bool deferred);
+
+        /// @brief Returns whether changes to widgets only mark the layouts as dirty instead of recalculating them immediately
+        static bool getDeferredUpdates();
+
+        /// @brief Returns whether layouts of the current thread are waiting to be recalculated by recalculateDirtyLayouts
+        static bool hasDirtyLayouts();
+
+        /// @brief Returns how many times the value of a layout has been calculated on the current thread
+        ///
+        /// This counter only exists to measure the cost of the layout system, e.g. in benchmarks.
+        static unsigned long long getCalculationCount();
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        // Calculate the value of a layout defined by a string
-        float parseLayoutString(std::string expression);
+        // Calculate the value from the current values of the operands
+        void calculateValue();
 
-        // Parse references to widgets from the layout strings
-        float parseWidgetName(const std::string& expression, Widget* widget, const std::string& alreadyParsedPart = "");
+        // Add this layout and all layouts that depend on it to the list, each layout after the ones that make use of it
+        void sortDependentLayouts(std::set<LayoutImpl*>& visitedLayouts, std::vector<std::shared_ptr<LayoutImpl>>& sortedLayouts);
+
+        // Reference to a widget inside a layout string (e.g. "parent.width" or "button.left")
+        struct WidgetReference
+        {
+            std::vector<sf::String> path; // Names of the widgets to pass through, an empty name refers to the parent
+            WidgetProperty property = WidgetProperty::Left;
+            std::string positionCallbackKey;
+            std::string sizeCallbackKey;
+        };
+
+        // Node of a compiled string expression. Constants use Operation::Value, while widget references use Operation::String
+        // and store the index of the reference in the first operand. Operands are indices in the expressionNodes vector.
+        struct ExpressionNode
+        {
+            Operation operation;
+            float value;
+            std::size_t operands[3];
+        };
+
+        // Compile the (part of the) string expression into nodes and return the index of the root node
+        std::size_t compileExpression(std::string expression);
+
+        // Compile a reference to a widget from the layout string
+        std::size_t compileWidgetReference(std::string expression);
+
+        // Add a node to the compiled expression and return its index
+        std::size_t addExpressionNode(Operation nodeOperation, std::size_t first = 0, std::size_t second = 0, std::size_t third = 0);
+        std::size_t addConstantNode(float constant);
+
+        // Returns the token that replaces an already compiled part of the string expression
+        static std::string getNodePlaceholder(std::size_t node);
+
+        // Calculate the value of a node in the compiled expression
+        float evaluateExpression(std::size_t node);
+
+        // Find the referenced widget and return the value of its property
+        float evaluateWidgetReference(const WidgetReference& reference);
+
+        // Make sure the layout gets updated when the referenced widget changes
+        void bindWidget(Widget* widget, const std::string& callbackKey, WidgetProperty property, bool position, bool size);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
         float value = 0; ///< Cached value of the layout
+        bool boundToWidget = false; ///< Is the value changed by a widget or is it a constant (only used when operation == Operation::Value)
         std::set<Layout*> attachedLayouts; ///< Layout objects that use this shared object
         std::set<LayoutImpl*> parents; ///< Other layouts that make use of this layout in their expression
 
@@ -108,6 +201,13 @@ namespace tgui
 
     private:
         std::set<std::string> boundCallbacks;
+        std::vector<Widget*> boundWidgets; // Widgets that have this layout in their list of dependencies
+        bool dirty = false;
+
+        // Compiled version of the string expression
+        std::vector<ExpressionNode> expressionNodes;
+        std::vector<WidgetReference> widgetReferences;
+        std::size_t expressionRoot = 0;
     };
 
 
@@ -169,6 +269,16 @@ namespace tgui
         Layout(const Layout& copy);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Construct a layout that shares an existing layout implementation
+        ///
+        /// @param impl  Shared layout data
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit Layout(const std::shared_ptr<LayoutImpl>& impl);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Destructor
         ///
@@ -119,7 +119,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
-        static std::map<std::string, std::function<Widget::Ptr()>> m_constructors; ///< Widget creator functions
+        static std::map<WidgetTypeId, std::function<Widget::Ptr()>> m_constructors; ///< Widget creator functions
         static std::shared_ptr<BaseThemeLoader> m_themeLoader;  ///< Theme loading functions, they read the theme file
     };
 
@@ -293,7 +293,7 @@ namespace tgui
         std::string m_resourcePath;
         bool m_resourcePathLock = false;
         std::map<Widget*, std::string> m_widgets; // Map widget to class name
-        std::map<std::string, std::string> m_widgetTypes; // Map class name to type
+        std::map<std::string, WidgetTypeId> m_widgetTypes; // Map class name to type
         std::map<std::string, std::map<std::string, std::string>> m_widgetProperties; // Map class name to property-value pairs
 
         friend class ThemeTest;
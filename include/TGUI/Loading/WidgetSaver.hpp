@@ -79,9 +79,20 @@ namespace tgui
         static const SaveFunction& getSaveFunction(const std::string& type);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieve the save function of a certain widget type
+        ///
+        /// @param typeId  Id of the widget type, as returned by Widget::getWidgetTypeId
+        ///
+        /// @return Function called to save the widget
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const SaveFunction& getSaveFunction(WidgetTypeId typeId);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
-        static std::map<std::string, SaveFunction> m_saveFunctions;
+        static std::map<WidgetTypeId, SaveFunction> m_saveFunctions;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,114 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_NAME_INDEX_HPP
+#define TGUI_NAME_INDEX_HPP
+
+
+#include <TGUI/Global.hpp>
+
+#include <SFML/System/String.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    /// @brief Hash table that finds the widgets that were given a certain name
+    ///
+    /// Multiple widgets may share the same name. Widgets without a name are not stored.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API NameIndex
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a widget to the index
+        ///
+        /// @param name    Name of the widget
+        /// @param widget  The widget that was given the name
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(const sf::String& name, Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a widget from the index
+        ///
+        /// @param name    Name under which the widget was added
+        /// @param widget  The widget to remove
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void remove(const sf::String& name, Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets from the index
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear()
+        {
+            m_widgets.clear();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the widgets that have a given name
+        ///
+        /// @param name  Name of the widgets to find
+        ///
+        /// @return List of widgets with the name, in no particular order
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Widget*>& find(const sf::String& name) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        struct StringHash
+        {
+            std::size_t operator()(const sf::String& str) const;
+        };
+
+        std::unordered_map<sf::String, std::vector<Widget*>, StringHash> m_widgets;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_NAME_INDEX_HPP
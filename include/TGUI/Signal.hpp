@@ -30,8 +30,8 @@
 #include <TGUI/Global.hpp>
 #include <TGUI/Callback.hpp>
 
-#include <map>
-#include <deque>
+#include <vector>
+#include <atomic>
 #include <memory>
 #include <cassert>
 #include <functional>
@@ -52,10 +52,6 @@ namespace tgui
 
     namespace priv
     {
-        extern TGUI_API std::deque<const void*> data;
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
         template <typename T>
         std::string convertTypeToString();
 
@@ -135,10 +131,11 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        // Returns one of the arguments with which the signal is being sent
         template <typename Type>
-        const Type& dereference(const void* obj)
+        const Type& dereference(const void* const* arguments, std::size_t argPos)
         {
-            return *static_cast<const Type*>(obj);
+            return *static_cast<const Type*>(arguments[argPos]);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -152,10 +149,11 @@ namespace tgui
         template <typename... T>
         struct connector;
 
+        // The returned functions are called with the array of arguments with which the signal is sent
         template <typename Func, typename... Args>
         struct connector<TypeSet<>, Func, Args...>
         {
-            static std::function<void()> connect(Func func, std::size_t, Args... args)
+            static std::function<void(const void* const*)> connect(Func func, std::size_t, Args... args)
             {
                 return std::bind(func, args...);
             }
@@ -164,20 +162,20 @@ namespace tgui
         template <typename Func, typename... Args, typename Type>
         struct connector<TypeSet<Type>, Func, Args...>
         {
-            static std::function<void()> connect(Func func, std::size_t argPos, Args... args)
+            static std::function<void(const void* const*)> connect(Func func, std::size_t argPos, Args... args)
             {
-                return std::bind(func, args..., std::bind(dereference<Type>, std::cref(data[argPos])));
+                return std::bind(func, args..., std::bind(dereference<Type>, std::placeholders::_1, argPos));
             }
         };
 
         template <typename Func, typename... Args, typename TypeA, typename TypeB>
         struct connector<TypeSet<TypeA, TypeB>, Func, Args...>
         {
-            static std::function<void()> connect(Func func, std::size_t argPos, Args... args)
+            static std::function<void(const void* const*)> connect(Func func, std::size_t argPos, Args... args)
             {
                 return std::bind(func, args...,
-                                 std::bind(dereference<TypeA>, std::cref(data[argPos])),
-                                 std::bind(dereference<TypeB>, std::cref(data[argPos+1])));
+                                 std::bind(dereference<TypeA>, std::placeholders::_1, argPos),
+                                 std::bind(dereference<TypeB>, std::placeholders::_1, argPos+1));
             }
         };
 
@@ -239,22 +237,37 @@ namespace tgui
     {
     public:
 
-        Signal(std::vector<std::vector<std::string>>&& types);
+        // The name must be a string literal and the types must outlive the signal, neither of them are copied
+        Signal(const char* name, const std::vector<std::vector<std::string>>& types);
+
+        // Only the connected functions are copied, a copy is never in the middle of sending the signal
+        Signal(const Signal& other);
+
+        Signal& operator=(const Signal& right);
 
+        ~Signal();
+
+        const char* getName() const;
+
+        // The id of the connection is only taken from the counter once the parameters are known to be valid
         template <typename Func, typename... Args>
-        void connect(unsigned int id, Func func, Args... args)
+        unsigned int connect(std::atomic<unsigned int>& idCounter, Func func, Args... args)
         {
             using type = typename priv::isFunctionConvertible<Func, decltype(priv::bindRemover<Args>::remove(args))...>::type;
             static_assert(!std::is_same<type, TypeSet<void>>::value, "Parameters passed to the connect function are wrong!");
 
             auto argPos = checkCompatibleParameterType<type>();
-            m_functions[id] = priv::connector<type, Func, Args...>::connect(func, argPos, args...);
+            const unsigned int id = idCounter++;
+            addHandler({id, priv::connector<type, Func, Args...>::connect(func, argPos, args...), nullptr, true});
+            return id;
         }
 
         template <typename Func, typename... Args>
-        void connectEx(unsigned int id, Func func, Args... args)
+        unsigned int connectEx(std::atomic<unsigned int>& idCounter, Func func, Args... args)
         {
-            m_functionsEx[id] = std::bind(func, args..., std::placeholders::_1);
+            const unsigned int id = idCounter++;
+            addHandler({id, nullptr, std::bind(func, args..., std::placeholders::_1), true});
+            return id;
         }
 
         bool disconnect(unsigned int id);
@@ -263,14 +276,7 @@ namespace tgui
 
         bool isEmpty() const;
 
-        void operator()(unsigned int count);
-
-        template <typename T, typename... Args>
-        void operator()(unsigned int count, const T& value, Args... args)
-        {
-            priv::data[count] = static_cast<const void*>(&value);
-            (*this)(count+1, args...);
-        }
+        bool isBound() const;
 
     protected:
 
@@ -284,25 +290,201 @@ namespace tgui
             assert(acceptedType.size() == 1);
 
             std::size_t count = 0;
-            for (std::size_t i = 0; i < m_allowedTypes.size(); ++i)
+            for (std::size_t i = 0; i < m_allowedTypes->size(); ++i)
             {
-                if (acceptedType[0] == m_allowedTypes[i])
+                if (acceptedType[0] == (*m_allowedTypes)[i])
                     return count;
 
-                count += m_allowedTypes[i].size();
+                count += (*m_allowedTypes)[i].size();
             }
 
             throw Exception{"Failed to bind parameter to callback function. Parameter is of wrong type."};
         }
 
+        // Calls all connected functions. The arguments must match the types that were passed to the constructor.
+        // Handlers may connect and disconnect functions or even destroy the signal while it is being sent.
+        // Functions that are connected while sending are only called the next time the signal is sent.
+        template <typename... Args>
+        void emit(Callback& callback, const Args&... args)
+        {
+            if (!m_connections || m_connections->handlers.empty())
+                return;
+
+            // The connections can't be accessed anymore once emission.destroyed is set
+            Connections& connections = *m_connections;
+            Emission emission{false, nullptr, nullptr};
+            startEmission(emission);
+            EmissionGuard guard{*this, emission};
+
+            // The amount of handlers does not change while sending, new handlers are stored in addedHandlers
+            const std::size_t handlerCount = connections.handlers.size();
+
+            // Legacy functions are called first
+            bool triggerSet = false;
+            for (std::size_t i = 0; i < handlerCount; ++i)
+            {
+                if (connections.handlers[i].connected && connections.handlers[i].functionEx)
+                {
+                    if (!triggerSet)
+                    {
+                        callback.trigger = m_name;
+                        triggerSet = true;
+                    }
+
+                    connections.handlers[i].functionEx(callback);
+                    if (emission.destroyed)
+                        return;
+                }
+            }
+
+            // The arguments are passed to the functions directly, the extra element avoids an array of size 0
+            const void* const arguments[sizeof...(Args) + 1] = {static_cast<const void*>(&args)..., nullptr};
+            for (std::size_t i = 0; i < handlerCount; ++i)
+            {
+                if (connections.handlers[i].connected && connections.handlers[i].function)
+                {
+                    connections.handlers[i].function(arguments);
+                    if (emission.destroyed)
+                        return;
+                }
+            }
+        }
+
     private:
 
-        std::map<unsigned int, std::function<void()>> m_functions;
-        std::map<unsigned int, std::function<void(const Callback&)>> m_functionsEx;
+        struct Handler
+        {
+            unsigned int id;
+            std::function<void(const void* const*)> function;
+            std::function<void(const Callback&)> functionEx;
+
+            // Handlers that are disconnected while the signal is being sent are only removed afterwards
+            bool connected;
+        };
 
-        std::vector<std::vector<std::string>> m_allowedTypes;
+        struct Connections;
 
-        friend class SignalWidgetBase; // Only needed for m_functionsEx
+        // Keeps track of whether the signal still exists after calling a handler.
+        // Lives on the stack of the emit function, nested emissions are linked together.
+        // When the signal is destroyed while sending, the outermost emission takes over the connections, because the
+        // function that is being executed can't be freed until it returns.
+        struct Emission
+        {
+            bool destroyed;
+            Emission* outer;
+            std::unique_ptr<Connections> orphanedConnections;
+        };
+
+        // Finishes the emission when the emit function returns, also when one of the handlers throws an exception
+        struct EmissionGuard
+        {
+            EmissionGuard(Signal& guardedSignal, Emission& guardedEmission) :
+                signal  (guardedSignal),
+                emission(guardedEmission)
+            {
+            }
+
+            EmissionGuard(const EmissionGuard&) = delete;
+            EmissionGuard& operator=(const EmissionGuard&) = delete;
+
+            ~EmissionGuard()
+            {
+                if (!emission.destroyed)
+                    signal.finishEmission();
+            }
+
+            Signal& signal;
+            Emission& emission;
+        };
+
+        // Most signals never get a function connected to them, so this is only created when the first function is connected
+        struct Connections
+        {
+            std::vector<Handler> handlers;
+            std::vector<Handler> addedHandlers;
+            bool handlersDisconnected = false;
+
+            Emission* emission = nullptr;
+        };
+
+        void addHandler(Handler&& handler);
+
+        void addConnectedHandlers(const Signal& other);
+
+        // Registers the emission with the connections. This is not done in the header so that the frame statistics
+        // only depend on how the library was built.
+        void startEmission(Emission& emission);
+
+        // Removes disconnected handlers and adds the new ones when the outermost emission finishes
+        void finishEmission();
+
+    private:
+
+        const char* m_name;
+        const std::vector<std::vector<std::string>>* m_allowedTypes;
+
+        std::unique_ptr<Connections> m_connections;
+
+        friend class SignalWidgetBase; // Only needed for the deprecated sendSignal function that takes a name
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    // Signal of which the parameter types are known at compile time.
+    // Widgets store these as members, so sending a signal does not require looking it up by name.
+    // The parameter types are shared between all signals with the same types.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... Types>
+    class TypedSignal : public Signal
+    {
+    public:
+
+        TypedSignal(const char* name) :
+            Signal{name, getTypes()}
+        {
+        }
+
+        void send(Callback& callback, const Types&... args)
+        {
+            emit(callback, args...);
+        }
+
+    private:
+
+        static const std::vector<std::vector<std::string>>& getTypes()
+        {
+            static const std::vector<std::vector<std::string>> types = priv::extractTypes<Types...>::get();
+            return types;
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    // Signal for a selected item, to which functions can be connected that take either the item or both the item and its id
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <>
+    class TypedSignal<sf::String, TypeSet<sf::String, sf::String>> : public Signal
+    {
+    public:
+
+        TypedSignal(const char* name) :
+            Signal{name, getTypes()}
+        {
+        }
+
+        void send(Callback& callback, const sf::String& item, const sf::String& id)
+        {
+            emit(callback, item, item, id);
+        }
+
+    private:
+
+        static const std::vector<std::vector<std::string>>& getTypes()
+        {
+            static const std::vector<std::vector<std::string>> types = priv::extractTypes<sf::String, TypeSet<sf::String, sf::String>>::get();
+            return types;
+        }
     };
 
 
@@ -326,7 +508,7 @@ namespace tgui
         /// @param copy  Instance to copy
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        SignalWidgetBase(const SignalWidgetBase& copy);
+        SignalWidgetBase(const SignalWidgetBase& copy) = default;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -337,7 +519,14 @@ namespace tgui
         /// @return Reference to itself
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        SignalWidgetBase& operator=(const SignalWidgetBase& right);
+        SignalWidgetBase& operator=(const SignalWidgetBase& right) = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual ~SignalWidgetBase() = default;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -357,13 +546,14 @@ namespace tgui
             if (signalNameList.empty())
                 throw Exception{"connect function called with empty string"};
 
+            unsigned int id = 0;
             for (auto& signalName : signalNameList)
             {
-                if (m_signals.find(toLower(signalName)) != m_signals.end())
+                Signal* signal = findSignal(signalName);
+                if (signal)
                 {
                     try {
-                        m_signals[toLower(signalName)]->connect(m_lastId, func, args...);
-                        m_lastId++;
+                        id = signal->connect(m_lastId, func, args...);
                     }
                     catch (const Exception& e) {
                         throw Exception{e.what() + (" The parameters are not valid for the '" + signalName + "' signal.")};
@@ -375,13 +565,13 @@ namespace tgui
                         throw Exception{"Cannot connect to unknown signal '" + signalName + "'."};
                     else
                     {
-                        assert(!m_signals.empty());
+                        auto signals = getSignals();
+                        assert(!signals.empty());
 
-                        for (auto& signal : m_signals)
+                        for (auto& otherSignal : signals)
                         {
                             try {
-                                signal.second->connect(m_lastId, func, args...);
-                                m_lastId++;
+                                id = otherSignal->connect(m_lastId, func, args...);
                             }
                             catch (const Exception& e) {
                                 throw Exception{e.what() + (" The parameters are not valid for the '" + signalName + "' signal.")};
@@ -391,7 +581,7 @@ namespace tgui
                 }
             }
 
-            return m_lastId - 1;
+            return id;
         }
 
 
@@ -414,13 +604,14 @@ namespace tgui
             if (signalNameList.empty())
                 throw Exception{"connect function called with empty string"};
 
+            unsigned int id = 0;
             for (auto& name : signalNameList)
             {
-                if (m_signals.find(toLower(name)) != m_signals.end())
+                Signal* signal = findSignal(name);
+                if (signal)
                 {
                     try {
-                        m_signals[toLower(name)]->connectEx(m_lastId, func, args...);
-                        m_lastId++;
+                        id = signal->connectEx(m_lastId, func, args...);
                     }
                     catch (const Exception& e) {
                         throw Exception{e.what() + (" since it is not valid for the '" + name + "' signal.")};
@@ -432,13 +623,13 @@ namespace tgui
                         throw Exception{"Cannot connect to unknown signal '" + name + "'."};
                     else
                     {
-                        assert(!m_signals.empty());
+                        auto signals = getSignals();
+                        assert(!signals.empty());
 
-                        for (auto& signal : m_signals)
+                        for (auto& otherSignal : signals)
                         {
                             try {
-                                signal.second->connectEx(m_lastId, func, args...);
-                                m_lastId++;
+                                id = otherSignal->connectEx(m_lastId, func, args...);
                             }
                             catch (const Exception& e) {
                                 throw Exception{e.what() + (" since it is not valid for the '" + name + "' signal.")};
@@ -448,7 +639,7 @@ namespace tgui
                 }
             }
 
-            return m_lastId - 1;
+            return id;
         }
 
 
@@ -481,49 +672,60 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns all signals of the widget. Derived classes add their own signals to the ones of their base class.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::vector<Signal*> getSignals();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Add a new signal that people can bind.
+        // Deprecated: store a TypedSignal member and add it to the result of getSignals instead. Sending a signal that was
+        // added by name requires looking it up and its arguments are not checked at compile time.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         template <typename... T>
         void addSignal(std::string&& name)
         {
-            assert(m_signals[toLower(name)] == nullptr);
-            m_signals[toLower(name)] = std::make_shared<Signal>(priv::extractTypes<T...>::get());
+            assert(findSignal(name) == nullptr);
+
+            auto info = std::make_shared<const AddedSignalInfo>(AddedSignalInfo{std::move(name), priv::extractTypes<T...>::get()});
+            m_addedSignals.push_back({info, Signal{info->name.c_str(), info->types}});
         }
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Check if some signal handler has been bound to the signal.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSignalBound(const Signal& signal) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Check if some signal handler has been bound to the signal with the given name.
+        // Deprecated: pass the signal itself instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool isSignalBound(std::string&& name);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Send a signal to all signal handlers that are connected with this signal.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        template <typename... Args>
-        void sendSignal(std::string&& name, Args... args)
+        template <typename... Types, typename... Args>
+        void sendSignal(TypedSignal<Types...>& signal, Args&&... args)
         {
-            assert(m_signals[toLower(name)] != nullptr);
-            auto& signal = *m_signals[toLower(name)];
-
-            if (signal.m_functionsEx.empty())
-            {
-                if (!signal.isEmpty())
-                    signal(0, args...);
-            }
-            else // Legacy functions are used
-            {
-                // Copy signal to avoid problems with lifetime when signal handler destroys this object
-                Signal signalCopy = signal;
+            signal.send(m_callback, std::forward<Args>(args)...);
+        }
 
-                m_callback.trigger = name;
-                for (const auto& function : signalCopy.m_functionsEx)
-                    function.second(m_callback);
 
-                if (!signalCopy.isEmpty())
-                    signalCopy(0, args...);
-            }
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Send the signal with the given name to all signal handlers that are connected with it.
+        // Deprecated: send a TypedSignal member instead. The arguments must have exactly the types of the signal.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename... Args>
+        void sendSignal(std::string&& name, Args... args)
+        {
+            Signal* signal = findSignal(name);
+            assert(signal != nullptr);
+            signal->emit(m_callback, args...);
         }
 
 
@@ -532,15 +734,34 @@ namespace tgui
 
         std::vector<std::string> extractSignalNames(std::string input);
 
+        // Returns the signal with the given name (case-insensitive), or nullptr when the widget has no such signal
+        Signal* findSignal(const std::string& signalName);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        std::map<std::string, std::shared_ptr<Signal>> m_signals;
-
-        static unsigned int m_lastId;
+        static std::atomic<unsigned int> m_lastId;
 
         Callback m_callback;
 
+    private:
+
+        // The signals only point to their name and parameter types, so these are shared between copies of the widget
+        struct AddedSignalInfo
+        {
+            std::string name;
+            std::vector<std::vector<std::string>> types;
+        };
+
+        struct AddedSignal
+        {
+            std::shared_ptr<const AddedSignalInfo> info;
+            Signal signal;
+        };
+
+        // Signals that were added with the deprecated addSignal function, getSignals returns them as well
+        std::vector<AddedSignal> m_addedSignals;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
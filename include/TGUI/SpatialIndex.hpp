@@ -0,0 +1,188 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_SPATIAL_INDEX_HPP
+#define TGUI_SPATIAL_INDEX_HPP
+
+
+#include <TGUI/Global.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <unordered_map>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    /// @brief Uniform grid that finds the widgets of a container that may be located below the mouse
+    ///
+    /// Every widget is stored in the cells that are overlapped by its mouse area. Widgets that don't have a known mouse area
+    /// (or whose area covers too many cells) are stored in a separate list and are returned for every point.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API SpatialIndex
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param cellSize  Width and height of the cells in the grid
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SpatialIndex(float cellSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width and height of the cells in the grid
+        ///
+        /// @return Size of the cells
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getCellSize() const
+        {
+            return m_cellSize;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a widget to the index
+        ///
+        /// @param widget  The widget that was added to the container
+        /// @param index   Position of the widget in the list of widgets of the container
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(const Widget* widget, std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Updates the cells in which the widget is stored after its mouse area changed
+        ///
+        /// @param widget  The widget that was moved or resized
+        ///
+        /// Nothing happens when the widget isn't part of the index.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a widget from the index
+        ///
+        /// @param widget  The widget that was removed from the container
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void remove(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets from the index
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tells the index that the order of the widgets in the container has changed
+        ///
+        /// The positions of the widgets are looked up again during the next query.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateOrder()
+        {
+            m_orderValid = false;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the widgets that may be located on a given point
+        ///
+        /// @param x        X coordinate of the point, relative to the container
+        /// @param y        Y coordinate of the point, relative to the container
+        /// @param widgets  List of widgets in the container, used to find the order of the widgets when it was invalidated
+        ///
+        /// @return Positions of the candidate widgets in the list of widgets, sorted from front to back
+        ///
+        /// The returned list is only valid until the next call to this function.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<std::size_t>& query(float x, float y, const std::vector<std::shared_ptr<Widget>>& widgets);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        struct Entry
+        {
+            std::size_t index = 0;
+            bool bounded = false;
+            int left = 0;
+            int top = 0;
+            int right = -1;
+            int bottom = -1;
+        };
+
+        // Calculates the cells that are covered by the mouse area of the widget
+        void findCells(const Widget* widget, Entry& entry) const;
+
+        // Adds or removes the widget from the cells (or from the list of unbounded widgets) that are stored in the entry
+        void addToCells(const Widget* widget, const Entry& entry);
+        void removeFromCells(const Widget* widget, const Entry& entry);
+
+        // Combines the column and row of a cell into the key of m_cells
+        static unsigned long long getCellKey(int column, int row);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        float m_cellSize;
+
+        std::unordered_map<const Widget*, Entry> m_entries;
+        std::unordered_map<unsigned long long, std::vector<const Widget*>> m_cells;
+        std::vector<const Widget*> m_unboundedWidgets;
+
+        // The stored positions of the widgets are outdated when widgets are removed or moved to the front or back
+        bool m_orderValid = true;
+
+        std::vector<std::size_t> m_candidates;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_SPATIAL_INDEX_HPP
@@ -0,0 +1,154 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TASK_QUEUE_HPP
+#define TGUI_TASK_QUEUE_HPP
+
+
+#include <TGUI/Global.hpp>
+
+#include <atomic>
+#include <functional>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Statistics about the tasks that were posted to a TaskQueue
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API TaskQueueStats
+    {
+        std::size_t queuedTasks = 0;                ///< Amount of tasks that are waiting to be executed
+        std::size_t peakQueuedTasks = 0;            ///< Highest amount of waiting tasks that was seen when starting to execute them
+        std::size_t lastExecutedTasks = 0;          ///< Amount of tasks that were executed by the last call to executeTasks
+        sf::Time lastExecutionTime;                 ///< Time spent in the last call to executeTasks that executed tasks
+        unsigned long long totalExecutedTasks = 0;  ///< Amount of tasks that were executed since the queue was created
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Queue of functions that are posted from any thread and executed on the thread that owns the queue
+    ///
+    /// Posting a task never blocks: the queue is a lock-free linked list to which every thread can add tasks,
+    /// while only a single thread executes them.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TaskQueue
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TaskQueue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor, tasks that were not executed yet are destroyed without being executed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~TaskQueue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a task to the queue
+        ///
+        /// @param task  Function that has to be executed on the thread that owns the queue
+        ///
+        /// This function can be called from any thread.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> task);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes the tasks that are in the queue, in the order in which they were posted
+        ///
+        /// @param maxTasks  Maximum amount of tasks to execute, the other tasks stay in the queue until the next call
+        ///
+        /// @return Amount of tasks that were executed
+        ///
+        /// Tasks that are posted while this function is executing tasks are left for the next call.
+        /// This function may only be called from the thread that owns the queue.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t executeTasks(std::size_t maxTasks);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the tasks in the queue
+        ///
+        /// @return Statistics about the queue
+        ///
+        /// This function may only be called from the thread that owns the queue.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TaskQueueStats getStats() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        struct Node
+        {
+            std::atomic<Node*> next{nullptr};
+            std::function<void()> task;
+        };
+
+        // Adds a node at the end of the list, can be called by multiple threads at the same time
+        void push(Node* node);
+
+        // Removes the first node from the list. Returns nullptr when the queue is empty
+        // or when the first node is still being added by another thread.
+        Node* pop();
+
+        TaskQueue(const TaskQueue&) = delete;
+        TaskQueue& operator=(const TaskQueue&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // The threads that post tasks add nodes to the back, the thread that owns the queue removes them from the front.
+        // The stub node is used to keep the list non-empty, so that adding and removing nodes never touch the same pointer.
+        std::atomic<Node*> m_back;
+        Node* m_front;
+        Node m_stub;
+
+        std::atomic<std::size_t> m_queuedTasks{0};
+
+        TaskQueueStats m_stats;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TASK_QUEUE_HPP
@@ -226,7 +226,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         sf::Vector2f getImageSize() const
         {
-            return sf::Vector2f{m_data->texture.getSize()};
+            return sf::Vector2f{m_data->getSize()};
         }
 
 
@@ -321,7 +321,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool isSmooth() const
         {
-            return m_data->texture.isSmooth();
+            return m_data->getTexture().isSmooth();
         }
 
 
@@ -0,0 +1,132 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_TEXTURE_ATLAS_HPP
+#define TGUI_TEXTURE_ATLAS_HPP
+
+
+#include <TGUI/TextureData.hpp>
+
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Statistics about the images that were packed into the texture atlas
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API TextureAtlasStats
+    {
+        std::size_t pages = 0;                ///< Amount of textures that were created to hold the images
+        std::size_t images = 0;               ///< Amount of images that are stored in the pages
+        unsigned long long usedPixels = 0;    ///< Amount of pixels in the pages that are occupied by the images
+        unsigned long long totalPixels = 0;   ///< Amount of pixels in all pages together
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    /// @brief Packs small images together in large textures
+    ///
+    /// The pages are filled with rows of images. Every image is surrounded by a border of 1 pixel that repeats the edge of
+    /// the image, so that the neighbouring images are never sampled. The space of a removed image is only reused once
+    /// all images on the same page have been removed.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextureAtlas
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds the image of the texture data to one of the pages
+        ///
+        /// @param data  Texture data with the image and the part of the image that has to be packed
+        ///
+        /// @return True when the image was packed, false when it is too large for the atlas
+        ///
+        /// On success the atlasTexture and atlasRect members of the data are set.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool add(TextureData& data);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Releases the place in the atlas that was occupied by the image of the texture data
+        ///
+        /// @param data  Texture data that was previously added to the atlas
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void remove(const TextureData& data);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the pages
+        ///
+        /// @return Amount of pages and how much of them is in use
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static TextureAtlasStats getStats();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        struct Shelf
+        {
+            unsigned int top;
+            unsigned int height;
+            unsigned int usedWidth;
+        };
+
+        struct Page
+        {
+            std::shared_ptr<sf::Texture> texture;
+            std::vector<Shelf> shelves;
+            unsigned int usedHeight = 0;
+            std::size_t images = 0;
+            unsigned long long usedPixels = 0;
+        };
+
+        // Searches a free place of the given size on the page, reserving it when found
+        static bool allocate(Page& page, unsigned int width, unsigned int height, sf::Vector2u& position);
+
+        // Returns the width and height of the pages
+        static unsigned int getPageSize();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        static std::vector<Page> m_pages;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXTURE_ATLAS_HPP
@@ -49,6 +49,25 @@ namespace tgui
         std::shared_ptr<sf::Image> image;
         sf::Texture   texture;
         sf::IntRect   rect;
+
+        // When the image was packed into a page of the texture atlas then the texture member remains empty
+        std::shared_ptr<sf::Texture> atlasTexture;
+        sf::IntRect   atlasRect;
+
+        // Returns the texture that has to be used for drawing
+        const sf::Texture& getTexture() const
+        {
+            return atlasTexture ? *atlasTexture : texture;
+        }
+
+        // Returns the size of the loaded image
+        sf::Vector2u getSize() const
+        {
+            if (atlasTexture)
+                return {static_cast<unsigned int>(atlasRect.width), static_cast<unsigned int>(atlasRect.height)};
+            else
+                return texture.getSize();
+        }
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <TGUI/TextureAtlas.hpp>
 #include <TGUI/TextureData.hpp>
 #include <TGUI/Config.hpp>
 
@@ -81,10 +82,42 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether small images are packed together in shared textures
+        ///
+        /// @param enabled  Should images that are loaded from now on be placed in the texture atlas?
+        ///
+        /// When enabled, parts of images and small images are copied to large shared textures instead of each getting their
+        /// own texture, so that widgets can be drawn without switching textures. Images that were already loaded are not moved.
+        /// The atlas is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether small images are packed together in shared textures
+        ///
+        /// @return Are loaded images placed in the texture atlas?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAtlasEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the texture atlas
+        ///
+        /// @return Amount of pages in the atlas and how much of them is filled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static TextureAtlasStats getAtlasStats();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         static std::map<std::string, std::list<TextureDataHolder>> m_imageMap;
+        static bool m_atlasEnabled;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
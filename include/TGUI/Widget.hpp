@@ -33,7 +33,9 @@
 #include <TGUI/Texture.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/Font.hpp>
+#include <TGUI/WidgetTypes.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
+#include <typeinfo>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -318,6 +320,35 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the position of the widget in the order in which the tab key focuses the widgets
+        ///
+        /// @param tabIndex  Widgets with a lower tab index are focused first
+        ///
+        /// Widgets with the same tab index are focused in the order in which they appear in the gui, which is the order in
+        /// which they were added to their parent when the widgets are in the same container.
+        /// The default tab index of all widgets is 0.
+        ///
+        /// The tab index of a container has no effect, only the tab indices of the widgets that can be focused are used.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTabIndex(int tabIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the position of the widget in the order in which the tab key focuses the widgets
+        ///
+        /// @return Tab index of the widget
+        ///
+        /// @see setTabIndex
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getTabIndex() const
+        {
+            return m_tabIndex;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the type of the widget.
         ///
@@ -330,6 +361,20 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the id of the type of the widget.
+        ///
+        /// @return Id of the widget type, which is cheaper to compare than the name returned by getWidgetType
+        ///
+        /// @see WidgetTypes
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WidgetTypeId getWidgetTypeId() const
+        {
+            return m_widgetTypeId;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns a pointer to the parent widget.
         ///
@@ -377,6 +422,20 @@ namespace tgui
         virtual void moveToBack();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tells the containers around the widget that the widget looks different than when it was last drawn
+        ///
+        /// Containers that have their render cache enabled only redraw their widgets after this function was called, and the
+        /// gui only redraws the area of the widget when partial redrawing is enabled. It is called automatically when e.g. the
+        /// position, size or visibility changes, when the mouse enters or leaves the widget, when the widget gets or loses focus,
+        /// when a renderer property is changed and when the text, items, selection or value of the widget is changed.
+        /// Other events don't invalidate the widget, so a custom widget that looks different after e.g. a mouse move, a mouse
+        /// click or a key press has to call this function itself from the event handler.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sets the tool tip that should be displayed when hovering over the widget
         ///
@@ -487,6 +546,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// This function is called every frame with the time passed since the last frame.
+        /// It is only called while the widget is visible and after it called requestUpdates, until isUpdateNeeded returns false.
+        ///
+        /// The TGUI widgets are only updated while they need it. Custom widgets are still updated every frame, like all widgets
+        /// were before, unless they set m_updatedEveryFrame to false. Such a widget then has to call requestUpdates once it is
+        /// inside a container, and either call requestUpdates again from this function or override isUpdateNeeded.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update(sf::Time elapsedTime);
 
@@ -496,6 +560,13 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool mouseOnWidget(float x, float y) const = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Gives the rectangle outside of which mouseOnWidget will always return false, relative to the parent.
+        // Returns false when the widget can't tell where it can be clicked, it will then always be checked by its parent.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool getMouseArea(sf::FloatRect& area) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -615,6 +686,56 @@ namespace tgui
         bool isDisabledBlockingMouseEvents() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the signals of the widget, used to find the signal to connect to when connecting by name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::vector<Signal*> getSignals() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that the update function gets called every frame, until isUpdateNeeded returns false.
+        // This has to be called when the widget starts something that depends on the elapsed time. It does nothing while the
+        // widget has no parent. Calling it from the update function keeps the widget updated during the next frame as well.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestUpdates();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the area in which the widget is drawn, including its borders, in the same coordinates as getAbsolutePosition.
+        // Widgets that draw outside their full size have to return an area that also contains these parts.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::FloatRect getDrawnArea() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sets the type of the widget, which is returned by getWidgetType and getWidgetTypeId.
+        // Widgets that aren't part of TGUI should call the version that takes the name, their type is registered on first use.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWidgetType(WidgetTypeId typeId);
+        void setWidgetType(const std::string& type);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the widget still has something going on that depends on the elapsed time, e.g. a running animation.
+        // The parent stops calling the update function once this function returns false after an update.
+        // The default implementation only returns true while a show or hide animation is playing.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isUpdateNeeded() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the widget is of a class outside TGUI that has to be updated every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdatedEveryFrame() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns how long it takes before an update will change how the widget looks, e.g. a caret that has to blink.
+        // Zero is returned when every update changes the widget, a huge time is returned when nothing changes by itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time timeUntilNextUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -643,9 +764,25 @@ namespace tgui
         // Can the widget be focused?
         bool m_allowFocus = false;
 
+        // Position of the widget in the order in which the widgets are focused with the tab key
+        int m_tabIndex = 0;
+
+        // Id of the widget type, it matches the name in m_callback.widgetType
+        WidgetTypeId m_widgetTypeId = WidgetTypes::Unknown;
+
+        // The TGUI class that was constructed last, the widget belongs to a class outside TGUI when its type differs from it
+        const std::type_info* m_builtInType = nullptr;
+
+        // Widgets of classes outside TGUI are updated every frame, because they may rely on it. A custom widget that calls
+        // requestUpdates itself and overrides isUpdateNeeded can set this to false. It has no effect on the TGUI widgets.
+        bool m_updatedEveryFrame = true;
+
         // Keep track of the elapsed time.
         sf::Time m_animationTimeElapsed;
 
+        // Is the widget in the list of widgets that its parent updates every frame?
+        bool m_updateRequested = false;
+
         // This is set to true for widgets that have something to be dragged around (e.g. sliders and scrollbars)
         bool m_draggableWidget = false;
 
@@ -669,10 +806,25 @@ namespace tgui
         // Show animations
         std::vector<std::shared_ptr<priv::Animation>> m_showAnimations;
 
+        // Layouts that have to be recalculated when the position or size of this widget changes
+        // The dependencies are kept in the order in which they were added, so that the layouts are always updated in the same order.
+        // Destroyed layouts only increase the counter, their entries are removed once they make up half of the list.
+        std::vector<LayoutImpl::WidgetDependency> m_layoutDependencies;
+        std::size_t m_destroyedLayoutDependencies = 0;
+
+        // Signals that are sent by all widgets
+        TypedSignal<sf::Vector2f> m_onPositionChanged{"PositionChanged"};
+        TypedSignal<sf::Vector2f> m_onSizeChanged{"SizeChanged"};
+        TypedSignal<> m_onFocused{"Focused"};
+        TypedSignal<> m_onUnfocused{"Unfocused"};
+        TypedSignal<> m_onMouseEntered{"MouseEntered"};
+        TypedSignal<> m_onMouseLeft{"MouseLeft"};
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container;
         friend class BaseTheme;
+        friend class LayoutImpl;
     };
 
 
@@ -736,6 +888,19 @@ namespace tgui
         virtual std::map<std::string, ObjectConverter> getPropertyValuePairs() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tells the widget that uses this renderer that it has to be drawn again
+        ///
+        /// Every setter of the renderer calls this function after changing the property, so that the render cache of the
+        /// containers around the widget and the damaged area of the gui are updated. Custom renderers should do the same.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateWidget();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -746,6 +911,10 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // The widget that is invalidated when a property changes, set by the widget when it is added to a container
+        Widget* m_widget = nullptr;
 
         friend class Widget;
     };
@@ -0,0 +1,124 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_WIDGET_TYPES_HPP
+#define TGUI_WIDGET_TYPES_HPP
+
+
+#include <TGUI/Global.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Number that identifies the type of a widget
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    using WidgetTypeId = unsigned int;
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Keeps track of the types of widgets that exist
+    ///
+    /// Every widget type gets a number, so that the type of a widget can be checked without comparing strings.
+    /// The types of the widgets that are part of TGUI have a fixed id, other types get an id when their name is first used.
+    /// Type names are case-insensitive.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API WidgetTypes
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ids of the widget types that are part of TGUI
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum BuiltIn : WidgetTypeId
+        {
+            Unknown,
+            Button,
+            Canvas,
+            ChatBox,
+            CheckBox,
+            ChildWindow,
+            ClickableWidget,
+            ComboBox,
+            EditBox,
+            FrameStatsOverlay,
+            Grid,
+            GuiContainer,
+            HorizontalLayout,
+            Knob,
+            Label,
+            ListBox,
+            MenuBar,
+            MessageBox,
+            Panel,
+            Picture,
+            ProgressBar,
+            RadioButton,
+            RichTextLabel,
+            Scrollbar,
+            Slider,
+            SpinButton,
+            Tab,
+            Table,
+            TableItem,
+            TableRow,
+            TextBox,
+            VerticalLayout
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the id of a widget type
+        ///
+        /// @param type  Name of the widget type
+        ///
+        /// @return Id of the type. When the name wasn't used before, the type is registered and gets a new id.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static WidgetTypeId getId(const std::string& type);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the name of a widget type
+        ///
+        /// @param id  Id of the widget type
+        ///
+        /// @return Name with which the type was registered, or "Unknown" when no type has the given id
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const std::string& getName(WidgetTypeId id);
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_WIDGET_TYPES_HPP
@@ -261,6 +261,12 @@ namespace tgui
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the signals of the widget, used to find the signal to connect to when connecting by name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::vector<Signal*> getSignals() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -270,6 +276,8 @@ namespace tgui
         // This will store the size of the text (0 to auto-size)
         unsigned int m_textSize = 0;
 
+        TypedSignal<sf::String> m_onPressed{"Pressed"};
+
         friend class ButtonRenderer;
         friend class ChildWindow;
     };
@@ -335,6 +343,16 @@ namespace tgui
         virtual std::map<std::string, ObjectConverter> getPropertyValuePairs() const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the borders.
+        ///
+        /// @param borders  The size of the borders
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setBorders(const Borders& borders) override;
+        using WidgetBorders::setBorders;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the color of the text.
         ///
@@ -529,6 +529,12 @@ namespace tgui
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the signals of the widget, used to find the signal to connect to when connecting by name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::vector<Signal*> getSignals() override;
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -566,6 +572,11 @@ namespace tgui
         bool m_resizable = false;
         int m_resizeDirection = ResizeNone;
 
+        TypedSignal<sf::Vector2f> m_onMousePressed{"MousePressed"};
+        TypedSignal<ChildWindow::Ptr> m_onClosed{"Closed"};
+        TypedSignal<ChildWindow::Ptr> m_onMinimized{"Minimized"};
+        TypedSignal<ChildWindow::Ptr> m_onMaximized{"Maximized"};
+
         friend class ChildWindowRenderer;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
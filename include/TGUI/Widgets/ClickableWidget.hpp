@@ -99,11 +99,22 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the signals of the widget, used to find the signal to connect to when connecting by name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::vector<Signal*> getSignals() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool mouseOnWidget(float x, float y) const override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool getMouseArea(sf::FloatRect& area) const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -123,6 +134,14 @@ namespace tgui
         // This function draws nothing.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        TypedSignal<sf::Vector2f> m_onMousePressed{"MousePressed"};
+        TypedSignal<sf::Vector2f> m_onMouseReleased{"MouseReleased"};
+        TypedSignal<sf::Vector2f> m_onClicked{"Clicked"};
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
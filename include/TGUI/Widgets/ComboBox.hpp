@@ -661,6 +661,12 @@ namespace tgui
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the signals of the widget, used to find the signal to connect to when connecting by name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::vector<Signal*> getSignals() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -673,6 +679,8 @@ namespace tgui
 
         Label m_text;
 
+        TypedSignal<sf::String, TypeSet<sf::String, sf::String>> m_onItemSelected{"ItemSelected"};
+
         friend class ComboBoxRenderer;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
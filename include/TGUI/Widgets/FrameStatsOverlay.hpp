@@ -0,0 +1,128 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_FRAME_STATS_OVERLAY_HPP
+#define TGUI_FRAME_STATS_OVERLAY_HPP
+
+
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/FrameStats.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Label that shows the statistics of a frame, to find out where the time of a frame goes while debugging
+    ///
+    /// The overlay never receives mouse events, so it can be placed on top of the other widgets.
+    /// The application has to pass the statistics to it after every frame:
+    /// @code
+    /// auto overlay = std::make_shared<tgui::FrameStatsOverlay>();
+    /// gui.add(overlay);
+    /// ...
+    /// gui.draw();
+    /// overlay->setFrameStats(gui.getFrameStats());
+    /// @endcode
+    ///
+    /// The statistics are only collected when TGUI was built with the TGUI_FRAME_STATS CMake option.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API FrameStatsOverlay : public Label
+    {
+    public:
+
+        typedef std::shared_ptr<FrameStatsOverlay> Ptr; ///< Shared widget pointer
+        typedef std::shared_ptr<const FrameStatsOverlay> ConstPtr; ///< Shared constant widget pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FrameStatsOverlay();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes a copy of another overlay
+        ///
+        /// @param overlay  The other overlay
+        ///
+        /// @return The new overlay
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static FrameStatsOverlay::Ptr copy(FrameStatsOverlay::ConstPtr overlay);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the statistics that are shown
+        ///
+        /// @param stats  Statistics of a frame, as returned by Gui::getFrameStats
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFrameStats(const FrameStats& stats);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the statistics that are shown
+        ///
+        /// @return Statistics that were last passed to setFrameStats
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const FrameStats& getFrameStats() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool mouseOnWidget(float x, float y) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes a copy of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual Widget::Ptr clone() const override
+        {
+            return std::make_shared<FrameStatsOverlay>(*this);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        FrameStats m_frameStats;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FRAME_STATS_OVERLAY_HPP
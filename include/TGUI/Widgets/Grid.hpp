@@ -145,6 +145,19 @@ namespace tgui
         virtual void removeAllWidgets() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets for which the predicate returns true
+        ///
+        /// @param predicate  Function that is called once for every widget, in the order in which they were added
+        ///
+        /// @return Amount of widgets that were removed
+        ///
+        /// The positions of the remaining widgets are only recalculated once.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::size_t removeIf(const std::function<bool(const Widget::Ptr&)>& predicate) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Add a widget to the grid.
         ///
@@ -226,6 +239,13 @@ namespace tgui
         void updatePositionsOfAllWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the widget from the cells of the grid, without repositioning the other widgets.
+        // Returns false when the widget wasn't part of the grid.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool removeFromGrid(const Widget::Ptr& widget);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
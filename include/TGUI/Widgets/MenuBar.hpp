@@ -288,6 +288,12 @@ namespace tgui
         void closeVisibleMenu();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the area of the menu bar together with the area below it where the menus are drawn when they are open
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::FloatRect getDrawnArea() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -322,6 +328,12 @@ namespace tgui
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the signals of the widget, used to find the signal to connect to when connecting by name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::vector<Signal*> getSignals() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -340,6 +352,8 @@ namespace tgui
 
         float m_minimumSubMenuWidth = 125;
 
+        TypedSignal<std::vector<sf::String>, sf::String> m_onMenuItemClicked{"MenuItemClicked"};
+
         friend class MenuBarRenderer;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -208,6 +208,12 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the signals of the widget, used to find the signal to connect to when connecting by name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::vector<Signal*> getSignals() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -220,6 +226,8 @@ namespace tgui
 
         unsigned int m_textSize = 16;
 
+        TypedSignal<sf::String> m_onButtonPressed{"ButtonPressed"};
+
         friend class MessageBoxRenderer;
     };
 
@@ -54,6 +54,7 @@ namespace tgui
 
         bool insert(std::size_t index, const tgui::Widget::Ptr& widget, const sf::String& widgetName = "");
         virtual void add(const tgui::Widget::Ptr& widget, const sf::String& widgetName = "") override;
+        virtual void addWidgets(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames = {}) override;
         void addRow(const std::vector<std::string>& columns);
 
         void setHeader(const tgui::TableRow::Ptr& row);
@@ -57,6 +57,7 @@ namespace tgui
 
         bool insert(std::size_t index, const tgui::Widget::Ptr& widget, TableItem::HorizontalAlign align, const sf::String& widgetName = "");
         virtual void add(const tgui::Widget::Ptr& widget, const sf::String& widgetName = "") override;
+        virtual void addWidgets(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames = {}) override;
         void add(const tgui::Widget::Ptr& widget, TableItem::HorizontalAlign align, const sf::String& widgetName = "");
         void add(const tgui::Widget::Ptr& widget, bool fixedHeight, TableItem::HorizontalAlign align = TableItem::None, const sf::String& widgetName = "");
 
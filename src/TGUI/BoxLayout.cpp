@@ -1,3 +1,4 @@
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/BoxLayout.hpp>
 #include <TGUI/Widgets/ClickableWidget.hpp>
 
@@ -45,6 +46,7 @@ namespace tgui
         {
             m_widgets.insert(m_widgets.begin() + index, widget);
             m_widgets.pop_back(); // The widget was added at the back with Container::add
+            widgetOrderChanged();
 
             m_widgetsRatio.insert(m_widgetsRatio.begin() + index, 1.f);
             m_widgetsFixedSizes.insert(m_widgetsFixedSizes.begin() + index, 0.f);
@@ -106,6 +108,69 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BoxLayout::addWidgets(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames)
+    {
+        Container::addWidgets(widgets, widgetNames);
+
+        m_widgetsRatio.resize(m_widgets.size(), 1.f);
+        m_widgetsFixedSizes.resize(m_widgets.size(), 0.f);
+        updateWidgetPositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BoxLayout::removeIf(const std::function<bool(const Widget::Ptr&)>& predicate)
+    {
+        // The ratios and fixed sizes of the remaining widgets are moved forward together with the widgets
+        std::size_t index = 0;
+        std::size_t remainingWidgets = 0;
+        const std::size_t removedWidgets = Container::removeIf([&](const Widget::Ptr& widget)
+            {
+                const bool removeWidget = predicate(widget);
+                if (!removeWidget)
+                {
+                    m_widgetsRatio[remainingWidgets] = m_widgetsRatio[index];
+                    m_widgetsFixedSizes[remainingWidgets] = m_widgetsFixedSizes[index];
+                    remainingWidgets++;
+                }
+
+                index++;
+                return removeWidget;
+            });
+
+        if (removedWidgets > 0)
+        {
+            m_widgetsRatio.resize(remainingWidgets);
+            m_widgetsFixedSizes.resize(remainingWidgets);
+            updateWidgetPositions();
+        }
+
+        return removedWidgets;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BoxLayout::reorder(const std::vector<std::size_t>& permutation)
+    {
+        Container::reorder(permutation);
+
+        std::vector<float> ratios;
+        std::vector<float> fixedSizes;
+        ratios.reserve(permutation.size());
+        fixedSizes.reserve(permutation.size());
+        for (auto index : permutation)
+        {
+            ratios.push_back(m_widgetsRatio[index]);
+            fixedSizes.push_back(m_widgetsFixedSizes[index]);
+        }
+
+        m_widgetsRatio.swap(ratios);
+        m_widgetsFixedSizes.swap(fixedSizes);
+        updateWidgetPositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr BoxLayout::get(std::size_t index)
     {
         if (index < m_widgets.size())
@@ -231,7 +296,7 @@ namespace tgui
         {
             sf::RectangleShape background(getSize());
             background.setFillColor(m_backgroundColor);
-            target.draw(background, states);
+            DrawBatcher::draw(target, background, states);
         }
 
         // Draw the widgets
@@ -0,0 +1,175 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Clipping.hpp>
+#include <TGUI/DrawBatcher.hpp>
+#include <TGUI/FrameStats.hpp>
+
+#include <SFML/OpenGL.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    void Clipping::beginDrawing(const sf::RenderTarget& target, int left, int bottom, int width, int height)
+    {
+        std::vector<Area>& areas = getAreas();
+
+        const int targetHeight = static_cast<int>(target.getSize().y);
+        areas.push_back({left, targetHeight - bottom - height, left + width, targetHeight - bottom, targetHeight, true, false});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipping::beginDrawing(sf::RenderTexture& target, const sf::IntRect& area)
+    {
+        std::vector<Area>& areas = getAreas();
+
+        // What was batched for the previous target has to be drawn before its context is deactivated
+        DrawBatcher::flush();
+
+        // The scissor box of the render texture is part of its own context, it never affects the other targets
+        target.setActive(true);
+        glEnable(GL_SCISSOR_TEST);
+
+        const int targetHeight = static_cast<int>(target.getSize().y);
+        areas.push_back({area.left, area.top, area.left + area.width, area.top + area.height, targetHeight, true, false});
+        apply(areas.back());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipping::endDrawing()
+    {
+        std::vector<Area>& areas = getAreas();
+
+        assert(!areas.empty() && areas.back().base && !areas.back().implicit);
+        areas.pop_back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipping::push(const sf::RenderTarget& target, sf::Vector2f topLeftPosition, sf::Vector2f bottomRightPosition)
+    {
+        std::vector<Area>& areas = getAreas();
+
+        // When the widget isn't drawn by a gui then the scissor box has to be read once
+        if (areas.empty())
+        {
+            GLint scissor[4];
+            glGetIntegerv(GL_SCISSOR_BOX, scissor);
+
+            beginDrawing(target, scissor[0], scissor[1], scissor[2], scissor[3]);
+            areas.back().implicit = true;
+        }
+
+        const sf::View& view = target.getView();
+
+        // Calculate the scale factor of the view
+        const float scaleViewX = target.getSize().x / view.getSize().x;
+        const float scaleViewY = target.getSize().y / view.getSize().y;
+
+        // Calculate the clipping area
+        const Area& previous = areas.back();
+        Area area;
+        area.left = std::max(static_cast<int>(topLeftPosition.x * scaleViewX), previous.left);
+        area.top = std::max(static_cast<int>(topLeftPosition.y * scaleViewY), previous.top);
+        area.right = std::min(static_cast<int>(bottomRightPosition.x * scaleViewX), previous.right);
+        area.bottom = std::min(static_cast<int>(bottomRightPosition.y * scaleViewY), previous.bottom);
+        area.targetHeight = previous.targetHeight;
+        area.base = false;
+        area.implicit = false;
+
+        // If the area lies outside the visible area then nothing should be drawn
+        if (area.right < area.left)
+            area.right = area.left;
+        if (area.bottom < area.top)
+            area.top = area.bottom;
+
+        if ((area.left != previous.left) || (area.top != previous.top) || (area.right != previous.right) || (area.bottom != previous.bottom))
+            apply(area);
+
+        areas.push_back(area);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipping::pop()
+    {
+        std::vector<Area>& areas = getAreas();
+
+        assert(!areas.empty() && !areas.back().base);
+
+        const Area area = areas.back();
+        areas.pop_back();
+
+        const Area& previous = areas.back();
+        if ((area.left != previous.left) || (area.top != previous.top) || (area.right != previous.right) || (area.bottom != previous.bottom))
+            apply(previous);
+
+        if (previous.implicit)
+            areas.pop_back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::IntRect Clipping::getArea()
+    {
+        std::vector<Area>& areas = getAreas();
+
+        if (areas.empty())
+            return {};
+
+        const Area& area = areas.back();
+        return {area.left, area.top, area.right - area.left, area.bottom - area.top};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<Clipping::Area>& Clipping::getAreas()
+    {
+        thread_local std::vector<Area> areas;
+        return areas;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipping::apply(const Area& area)
+    {
+        // Whatever was batched still has to be drawn with the previous clipping area
+        DrawBatcher::flush();
+
+        glScissor(area.left, area.targetHeight - area.bottom, area.right - area.left, area.bottom - area.top);
+        TGUI_FRAME_STATS(priv::FrameStatsCounters::add(&FrameStats::scissorChanges));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
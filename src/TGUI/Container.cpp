@@ -24,17 +24,39 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/Clipping.hpp>
+#include <TGUI/DrawBatcher.hpp>
+#include <TGUI/FrameStats.hpp>
 #include <TGUI/Widgets/ToolTip.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetSaver.hpp>
 #include <TGUI/Loading/WidgetLoader.hpp>
 
+#include <algorithm>
 #include <stack>
+#include <cmath>
 #include <cassert>
 #include <fstream>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Returns the pixels of the target in which the widget draws, the widgets are drawn relative to the transform
+    sf::IntRect getDrawnPixels(const sf::RenderTarget& target, const sf::Transform& transform, sf::FloatRect area)
+    {
+        area = transform.transformRect(area);
+
+        // One extra pixel is added on every side to include the anti-aliased edges of the widget
+        const sf::Vector2i topLeft = target.mapCoordsToPixel({area.left, area.top});
+        const sf::Vector2i bottomRight = target.mapCoordsToPixel({area.left + area.width, area.top + area.height});
+        return {std::min(topLeft.x, bottomRight.x) - 1, std::min(topLeft.y, bottomRight.y) - 1,
+                std::abs(bottomRight.x - topLeft.x) + 2, std::abs(bottomRight.y - topLeft.y) + 2};
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,8 +71,12 @@ namespace tgui
 
     Container::Container(const Container& containerToCopy) :
         Widget                   {containerToCopy},
-        m_focusedWidget          {0}
+        m_focusedWidget          {0},
+        m_spatialIndexCellSize   {containerToCopy.m_spatialIndexCellSize}
     {
+        setSpatialIndexEnabled(containerToCopy.isSpatialIndexEnabled());
+        setRenderCacheEnabled(containerToCopy.isRenderCacheEnabled());
+
         // Copy all the widgets
         for (std::size_t i = 0; i < containerToCopy.m_widgets.size(); ++i)
             add(containerToCopy.m_widgets[i]->clone(), containerToCopy.m_objName[i]);
@@ -66,11 +92,16 @@ namespace tgui
             Widget::operator=(right);
 
             m_widgetBelowMouse = nullptr;
+            m_widgetsWithMouseDown.clear();
             m_focusedWidget = 0;
 
             // Remove all the old widgets
             removeAllWidgets();
 
+            m_spatialIndexCellSize = right.m_spatialIndexCellSize;
+            setSpatialIndexEnabled(right.isSpatialIndexEnabled());
+            setRenderCacheEnabled(right.isRenderCacheEnabled());
+
             // Copy all the widgets
             for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
                 add(right.m_widgets[i]->clone(), right.m_objName[i]);
@@ -93,118 +124,310 @@ namespace tgui
 
     void Container::add(const Widget::Ptr& widgetPtr, const sf::String& widgetName)
     {
-        assert(widgetPtr != nullptr);
-
-        // Let the widget inherit our font if it did not had a font yet
-        if (!widgetPtr->getFont() && getFont())
-            widgetPtr->setFont(getFont());
-
-        widgetPtr->setParent(this);
-        m_widgets.push_back(widgetPtr);
-        m_objName.push_back(widgetName);
-
-        if (m_opacity < 1)
-            widgetPtr->setOpacity(m_opacity);
+        addToContainer(widgetPtr, widgetName, getGlobalNameIndex());
+        focusOrderChanged();
+        widgetPtr->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Container::get(const sf::String& widgetName, bool recursive) const
     {
-        for (std::size_t i = 0; i < m_objName.size(); ++i)
+        // The indices can only give the answer directly when the name belongs to a single widget,
+        // otherwise the widgets have to be checked in order to find the one that comes first.
+        if (!widgetName.isEmpty())
         {
-            if (m_objName[i] == widgetName)
+            if (recursive)
             {
-                return m_widgets[i];
+                NameIndex* globalNameIndex = getGlobalNameIndex();
+                if (globalNameIndex)
+                {
+                    const auto& widgets = globalNameIndex->find(widgetName);
+                    if (widgets.empty())
+                        return nullptr;
+
+                    if (widgets.size() == 1)
+                    {
+                        // The widget could be located outside this container
+                        for (const Container* parent = widgets[0]->getParent(); parent != nullptr; parent = parent->getParent())
+                        {
+                            if (parent == this)
+                                return widgets[0]->shared_from_this();
+                        }
+
+                        return nullptr;
+                    }
+                }
             }
-            else if (recursive && m_widgets[i]->m_containerWidget)
+            else
             {
-                Widget::Ptr widget = std::static_pointer_cast<Container>(m_widgets[i])->get(widgetName, true);
-                if (widget != nullptr)
-                    return widget;
+                const auto& widgets = m_nameIndex.find(widgetName);
+                if (widgets.empty())
+                    return nullptr;
+
+                if (widgets.size() == 1)
+                    return widgets[0]->shared_from_this();
             }
         }
 
-        return nullptr;
+        return findWidgetByName(widgetName, recursive);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Container::remove(const Widget::Ptr& widget)
     {
-        // Loop through every widget
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        const std::size_t i = getWidgetIndex(widget.get());
+        if (i == m_widgets.size())
+            return false;
+
+        if (m_widgetBelowMouse == widget)
         {
-            // Check if the pointer matches
-            if (m_widgets[i] == widget)
-            {
-                if (m_widgetBelowMouse == widget)
-                {
-                    widget->mouseNoLongerOnWidget();
-                    m_widgetBelowMouse = nullptr;
-                }
+            widget->mouseNoLongerOnWidget();
+            m_widgetBelowMouse = nullptr;
+        }
 
-                // Unfocus the widget if it was focused
-                if (m_focusedWidget == i+1)
-                    unfocusWidgets();
+        auto mouseDownIt = std::find(m_widgetsWithMouseDown.begin(), m_widgetsWithMouseDown.end(), widget);
+        if (mouseDownIt != m_widgetsWithMouseDown.end())
+            m_widgetsWithMouseDown.erase(mouseDownIt);
 
-                // Change the index of the focused widget if this is needed
-                else if (m_focusedWidget > i+1)
-                    m_focusedWidget--;
+        if (widget->m_updateRequested)
+        {
+            auto updateIt = std::find(m_widgetsToUpdate.begin(), m_widgetsToUpdate.end(), widget);
+            if (updateIt != m_widgetsToUpdate.end())
+                m_widgetsToUpdate.erase(updateIt);
 
-                // Remove the widget
-                widget->setParent(nullptr);
-                m_widgets.erase(m_widgets.begin() + i);
-                m_objName.erase(m_objName.begin() + i);
-                return true;
-            }
+            widget->m_updateRequested = false;
         }
 
-        return false;
+        // Unfocus the widget if it was focused
+        if (m_focusedWidget == i+1)
+            unfocusWidgets();
+
+        // Change the index of the focused widget if this is needed
+        else if (m_focusedWidget > i+1)
+            m_focusedWidget--;
+
+        if (m_spatialIndex)
+            m_spatialIndex->remove(widget.get());
+
+        m_nameIndex.remove(m_objName[i], widget.get());
+
+        NameIndex* globalNameIndex = getGlobalNameIndex();
+        if (globalNameIndex)
+            removeFromNameIndex(*globalNameIndex, widget, m_objName[i]);
+
+        // Remove the widget
+        widget->invalidate();
+        widget->setParent(nullptr);
+        m_widgets.erase(m_widgets.begin() + i);
+        m_objName.erase(m_objName.begin() + i);
+        widgetOrderChanged();
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::removeAllWidgets()
     {
-        for (auto& widget : m_widgets)
-            widget->setParent(nullptr);
+        NameIndex* globalNameIndex = getGlobalNameIndex();
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            if (globalNameIndex)
+                removeFromNameIndex(*globalNameIndex, m_widgets[i], m_objName[i]);
+
+            m_widgets[i]->m_updateRequested = false;
+            m_widgets[i]->setParent(nullptr);
+        }
 
         // Clear the lists
         m_widgets.clear();
         m_objName.clear();
 
+        if (m_spatialIndex)
+            m_spatialIndex->clear();
+
+        m_nameIndex.clear();
+        m_widgetIndices.clear();
+        m_widgetIndicesValid = true;
+
         m_widgetBelowMouse = nullptr;
+        m_widgetsWithMouseDown.clear();
+        m_widgetsToUpdate.clear();
         m_focusedWidget = 0;
+
+        focusOrderChanged();
+        widgetInvalidated(getDrawnArea());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Container::setWidgetName(const Widget::Ptr& widget, const std::string& name)
+    void Container::addWidgets(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames)
     {
+        if (!widgetNames.empty() && (widgetNames.size() != widgets.size()))
+            throw Exception{"The amount of widget names passed to addWidgets has to be the same as the amount of widgets."};
+
+        m_widgets.reserve(m_widgets.size() + widgets.size());
+        m_objName.reserve(m_objName.size() + widgets.size());
+
+        NameIndex* globalNameIndex = getGlobalNameIndex();
+        for (std::size_t i = 0; i < widgets.size(); ++i)
+            addToContainer(widgets[i], widgetNames.empty() ? sf::String{} : widgetNames[i], globalNameIndex);
+
+        focusOrderChanged();
+
+        for (auto& widget : widgets)
+            widget->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Container::removeIf(const std::function<bool(const Widget::Ptr&)>& predicate)
+    {
+        const Widget::Ptr focusedWidget = m_focusedWidget ? m_widgets[m_focusedWidget-1] : nullptr;
+        Widget::Ptr widgetBelowMouse = nullptr;
+        bool focusedWidgetRemoved = false;
+
+        NameIndex* globalNameIndex = getGlobalNameIndex();
+
+        // The remaining widgets are moved forward over the removed ones
+        std::size_t remainingWidgets = 0;
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
-            if (m_widgets[i] == widget)
+            if (!predicate(m_widgets[i]))
             {
-                m_objName[i] = name;
-                return true;
+                if (remainingWidgets != i)
+                {
+                    m_widgets[remainingWidgets] = std::move(m_widgets[i]);
+                    m_objName[remainingWidgets] = std::move(m_objName[i]);
+                }
+
+                if (m_widgets[remainingWidgets] == focusedWidget)
+                    m_focusedWidget = remainingWidgets + 1;
+
+                remainingWidgets++;
+                continue;
             }
+
+            const Widget::Ptr& widget = m_widgets[i];
+            if (widget == m_widgetBelowMouse)
+                widgetBelowMouse = widget;
+            if (widget == focusedWidget)
+                focusedWidgetRemoved = true;
+
+            if (m_spatialIndex)
+                m_spatialIndex->remove(widget.get());
+
+            m_nameIndex.remove(m_objName[i], widget.get());
+            if (globalNameIndex)
+                removeFromNameIndex(*globalNameIndex, widget, m_objName[i]);
+
+            widget->m_updateRequested = false;
+            widget->invalidate();
+            widget->setParent(nullptr);
         }
 
-        return false;
+        const std::size_t removedWidgets = m_widgets.size() - remainingWidgets;
+        if (removedWidgets == 0)
+            return 0;
+
+        m_widgets.resize(remainingWidgets);
+        m_objName.resize(remainingWidgets);
+
+        // The widgets that were removed no longer have this container as parent
+        auto notInContainer = [this](const Widget::Ptr& widget){ return widget->m_parent != this; };
+        m_widgetsWithMouseDown.erase(std::remove_if(m_widgetsWithMouseDown.begin(), m_widgetsWithMouseDown.end(), notInContainer), m_widgetsWithMouseDown.end());
+        m_widgetsToUpdate.erase(std::remove_if(m_widgetsToUpdate.begin(), m_widgetsToUpdate.end(), notInContainer), m_widgetsToUpdate.end());
+
+        widgetOrderChanged();
+
+        // The removed widgets are only informed once the container is in a valid state again
+        if (widgetBelowMouse)
+        {
+            m_widgetBelowMouse = nullptr;
+            widgetBelowMouse->mouseNoLongerOnWidget();
+        }
+
+        if (focusedWidgetRemoved)
+        {
+            m_focusedWidget = 0;
+            focusedWidget->m_focused = false;
+            focusedWidget->widgetUnfocused();
+        }
+
+        return removedWidgets;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::string Container::getWidgetName(const Widget::Ptr& widget) const
+    void Container::reorder(const std::vector<std::size_t>& permutation)
     {
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        if (permutation.size() != m_widgets.size())
+            throw Exception{"The permutation passed to reorder has to contain the index of every widget exactly once."};
+
+        std::vector<bool> indexUsed(m_widgets.size(), false);
+        for (auto index : permutation)
         {
-            if (m_widgets[i] == widget)
-                return m_objName[i];
+            if ((index >= m_widgets.size()) || indexUsed[index])
+                throw Exception{"The permutation passed to reorder has to contain the index of every widget exactly once."};
+
+            indexUsed[index] = true;
         }
 
-        return "";
+        std::vector<Widget::Ptr> widgets;
+        std::vector<sf::String> widgetNames;
+        widgets.reserve(m_widgets.size());
+        widgetNames.reserve(m_objName.size());
+
+        std::size_t focusedWidget = 0;
+        for (std::size_t i = 0; i < permutation.size(); ++i)
+        {
+            if (m_focusedWidget == permutation[i] + 1)
+                focusedWidget = i + 1;
+
+            widgets.push_back(std::move(m_widgets[permutation[i]]));
+            widgetNames.push_back(std::move(m_objName[permutation[i]]));
+        }
+
+        m_widgets.swap(widgets);
+        m_objName.swap(widgetNames);
+        m_focusedWidget = focusedWidget;
+
+        widgetOrderChanged();
+        widgetInvalidated(getDrawnArea());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::setWidgetName(const Widget::Ptr& widget, const std::string& name)
+    {
+        const std::size_t index = getWidgetIndex(widget.get());
+        if (index == m_widgets.size())
+            return false;
+
+        m_nameIndex.remove(m_objName[index], widget.get());
+        m_nameIndex.insert(name, widget.get());
+
+        NameIndex* globalNameIndex = getGlobalNameIndex();
+        if (globalNameIndex)
+        {
+            globalNameIndex->remove(m_objName[index], widget.get());
+            globalNameIndex->insert(name, widget.get());
+        }
+
+        m_objName[index] = name;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string Container::getWidgetName(const Widget::Ptr& widget) const
+    {
+        const std::size_t index = getWidgetIndex(widget.get());
+        if (index == m_widgets.size())
+            return "";
+
+        return m_objName[index];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -219,33 +442,28 @@ namespace tgui
     /// TODO: Remove this function and move its contents to the focusWidget function above (requires change in Widget::focus)
     void Container::focusWidget(Widget *const widget)
     {
-        // Loop all the widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        // Search for the widget that has to be focused
+        const std::size_t i = getWidgetIndex(widget);
+        if (i == m_widgets.size())
+            return;
+
+        // Only continue when the widget wasn't already focused
+        if (m_focusedWidget != i+1)
         {
-            // Search for the widget that has to be focused
-            if (m_widgets[i].get() == widget)
+            // Unfocus the currently focused widget
+            if (m_focusedWidget)
             {
-                // Only continue when the widget wasn't already focused
-                if (m_focusedWidget != i+1)
-                {
-                    // Unfocus the currently focused widget
-                    if (m_focusedWidget)
-                    {
-                        m_widgets[m_focusedWidget-1]->m_focused = false;
-                        m_widgets[m_focusedWidget-1]->widgetUnfocused();
-                        m_focusedWidget = 0;
-                    }
-
-                    // Focus the new widget
-                    if (widget->isEnabled())
-                    {
-                        m_focusedWidget = i+1;
-                        widget->m_focused = true;
-                        widget->widgetFocused();
-                    }
-                }
+                m_widgets[m_focusedWidget-1]->m_focused = false;
+                m_widgets[m_focusedWidget-1]->widgetUnfocused();
+                m_focusedWidget = 0;
+            }
 
-                break;
+            // Focus the new widget
+            if (widget->isEnabled())
+            {
+                m_focusedWidget = i+1;
+                widget->m_focused = true;
+                widget->widgetFocused();
             }
         }
     }
@@ -381,7 +599,7 @@ namespace tgui
         // Loop through all radio buttons and uncheck them
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
-            if (m_widgets[i]->m_callback.widgetType == "RadioButton")
+            if (m_widgets[i]->m_widgetTypeId == WidgetTypes::RadioButton)
                 std::static_pointer_cast<RadioButton>(m_widgets[i])->uncheck();
         }
     }
@@ -536,9 +754,7 @@ namespace tgui
     void Container::mouseNoLongerDown()
     {
         Widget::mouseNoLongerDown();
-
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-            m_widgets[i]->mouseNoLongerDown();
+        mouseNoLongerDownOnWidgets();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -575,62 +791,109 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::moveWidgetToFront(Widget *const widget)
+    void Container::widgetMouseAreaChanged(Widget* widget)
     {
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            // Check if the widget is found
-            if (m_widgets[i].get() == widget)
-            {
-                // Copy the widget
-                m_widgets.push_back(m_widgets[i]);
-                m_objName.push_back(m_objName[i]);
+        if (m_spatialIndex)
+            m_spatialIndex->update(widget);
+    }
 
-                // Focus the correct widget
-                if ((m_focusedWidget == 0) || (m_focusedWidget == i+1))
-                    m_focusedWidget = m_widgets.size()-1;
-                else if (m_focusedWidget > i+1)
-                    --m_focusedWidget;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                // Remove the old widget
-                m_widgets.erase(m_widgets.begin() + i);
-                m_objName.erase(m_objName.begin() + i);
+    void Container::focusOrderChanged()
+    {
+        Container* root = this;
+        while (root->m_parent)
+            root = root->m_parent;
 
-                break;
-            }
-        }
+        if (root->m_focusChain)
+            root->m_focusChain->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::moveWidgetToFront(Widget *const widget)
+    {
+        const std::size_t i = getWidgetIndex(widget);
+        if (i == m_widgets.size())
+            return;
+
+        // The widgets behind it move one place forward, instead of erasing and inserting the widget
+        std::rotate(m_widgets.begin() + i, m_widgets.begin() + i + 1, m_widgets.end());
+        std::rotate(m_objName.begin() + i, m_objName.begin() + i + 1, m_objName.end());
+
+        // Focus the correct widget
+        if ((m_focusedWidget == 0) || (m_focusedWidget == i+1))
+            m_focusedWidget = m_widgets.size();
+        else if (m_focusedWidget > i+1)
+            --m_focusedWidget;
+
+        widgetOrderChanged();
+        widget->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::moveWidgetToBack(Widget *const widget)
     {
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            // Check if the widget is found
-            if (m_widgets[i].get() == widget)
-            {
-                // Copy the widget
-                Widget::Ptr obj = m_widgets[i];
-                std::string name = m_objName[i];
-                m_widgets.insert(m_widgets.begin(), obj);
-                m_objName.insert(m_objName.begin(), name);
-
-                // Focus the correct widget
-                if (m_focusedWidget == i + 1)
-                    m_focusedWidget = 1;
-                else if (m_focusedWidget)
-                    ++m_focusedWidget;
-
-                // Remove the old widget
-                m_widgets.erase(m_widgets.begin() + i + 1);
-                m_objName.erase(m_objName.begin() + i + 1);
+        const std::size_t i = getWidgetIndex(widget);
+        if (i == m_widgets.size())
+            return;
+
+        // The widgets in front of it move one place backward, instead of erasing and inserting the widget
+        std::rotate(m_widgets.begin(), m_widgets.begin() + i, m_widgets.begin() + i + 1);
+        std::rotate(m_objName.begin(), m_objName.begin() + i, m_objName.begin() + i + 1);
+
+        // Focus the correct widget
+        if (m_focusedWidget == i + 1)
+            m_focusedWidget = 1;
+        else if ((m_focusedWidget != 0) && (m_focusedWidget < i + 1))
+            ++m_focusedWidget;
+
+        widgetOrderChanged();
+        widget->invalidate();
+    }
 
-                break;
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setSpatialIndexEnabled(bool enabled)
+    {
+        if (!enabled)
+        {
+            m_spatialIndex = nullptr;
+            return;
         }
+
+        m_spatialIndex = std::unique_ptr<SpatialIndex>(new SpatialIndex{m_spatialIndexCellSize});
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+            m_spatialIndex->insert(m_widgets[i].get(), i);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setSpatialIndexCellSize(float cellSize)
+    {
+        if (cellSize <= 0)
+            throw Exception{"The cell size of the spatial index has to be positive."};
+
+        m_spatialIndexCellSize = cellSize;
+
+        // The index has to be rebuilt with the new cell size
+        if (m_spatialIndex)
+            setSpatialIndexEnabled(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setRenderCacheEnabled(bool enabled)
+    {
+        if (enabled && !m_renderCacheEnabled)
+            m_renderCacheStats = {};
+
+        m_renderCacheEnabled = enabled;
+        m_renderCacheValid = false;
+
+        if (!enabled)
+            m_renderCache = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -639,19 +902,79 @@ namespace tgui
     {
         Widget::update(elapsedTime);
 
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        // Widgets that request updates while the others are being updated are added to the emptied list again
+        m_updatingWidgets.swap(m_widgetsToUpdate);
+        for (auto& widget : m_updatingWidgets)
         {
-            // Update the elapsed time in widgets that need it
-            if (m_widgets[i]->isVisible())
-                m_widgets[i]->update(elapsedTime);
+            // The widget may have been removed by one of the widgets that were updated before it
+            if (widget->m_parent != this)
+                continue;
+
+            widget->m_updateRequested = false;
+
+            // Hidden widgets are not updated, they request updates again when they are shown
+            if (!widget->m_visible)
+                continue;
+
+            widget->update(elapsedTime);
+            TGUI_FRAME_STATS(priv::FrameStatsCounters::add(&FrameStats::updateCalls));
+
+            if ((widget->m_parent == this) && (widget->isUpdatedEveryFrame() || widget->isUpdateNeeded()))
+                widgetNeedsUpdates(widget.get());
         }
+        m_updatingWidgets.clear();
 
         m_animationTimeElapsed = {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Container::isUpdateNeeded() const
+    {
+        return !m_widgetsToUpdate.empty() || Widget::isUpdateNeeded();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Container::timeUntilNextUpdate() const
+    {
+        // Only the widgets that requested updates can change without receiving an event
+        sf::Time time = Widget::timeUntilNextUpdate();
+        for (const auto& widget : m_widgetsToUpdate)
+        {
+            if ((widget->m_parent == this) && widget->m_visible)
+                time = std::min(time, widget->timeUntilNextUpdate());
+        }
+
+        return time;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::widgetNeedsUpdates(Widget* widget)
+    {
+        if (widget->m_updateRequested || !widget->m_visible)
+            return;
+
+        widget->m_updateRequested = true;
+        m_widgetsToUpdate.push_back(widget->shared_from_this());
+
+        requestUpdates();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::widgetInvalidated(const sf::FloatRect& area)
+    {
+        m_renderCacheValid = false;
+
+        // The cached images of the containers around this one also contain the widget
+        if (m_parent)
+            m_parent->widgetInvalidated(area);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::handleEvent(sf::Event& event)
     {
         // Check if a mouse button has moved
@@ -660,18 +983,15 @@ namespace tgui
             float mouseX = (event.type == sf::Event::MouseMoved) ? static_cast<float>(event.mouseMove.x) : static_cast<float>(event.touch.x);
             float mouseY = (event.type == sf::Event::MouseMoved) ? static_cast<float>(event.mouseMove.y) : static_cast<float>(event.touch.y);
 
-            // Loop through all widgets
-            for (std::size_t i = 0; i < m_widgets.size(); ++i)
+            // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
+            // Only the widget on which the mouse went down last can be dragged.
+            if (!m_widgetsWithMouseDown.empty())
             {
-                // Check if the mouse went down on the widget
-                if (m_widgets[i]->m_mouseDown)
+                const Widget::Ptr& widget = m_widgetsWithMouseDown.back();
+                if (widget->m_mouseDown && (widget->m_draggableWidget || widget->m_containerWidget))
                 {
-                    // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
-                    if ((m_widgets[i]->m_draggableWidget) || (m_widgets[i]->m_containerWidget))
-                    {
-                        m_widgets[i]->mouseMoved(mouseX, mouseY);
-                        return true;
-                    }
+                    widget->mouseMoved(mouseX, mouseY);
+                    return true;
                 }
             }
 
@@ -713,6 +1033,12 @@ namespace tgui
                     }
                 }
 
+                // Remember the widget so that it can be dragged and so that it can be told when the mouse is released
+                auto mouseDownIt = std::find(m_widgetsWithMouseDown.begin(), m_widgetsWithMouseDown.end(), widget);
+                if (mouseDownIt != m_widgetsWithMouseDown.end())
+                    m_widgetsWithMouseDown.erase(mouseDownIt);
+                m_widgetsWithMouseDown.push_back(widget);
+
                 widget->leftMousePressed(mouseX, mouseY);
                 return true;
             }
@@ -732,16 +1058,15 @@ namespace tgui
             // Check if the mouse is on top of a widget
             Widget::Ptr widgetBelowMouse = mouseOnWhichWidget(mouseX, mouseY);
             if (widgetBelowMouse != nullptr)
+            {
                 widgetBelowMouse->leftMouseReleased(mouseX, mouseY);
+            }
 
-            // Tell all widgets that the mouse has gone up
+            // Tell the widgets on which the mouse went down that the mouse has gone up
             // But don't do this when leftMouseReleased was called on this container because
             // it will happen afterwards when mouseNoLongerDown is called on it
             if (!m_handingMouseReleased)
-            {
-                for (auto& widget : m_widgets)
-                    widget->mouseNoLongerDown();
-            }
+                mouseNoLongerDownOnWidgets();
 
             if (widgetBelowMouse != nullptr)
                 return true;
@@ -779,7 +1104,13 @@ namespace tgui
         {
             // Change the focus to another widget when the tab key was pressed
             if (event.key.code == sf::Keyboard::Tab)
-                return tabKeyPressed();
+            {
+                // Only the focus chain can find the previous widget in the whole widget tree
+                if (event.key.shift && m_focusChain && TGUI_TabKeyUsageEnabled)
+                    return moveFocusInChain(false);
+                else
+                    return tabKeyPressed();
+            }
             else
                 return false;
         }
@@ -874,6 +1205,10 @@ namespace tgui
         if (!TGUI_TabKeyUsageEnabled)
             return false;
 
+        // The container of the gui doesn't have to search through the widget tree
+        if (m_focusChain)
+            return moveFocusInChain(true);
+
         // Check if a container is focused
         if (m_focusedWidget)
         {
@@ -947,26 +1282,150 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::addToContainer(const Widget::Ptr& widgetPtr, const sf::String& widgetName, NameIndex* globalNameIndex)
+    {
+        assert(widgetPtr != nullptr);
+
+        // Let the widget inherit our font if it did not had a font yet
+        if (!widgetPtr->getFont() && getFont())
+            widgetPtr->setFont(getFont());
+
+        widgetPtr->setParent(this);
+        m_widgets.push_back(widgetPtr);
+        m_objName.push_back(widgetName);
+
+        if (m_spatialIndex)
+            m_spatialIndex->insert(widgetPtr.get(), m_widgets.size()-1);
+
+        m_nameIndex.insert(widgetName, widgetPtr.get());
+        if (m_widgetIndicesValid)
+            m_widgetIndices[widgetPtr.get()] = m_widgets.size()-1;
+
+        if (globalNameIndex)
+            addToNameIndex(*globalNameIndex, widgetPtr, widgetName);
+
+        if (m_opacity < 1)
+            widgetPtr->setOpacity(m_opacity);
+
+        if (widgetPtr->isUpdatedEveryFrame() || widgetPtr->isUpdateNeeded())
+            widgetNeedsUpdates(widgetPtr.get());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::moveFocusInChain(bool forward)
+    {
+        assert(m_focusChain != nullptr);
+
+        if (!m_focusChain->isValid())
+        {
+            m_focusChain->clear();
+            addToFocusChain(*m_focusChain, *this);
+            m_focusChain->finish();
+        }
+
+        Widget* focusedWidget = getDeepestFocusedWidget();
+        Widget* widget = forward ? m_focusChain->getNext(focusedWidget) : m_focusChain->getPrevious(focusedWidget);
+        if (!widget || (widget == focusedWidget))
+            return false;
+
+        focusWidgetInTree(widget);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addToFocusChain(FocusChain& chain, const Container& container)
+    {
+        for (auto& widget : container.m_widgets)
+        {
+            // Widgets inside hidden or disabled containers can't be focused either
+            if (!widget->m_allowFocus || !widget->m_visible || !widget->m_enabled)
+                continue;
+
+            // Containers themselves are skipped, the focus moves directly to the widgets inside them
+            if (widget->m_containerWidget)
+                addToFocusChain(chain, static_cast<const Container&>(*widget));
+            else
+                chain.add(widget.get());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget* Container::getDeepestFocusedWidget() const
+    {
+        Widget* focusedWidget = nullptr;
+
+        const Container* container = this;
+        while (container->m_focusedWidget)
+        {
+            focusedWidget = container->m_widgets[container->m_focusedWidget-1].get();
+            if (!focusedWidget->m_containerWidget)
+                break;
+
+            container = static_cast<const Container*>(focusedWidget);
+        }
+
+        return focusedWidget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::focusWidgetInTree(Widget* widget)
+    {
+        // The parents have to be focused first, focusing a widget in another container unfocuses the widgets in the old one
+        Container* parent = widget->m_parent;
+        if (parent != this)
+            focusWidgetInTree(parent);
+
+        parent->focusWidget(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr Container::mouseOnWhichWidget(float x, float y)
     {
         Widget::Ptr widget = nullptr;
-        for (std::vector<Widget::Ptr>::reverse_iterator it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
-        {
-            if ((*it)->isVisible())
+
+        // Returns true when the search has to stop, either because the widget was found or because a disabled widget blocks the mouse
+        auto checkWidget = [&widget,x,y](const Widget::Ptr& child)
             {
-                if ((*it)->mouseOnWidget(x, y))
+                if (child->isVisible())
                 {
-                    if ((*it)->isEnabled())
+                    if (child->mouseOnWidget(x, y))
                     {
-                        widget = *it;
-                        break;
-                    }
-                    else // The widget is disabled
-                    {
-                        if ((*it)->isDisabledBlockingMouseEvents())
-                            break;
+                        if (child->isEnabled())
+                        {
+                            widget = child;
+                            return true;
+                        }
+                        else // The widget is disabled
+                        {
+                            if (child->isDisabledBlockingMouseEvents())
+                                return true;
+                        }
                     }
                 }
+
+                return false;
+            };
+
+        if (m_spatialIndex)
+        {
+            // Only the widgets that overlap the point can be below the mouse, the index returns them from front to back
+            for (auto index : m_spatialIndex->query(x, y, m_widgets))
+            {
+                if (checkWidget(m_widgets[index]))
+                    break;
+            }
+        }
+        else
+        {
+            for (std::vector<Widget::Ptr>::reverse_iterator it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
+            {
+                if (checkWidget(*it))
+                    break;
             }
         }
 
@@ -980,14 +1439,218 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::mouseNoLongerDownOnWidgets()
+    {
+        // The list is moved out first, because the widgets could add or remove widgets from this container
+        std::vector<Widget::Ptr> widgets;
+        widgets.swap(m_widgetsWithMouseDown);
+
+        for (auto& widget : widgets)
+            widget->mouseNoLongerDown();
+
+        // The widget on which the mouse went down last is also told about the next time the mouse goes up, even when the mouse
+        // goes down on another widget in between. A menu bar e.g. has to close its open menu when something else was clicked.
+        if (!widgets.empty() && m_widgetsWithMouseDown.empty() && (widgets.back()->getParent() == this))
+            m_widgetsWithMouseDown.push_back(widgets.back());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Container::findWidgetByName(const sf::String& widgetName, bool recursive) const
+    {
+        for (std::size_t i = 0; i < m_objName.size(); ++i)
+        {
+            if (m_objName[i] == widgetName)
+            {
+                return m_widgets[i];
+            }
+            else if (recursive && m_widgets[i]->m_containerWidget)
+            {
+                Widget::Ptr widget = std::static_pointer_cast<Container>(m_widgets[i])->findWidgetByName(widgetName, true);
+                if (widget != nullptr)
+                    return widget;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Container::getWidgetIndex(const Widget* widget) const
+    {
+        if (!m_widgetIndicesValid)
+        {
+            m_widgetIndices.clear();
+            for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                m_widgetIndices[m_widgets[i].get()] = i;
+
+            m_widgetIndicesValid = true;
+        }
+
+        auto it = m_widgetIndices.find(widget);
+        if (it != m_widgetIndices.end())
+            return it->second;
+        else
+            return m_widgets.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::widgetOrderChanged()
+    {
+        m_widgetIndicesValid = false;
+
+        if (m_spatialIndex)
+            m_spatialIndex->invalidateOrder();
+
+        focusOrderChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setGlobalNameIndexEnabled(bool enabled)
+    {
+        if (!enabled)
+        {
+            m_globalNameIndex = nullptr;
+            return;
+        }
+
+        if (m_globalNameIndex)
+            return;
+
+        m_globalNameIndex = std::unique_ptr<NameIndex>(new NameIndex);
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+            addToNameIndex(*m_globalNameIndex, m_widgets[i], m_objName[i]);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    NameIndex* Container::getGlobalNameIndex() const
+    {
+        const Container* root = this;
+        while (root->m_parent)
+            root = root->m_parent;
+
+        return root->m_globalNameIndex.get();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addToNameIndex(NameIndex& index, const Widget::Ptr& widget, const sf::String& widgetName)
+    {
+        index.insert(widgetName, widget.get());
+
+        if (widget->m_containerWidget)
+        {
+            Container* container = static_cast<Container*>(widget.get());
+            for (std::size_t i = 0; i < container->m_widgets.size(); ++i)
+                addToNameIndex(index, container->m_widgets[i], container->m_objName[i]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeFromNameIndex(NameIndex& index, const Widget::Ptr& widget, const sf::String& widgetName)
+    {
+        index.remove(widgetName, widget.get());
+
+        if (widget->m_containerWidget)
+        {
+            Container* container = static_cast<Container*>(widget.get());
+            for (std::size_t i = 0; i < container->m_widgets.size(); ++i)
+                removeFromNameIndex(index, container->m_widgets[i], container->m_objName[i]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
+        // The geometry of the widgets is batched until the outer container finishes drawing
+        DrawBatcher::beginDrawing();
+
         // Draw all widgets when they are visible
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        auto drawWidgets = [this,&states](sf::RenderTarget& widgetTarget)
+            {
+                // Widgets outside the clipping area are skipped. Nothing is skipped when the area is unknown,
+                // e.g. when the container is drawn directly on a window instead of by a gui.
+                const sf::IntRect clippingArea = Clipping::getArea();
+                const bool cullingPossible = (clippingArea != sf::IntRect{});
+
+                for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                {
+                    const Widget& widget = *m_widgets[i];
+                    if (!widget.m_visible)
+                        continue;
+
+                    if (cullingPossible)
+                    {
+                        // The drawn area uses absolute coordinates while the widget is drawn relative to this container
+                        sf::FloatRect area = widget.getDrawnArea();
+                        area.left += widget.getPosition().x - widget.getAbsolutePosition().x;
+                        area.top += widget.getPosition().y - widget.getAbsolutePosition().y;
+
+                        if (!getDrawnPixels(widgetTarget, states.transform, area).intersects(clippingArea))
+                        {
+                            TGUI_FRAME_STATS(priv::FrameStatsCounters::add(&FrameStats::widgetsCulled));
+                            continue;
+                        }
+                    }
+
+                    widget.draw(widgetTarget, states);
+                    TGUI_FRAME_STATS(priv::FrameStatsCounters::add(&FrameStats::widgetsDrawn));
+                }
+            };
+
+        const sf::Vector2u cacheSize{static_cast<unsigned int>(std::ceil(getSize().x)), static_cast<unsigned int>(std::ceil(getSize().y))};
+        if (!m_renderCacheEnabled || (cacheSize.x == 0) || (cacheSize.y == 0))
         {
-            if (m_widgets[i]->m_visible)
-                m_widgets[i]->draw(*target, states);
+            drawWidgets(*target);
+            DrawBatcher::endDrawing();
+            return;
         }
+
+        if (!m_renderCache || (m_renderCache->getSize() != cacheSize))
+        {
+            m_renderCache = std::unique_ptr<sf::RenderTexture>(new sf::RenderTexture);
+            if (!m_renderCache->create(cacheSize.x, cacheSize.y))
+                throw Exception{"Failed to create the render texture for the render cache of the container."};
+
+            m_renderCacheValid = false;
+        }
+
+        if (m_renderCacheValid)
+            m_renderCacheStats.hits++;
+        else
+        {
+            // The view of the cache starts where the widgets start, so the widgets are drawn at the same place as
+            // on the target and can calculate their clipping areas in the same way
+            const sf::Vector2f origin = states.transform.transformPoint({0, 0});
+            Clipping::beginDrawing(*m_renderCache, {0, 0, static_cast<int>(cacheSize.x), static_cast<int>(cacheSize.y)});
+            m_renderCache->clear(sf::Color::Transparent);
+            m_renderCache->setView(sf::View{{origin.x, origin.y, static_cast<float>(cacheSize.x), static_cast<float>(cacheSize.y)}});
+
+            drawWidgets(*m_renderCache);
+
+            DrawBatcher::flush();
+            Clipping::endDrawing();
+            m_renderCache->display();
+
+            m_renderCacheValid = true;
+            m_renderCacheStats.redraws++;
+        }
+
+        // The colors in the cache were already blended with the transparent background, so they may not be multiplied
+        // with their alpha value again
+        sf::RenderStates cacheStates = states;
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 3)
+        cacheStates.blendMode = sf::BlendMode{sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha};
+    #endif
+        DrawBatcher::draw(*target, sf::Sprite{m_renderCache->getTexture()}, cacheStates);
+
+        DrawBatcher::endDrawing();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -995,7 +1658,8 @@ namespace tgui
 
     GuiContainer::GuiContainer()
     {
-        m_callback.widgetType = "GuiContainer";
+        setWidgetType(WidgetTypes::GuiContainer);
+        m_focusChain = std::unique_ptr<FocusChain>(new FocusChain);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1018,6 +1682,36 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::widgetInvalidated(const sf::FloatRect& area)
+    {
+        Container::widgetInvalidated(area);
+
+        if ((area.width <= 0) || (area.height <= 0))
+            return;
+
+        // The widgets are drawn relative to the view, while their absolute position includes the position of the view
+        m_damagedAreas.push_back({area.left - getPosition().x, area.top - getPosition().y, area.width, area.height});
+
+        // When many widgets change between two frames then the list is reduced to a single area that contains all of them
+        if (m_damagedAreas.size() > 64)
+        {
+            sf::FloatRect bounds = m_damagedAreas.front();
+            for (const auto& damagedArea : m_damagedAreas)
+            {
+                const float right = std::max(bounds.left + bounds.width, damagedArea.left + damagedArea.width);
+                const float bottom = std::max(bounds.top + bounds.height, damagedArea.top + damagedArea.height);
+                bounds.left = std::min(bounds.left, damagedArea.left);
+                bounds.top = std::min(bounds.top, damagedArea.top);
+                bounds.width = right - bounds.left;
+                bounds.height = bottom - bounds.top;
+            }
+
+            m_damagedAreas.assign(1, bounds);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,229 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/DrawBatcher.hpp>
+#include <TGUI/FrameStats.hpp>
+#include <TGUI/Widget.hpp>
+
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // All batching state is kept per thread, so that guis that are drawn on different threads never share a batch
+    thread_local bool batchingEnabled = false;
+    thread_local unsigned int drawingDepth = 0;
+
+    // The batch that hasn't been drawn yet
+    thread_local std::vector<sf::Vertex> batchVertices;
+    thread_local sf::RenderTarget* batchTarget = nullptr;
+    thread_local sf::RenderStates batchStates;
+
+    thread_local tgui::DrawStats stats;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatcher::setEnabled(bool enabled)
+    {
+        flush();
+        batchingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DrawBatcher::isEnabled()
+    {
+        return batchingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatcher::beginDrawing()
+    {
+        if (drawingDepth++ == 0)
+            stats = DrawStats{};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatcher::endDrawing()
+    {
+        if (--drawingDepth == 0)
+            flush();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatcher::draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states)
+    {
+        if ((vertexCount == 0) || (vertices == nullptr))
+            return;
+
+        // Only triangles can be merged, lines and points are drawn immediately
+        const bool trianglePrimitive = (type == sf::PrimitiveType::Triangles) || (type == sf::PrimitiveType::TrianglesStrip)
+                                    || (type == sf::PrimitiveType::TrianglesFan) || (type == sf::PrimitiveType::Quads);
+        if (!batchingEnabled || (drawingDepth == 0) || !trianglePrimitive || (states.shader != nullptr))
+        {
+            flush();
+            target.draw(vertices, vertexCount, type, states);
+            stats.drawCalls++;
+            TGUI_FRAME_STATS(priv::FrameStatsCounters::addDrawCall(states.texture, vertexCount));
+            return;
+        }
+
+        if (!canBatch(target, states))
+        {
+            flush();
+
+            batchTarget = &target;
+            batchStates = states;
+            batchStates.transform = sf::Transform::Identity;
+        }
+        else
+            stats.batchedDraws++;
+
+        addToBatch(vertices, vertexCount, type, states.transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatcher::draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        flush();
+        target.draw(drawable, states);
+        stats.drawCalls++;
+        TGUI_FRAME_STATS(priv::FrameStatsCounters::addDrawableDrawCall());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatcher::draw(sf::RenderTarget& target, const Widget& widget, const sf::RenderStates& states)
+    {
+        // The widget draws its parts through this class
+        target.draw(widget, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatcher::flush()
+    {
+        if (batchVertices.empty())
+            return;
+
+        batchTarget->draw(batchVertices.data(), batchVertices.size(), sf::PrimitiveType::Triangles, batchStates);
+        stats.drawCalls++;
+        stats.batchedVertices += batchVertices.size();
+        TGUI_FRAME_STATS(priv::FrameStatsCounters::addDrawCall(batchStates.texture, batchVertices.size()));
+
+        batchVertices.clear();
+        batchTarget = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const DrawStats& DrawBatcher::getStats()
+    {
+        return stats;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DrawBatcher::canBatch(const sf::RenderTarget& target, const sf::RenderStates& states)
+    {
+        return !batchVertices.empty()
+            && (batchTarget == &target)
+            && (batchStates.texture == states.texture)
+            && (batchStates.blendMode == states.blendMode);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatcher::addToBatch(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::Transform& transform)
+    {
+        const auto addVertex = [&transform](const sf::Vertex& vertex)
+            {
+                batchVertices.push_back(vertex);
+                batchVertices.back().position = transform.transformPoint(vertex.position);
+            };
+
+        switch (type)
+        {
+            case sf::PrimitiveType::TrianglesStrip:
+            {
+                for (std::size_t i = 2; i < vertexCount; ++i)
+                {
+                    addVertex(vertices[i-2]);
+                    addVertex(vertices[i-1]);
+                    addVertex(vertices[i]);
+                }
+                break;
+            }
+            case sf::PrimitiveType::TrianglesFan:
+            {
+                for (std::size_t i = 2; i < vertexCount; ++i)
+                {
+                    addVertex(vertices[0]);
+                    addVertex(vertices[i-1]);
+                    addVertex(vertices[i]);
+                }
+                break;
+            }
+            case sf::PrimitiveType::Quads:
+            {
+                for (std::size_t i = 3; i < vertexCount; i += 4)
+                {
+                    addVertex(vertices[i-3]);
+                    addVertex(vertices[i-2]);
+                    addVertex(vertices[i-1]);
+                    addVertex(vertices[i-3]);
+                    addVertex(vertices[i-1]);
+                    addVertex(vertices[i]);
+                }
+                break;
+            }
+            default: // Triangles
+            {
+                for (std::size_t i = 0; i + 2 < vertexCount; i += 3)
+                {
+                    addVertex(vertices[i]);
+                    addVertex(vertices[i+1]);
+                    addVertex(vertices[i+2]);
+                }
+                break;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,133 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/FocusChain.hpp>
+#include <TGUI/Container.hpp>
+
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FocusChain::clear()
+    {
+        m_widgets.clear();
+        m_positions.clear();
+        m_containerPositions.clear();
+        m_valid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FocusChain::add(Widget* widget)
+    {
+        m_widgets.push_back(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FocusChain::finish()
+    {
+        std::stable_sort(m_widgets.begin(), m_widgets.end(), [](const Widget* left, const Widget* right)
+            {
+                return left->getTabIndex() < right->getTabIndex();
+            });
+
+        m_positions.reserve(m_widgets.size());
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            m_positions[m_widgets[i]] = i;
+
+            // The parents are visited from the inside out, once a container has a position all containers around it have one too
+            for (const Container* parent = m_widgets[i]->getParent(); parent != nullptr; parent = parent->getParent())
+            {
+                if (!m_containerPositions.insert({parent, i}).second)
+                    break;
+            }
+        }
+
+        m_valid = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget* FocusChain::getNext(const Widget* focusedWidget) const
+    {
+        if (m_widgets.empty())
+            return nullptr;
+
+        if (focusedWidget)
+        {
+            auto it = m_positions.find(focusedWidget);
+            if (it != m_positions.end())
+                return m_widgets[(it->second + 1) % m_widgets.size()];
+
+            const std::size_t position = findPosition(focusedWidget);
+            if (position < m_widgets.size())
+                return m_widgets[position];
+        }
+
+        return m_widgets.front();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget* FocusChain::getPrevious(const Widget* focusedWidget) const
+    {
+        if (m_widgets.empty())
+            return nullptr;
+
+        if (focusedWidget)
+        {
+            const std::size_t position = findPosition(focusedWidget);
+            if (position < m_widgets.size())
+                return m_widgets[(position + m_widgets.size() - 1) % m_widgets.size()];
+        }
+
+        return m_widgets.back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t FocusChain::findPosition(const Widget* widget) const
+    {
+        auto it = m_positions.find(widget);
+        if (it != m_positions.end())
+            return it->second;
+
+        it = m_containerPositions.find(widget);
+        if (it != m_containerPositions.end())
+            return it->second;
+
+        return m_widgets.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,125 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/FrameStats.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Everything that happened on the thread since it started, the times are not used
+    thread_local tgui::FrameStats totals;
+
+    // The texture of the last draw call, which sfml doesn't have to bind again
+    thread_local const sf::Texture* lastTexture = nullptr;
+    thread_local bool lastTextureKnown = false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void FrameStatsCounters::add(std::size_t FrameStats::* counter, std::size_t amount)
+        {
+            totals.*counter += amount;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void FrameStatsCounters::addDrawCall(const sf::Texture* texture, std::size_t vertexCount)
+        {
+            totals.drawCalls++;
+            totals.vertices += vertexCount;
+
+            if (texture && (!lastTextureKnown || (texture != lastTexture)))
+                totals.textureBinds++;
+
+            lastTexture = texture;
+            lastTextureKnown = true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void FrameStatsCounters::addDrawableDrawCall()
+        {
+            totals.drawCalls++;
+
+            // The drawable may have bound a texture of its own
+            lastTextureKnown = false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void FrameStatsCounters::startFrame(FrameStats& currentFrame)
+        {
+            currentFrame = totals;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void FrameStatsCounters::finishFrame(FrameStats& currentFrame, FrameStats& finishedFrame)
+        {
+            finishedFrame.drawCalls = totals.drawCalls - currentFrame.drawCalls;
+            finishedFrame.vertices = totals.vertices - currentFrame.vertices;
+            finishedFrame.textureBinds = totals.textureBinds - currentFrame.textureBinds;
+            finishedFrame.scissorChanges = totals.scissorChanges - currentFrame.scissorChanges;
+            finishedFrame.widgetsDrawn = totals.widgetsDrawn - currentFrame.widgetsDrawn;
+            finishedFrame.widgetsCulled = totals.widgetsCulled - currentFrame.widgetsCulled;
+            finishedFrame.updateCalls = totals.updateCalls - currentFrame.updateCalls;
+            finishedFrame.layoutRecalculations = totals.layoutRecalculations - currentFrame.layoutRecalculations;
+            finishedFrame.signalsEmitted = totals.signalsEmitted - currentFrame.signalsEmitted;
+            finishedFrame.handleEventTime = currentFrame.handleEventTime;
+            finishedFrame.updateTime = currentFrame.updateTime;
+            finishedFrame.drawTime = currentFrame.drawTime;
+
+            startFrame(currentFrame);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        FrameStatsTimer::FrameStatsTimer(FrameStats& stats, sf::Time FrameStats::* time) :
+            m_stats(stats),
+            m_time (time)
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        FrameStatsTimer::~FrameStatsTimer()
+        {
+            m_stats.*m_time += m_clock.getElapsedTime();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,13 +23,78 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Clipboard.hpp>
+#include <TGUI/Clipping.hpp>
+#include <TGUI/FrameStats.hpp>
 #include <TGUI/Widgets/ToolTip.hpp>
 #include <TGUI/Gui.hpp>
 #include <TGUI/DefaultFont.hpp>
 
 #include <SFML/OpenGL.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <limits>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Areas are merged when they overlap, so that no pixel is drawn twice. When there are still too many areas left
+    // then drawing all widgets for every area would take longer than redrawing the bounding box once.
+    const std::size_t maxDamagedAreas = 8;
+
+    sf::IntRect mergeAreas(const sf::IntRect& left, const sf::IntRect& right)
+    {
+        const int minX = std::min(left.left, right.left);
+        const int minY = std::min(left.top, right.top);
+        const int maxX = std::max(left.left + left.width, right.left + right.width);
+        const int maxY = std::max(left.top + left.height, right.top + right.height);
+        return {minX, minY, maxX - minX, maxY - minY};
+    }
+
+    std::vector<sf::IntRect> getDamagedPixels(const std::vector<sf::FloatRect>& damagedAreas, const sf::RenderTarget& target, const sf::View& view)
+    {
+        const sf::IntRect targetArea{0, 0, static_cast<int>(target.getSize().x), static_cast<int>(target.getSize().y)};
+
+        std::vector<sf::IntRect> pixelAreas;
+        for (const auto& area : damagedAreas)
+        {
+            // One extra pixel is added on every side to include the anti-aliased edges of the widgets
+            const sf::Vector2i topLeft = target.mapCoordsToPixel({area.left, area.top}, view);
+            const sf::Vector2i bottomRight = target.mapCoordsToPixel({area.left + area.width, area.top + area.height}, view);
+            sf::IntRect pixelArea{std::min(topLeft.x, bottomRight.x) - 1, std::min(topLeft.y, bottomRight.y) - 1,
+                                  std::abs(bottomRight.x - topLeft.x) + 2, std::abs(bottomRight.y - topLeft.y) + 2};
+
+            if (!pixelArea.intersects(targetArea, pixelArea))
+                continue;
+
+            for (std::size_t i = 0; i < pixelAreas.size();)
+            {
+                if (pixelAreas[i].intersects(pixelArea))
+                {
+                    pixelArea = mergeAreas(pixelAreas[i], pixelArea);
+                    pixelAreas.erase(pixelAreas.begin() + i);
+                    i = 0;
+                }
+                else
+                    ++i;
+            }
+
+            pixelAreas.push_back(pixelArea);
+        }
+
+        if (pixelAreas.size() > maxDamagedAreas)
+        {
+            for (std::size_t i = 1; i < pixelAreas.size(); ++i)
+                pixelAreas[0] = mergeAreas(pixelAreas[0], pixelAreas[i]);
+
+            pixelAreas.resize(1);
+        }
+
+        return pixelAreas;
+    }
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -46,6 +111,8 @@ namespace tgui
         sf::Font defaultFont;
         if (defaultFont.loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes)))
             setFont(defaultFont);
+
+        TGUI_FRAME_STATS(priv::FrameStatsCounters::startFrame(m_currentFrameStats));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -64,6 +131,8 @@ namespace tgui
         sf::Font defaultFont;
         if (defaultFont.loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes)))
             setFont(defaultFont);
+
+        TGUI_FRAME_STATS(priv::FrameStatsCounters::startFrame(m_currentFrameStats));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -80,6 +149,8 @@ namespace tgui
         sf::Font defaultFont;
         if (defaultFont.loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes)))
             setFont(defaultFont);
+
+        TGUI_FRAME_STATS(priv::FrameStatsCounters::startFrame(m_currentFrameStats));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -112,6 +183,8 @@ namespace tgui
 
     void Gui::setView(const sf::View& view)
     {
+        m_fullRedrawNeeded = true;
+
         if ((m_view.getCenter() != view.getCenter()) || (m_view.getSize() != view.getSize()))
         {
             m_view = view;
@@ -120,10 +193,12 @@ namespace tgui
             m_container->m_position = view.getCenter() - (view.getSize() / 2.0f);
 
             m_container->m_callback.position = m_container->getPosition();
-            m_container->sendSignal("PositionChanged", m_container->getPosition());
+            LayoutImpl::widgetChanged(m_container.get(), true, false);
+            m_container->sendSignal(m_container->m_onPositionChanged, m_container->getPosition());
 
             m_container->m_callback.size = m_container->getSize();
-            m_container->sendSignal("SizeChanged", m_container->getSize());
+            LayoutImpl::widgetChanged(m_container.get(), false, true);
+            m_container->sendSignal(m_container->m_onSizeChanged, m_container->getSize());
         }
         else // Set it anyway in case something changed that we didn't care to check
             m_view = view;
@@ -135,6 +210,19 @@ namespace tgui
     {
         assert(m_window != nullptr);
 
+        TGUI_FRAME_STATS(priv::FrameStatsTimer timer(m_currentFrameStats, &FrameStats::handleEventTime));
+
+        executePostedTasks();
+
+        // The time since the last frame is passed to the widgets before handling a click. Otherwise a second click that
+        // arrives too late while no frame was drawn would still be seen as a double click.
+        if (m_container->m_focused
+         && ((event.type == sf::Event::MouseButtonPressed) || (event.type == sf::Event::MouseButtonReleased)
+          || (event.type == sf::Event::TouchBegan) || (event.type == sf::Event::TouchEnded)))
+        {
+            updateTime(m_clock.restart());
+        }
+
         // Check if the event has something to do with the mouse
         if ((event.type == sf::Event::MouseMoved) || (event.type == sf::Event::MouseButtonPressed)
          || (event.type == sf::Event::MouseButtonReleased) || (event.type == sf::Event::MouseWheelMoved))
@@ -207,10 +295,61 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::handleEvents(sf::Window& window, const std::function<void(const sf::Event&)>& eventHandler)
+    {
+        m_polledEvents.clear();
+
+        sf::Event event;
+        while (window.pollEvent(event))
+            m_polledEvents.push_back(event);
+
+        handleEvents(m_polledEvents, eventHandler);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Gui::handleEvents(const std::vector<sf::Event>& events, const std::function<void(const sf::Event&)>& eventHandler)
+    {
+        std::size_t skippedEvents = 0;
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            // The mouse position is going to be overwritten by the next event anyway
+            if ((events[i].type == sf::Event::MouseMoved) && (i+1 < events.size()) && (events[i+1].type == sf::Event::MouseMoved))
+            {
+                skippedEvents++;
+                continue;
+            }
+
+            if (eventHandler)
+                eventHandler(events[i]);
+
+            handleEvent(events[i]);
+        }
+
+        return skippedEvents;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::draw()
+    {
+        {
+            TGUI_FRAME_STATS(priv::FrameStatsTimer timer(m_currentFrameStats, &FrameStats::drawTime));
+            drawWidgets();
+        }
+
+        // A frame ends when the gui has been drawn
+        TGUI_FRAME_STATS(priv::FrameStatsCounters::finishFrame(m_currentFrameStats, m_frameStats));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::drawWidgets()
     {
         assert(m_window != nullptr);
 
+        executePostedTasks();
+
         // Make sure the right opengl context is set when clipping
         if (dynamic_cast<sf::RenderWindow*>(m_window))
             dynamic_cast<sf::RenderWindow*>(m_window)->setActive(true);
@@ -223,6 +362,29 @@ namespace tgui
         else
             m_clock.restart();
 
+        // Make sure the widgets are at the correct position before drawing them
+        flushLayouts();
+
+        if (m_partialRedrawEnabled)
+        {
+            redrawDamagedAreas();
+
+            // The colors in the back buffer were already blended with the transparent background
+            sf::RenderStates states;
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 3)
+            states.blendMode = sf::BlendMode{sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha};
+        #endif
+
+            const sf::View oldView = m_window->getView();
+            m_window->setView(m_window->getDefaultView());
+            m_window->draw(sf::Sprite{m_backBuffer->getTexture()}, states);
+            m_window->setView(oldView);
+            return;
+        }
+
+        m_container->m_damagedAreas.clear();
+        m_fullRedrawNeeded = false;
+
         // Check if clipping is enabled
         GLboolean clippingEnabled = glIsEnabled(GL_SCISSOR_TEST);
         GLint scissor[4];
@@ -231,12 +393,15 @@ namespace tgui
         {
             // Remember the old clipping area
             glGetIntegerv(GL_SCISSOR_BOX, scissor);
+            Clipping::beginDrawing(*m_window, scissor[0], scissor[1], scissor[2], scissor[3]);
         }
         else // Clipping was disabled
         {
             // Enable clipping
             glEnable(GL_SCISSOR_TEST);
             glScissor(0, 0, m_window->getSize().x, m_window->getSize().y);
+            TGUI_FRAME_STATS(priv::FrameStatsCounters::add(&FrameStats::scissorChanges));
+            Clipping::beginDrawing(*m_window, 0, 0, m_window->getSize().x, m_window->getSize().y);
         }
 
         // Change the view
@@ -249,15 +414,77 @@ namespace tgui
         // Restore the old view
         m_window->setView(oldView);
 
+        Clipping::endDrawing();
+
         // Reset clipping to its original state
         if (clippingEnabled)
+        {
             glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+            TGUI_FRAME_STATS(priv::FrameStatsCounters::add(&FrameStats::scissorChanges));
+        }
         else
             glDisable(GL_SCISSOR_TEST);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::setPartialRedrawEnabled(bool enabled)
+    {
+        m_partialRedrawEnabled = enabled;
+        m_fullRedrawNeeded = true;
+
+        if (!enabled)
+            m_backBuffer = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isPartialRedrawEnabled() const
+    {
+        return m_partialRedrawEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isDirty() const
+    {
+        return m_fullRedrawNeeded || !m_container->m_damagedAreas.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::needsRedraw() const
+    {
+        return isDirty() || (timeUntilNextUpdate() == sf::Time::Zero);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Gui::timeUntilNextUpdate() const
+    {
+        // Posted tasks and dirty layouts are processed during the next call to draw
+        if ((m_tasks.getStats().queuedTasks > 0) || LayoutImpl::hasDirtyLayouts())
+            return sf::Time::Zero;
+
+        // The time doesn't advance while the window isn't focused
+        sf::Time time = sf::microseconds(std::numeric_limits<sf::Int64>::max());
+        if (!m_container->m_focused)
+            return time;
+
+        time = m_container->timeUntilNextUpdate();
+        if (m_tooltipPossible)
+            time = std::min(time, std::max(ToolTip::getTimeToDisplay() - m_tooltipTime, sf::Time::Zero));
+
+        // The timers of the widgets were last updated when the clock was restarted
+        const sf::Time elapsedTime = m_clock.getElapsedTime();
+        if (time > elapsedTime)
+            return time - elapsedTime;
+        else
+            return sf::Time::Zero;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     sf::Vector2f Gui::getSize() const
     {
         assert(m_window != nullptr);
@@ -295,6 +522,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::addWidgets(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames)
+    {
+        m_container->addWidgets(widgets, widgetNames);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Gui::removeIf(const std::function<bool(const Widget::Ptr&)>& predicate)
+    {
+        return m_container->removeIf(predicate);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::reorder(const std::vector<std::size_t>& permutation)
+    {
+        m_container->reorder(permutation);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Gui::setWidgetName(const Widget::Ptr& widget, const std::string& name)
     {
         return m_container->setWidgetName(widget, name);
@@ -309,6 +557,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::setGlobalNameIndexEnabled(bool enabled)
+    {
+        m_container->setGlobalNameIndexEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isGlobalNameIndexEnabled() const
+    {
+        return m_container->m_globalNameIndex != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::focusWidget(const Widget::Ptr& widget)
     {
         m_container->focusWidget(widget.get());
@@ -318,14 +580,14 @@ namespace tgui
 
     void Gui::focusNextWidget()
     {
-        m_container->focusNextWidget();
+        m_container->moveFocusInChain(true);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Gui::focusPreviousWidget()
     {
-        m_container->focusPreviousWidget();
+        m_container->moveFocusInChain(false);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -386,10 +648,79 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::setLayoutUpdatesDeferred(bool deferred)
+    {
+        LayoutImpl::setDeferredUpdates(deferred);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::getLayoutUpdatesDeferred() const
+    {
+        return LayoutImpl::getDeferredUpdates();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::flushLayouts()
+    {
+        LayoutImpl::recalculateDirtyLayouts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::post(std::function<void()> task)
+    {
+        m_tasks.post(std::move(task));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setMaxTasksPerUpdate(std::size_t maxTasks)
+    {
+        m_maxTasksPerUpdate = maxTasks;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Gui::getMaxTasksPerUpdate() const
+    {
+        return m_maxTasksPerUpdate;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::executePostedTasks()
+    {
+        m_tasks.executeTasks(m_maxTasksPerUpdate);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TaskQueueStats Gui::getTaskQueueStats() const
+    {
+        return m_tasks.getStats();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FrameStats Gui::getFrameStats() const
+    {
+        return m_frameStats;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
+        TGUI_FRAME_STATS(priv::FrameStatsTimer timer(m_currentFrameStats, &FrameStats::updateTime));
+
         m_container->m_animationTimeElapsed = elapsedTime;
         m_container->update(elapsedTime);
+        TGUI_FRAME_STATS(priv::FrameStatsCounters::add(&FrameStats::updateCalls));
+
+        // Animations might have changed the position or size of widgets
+        flushLayouts();
 
         if (m_tooltipPossible)
         {
@@ -412,6 +743,45 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::redrawDamagedAreas()
+    {
+        const sf::Vector2u size = m_window->getSize();
+        if (!m_backBuffer || (m_backBuffer->getSize() != size))
+        {
+            m_backBuffer = std::unique_ptr<sf::RenderTexture>(new sf::RenderTexture);
+            if (!m_backBuffer->create(size.x, size.y))
+                throw Exception{"Failed to create the back buffer for redrawing only the changed parts of the gui."};
+
+            m_fullRedrawNeeded = true;
+        }
+
+        std::vector<sf::IntRect> areas;
+        if (m_fullRedrawNeeded)
+            areas.push_back({0, 0, static_cast<int>(size.x), static_cast<int>(size.y)});
+        else
+            areas = getDamagedPixels(m_container->m_damagedAreas, *m_window, m_view);
+
+        m_container->m_damagedAreas.clear();
+        m_fullRedrawNeeded = false;
+
+        if (areas.empty())
+            return;
+
+        m_backBuffer->setView(m_view);
+        for (const auto& area : areas)
+        {
+            // Clearing only affects the pixels inside the scissor box
+            Clipping::beginDrawing(*m_backBuffer, area);
+            m_backBuffer->clear(sf::Color::Transparent);
+            m_container->drawWidgetContainer(m_backBuffer.get(), sf::RenderStates::Default);
+            Clipping::endDrawing();
+        }
+
+        m_backBuffer->display();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -9,7 +9,7 @@ namespace tgui
 
     HorizontalLayout::HorizontalLayout()
     {
-        m_callback.widgetType = "HorizontalLayout";
+        setWidgetType(WidgetTypes::HorizontalLayout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,11 +24,16 @@
 
 
 #include <TGUI/Widget.hpp>
+#include <TGUI/FrameStats.hpp>
 #include <TGUI/Gui.hpp>
 
 #include <cassert>
 #include <cctype>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <tuple>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -36,84 +41,185 @@ namespace
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    float getWidgetLeft(tgui::Widget* widget)
+    float getWidgetProperty(tgui::Widget* widget, tgui::LayoutImpl::WidgetProperty property)
     {
-        return widget->getPosition().x;
+        switch (property)
+        {
+        case tgui::LayoutImpl::WidgetProperty::Left:
+            return widget->getPosition().x;
+        case tgui::LayoutImpl::WidgetProperty::Top:
+            return widget->getPosition().y;
+        case tgui::LayoutImpl::WidgetProperty::Width:
+            return widget->getSize().x;
+        case tgui::LayoutImpl::WidgetProperty::Height:
+            return widget->getSize().y;
+        case tgui::LayoutImpl::WidgetProperty::Right:
+            return widget->getPosition().x + widget->getSize().x;
+        case tgui::LayoutImpl::WidgetProperty::Bottom:
+            return widget->getPosition().y + widget->getSize().y;
+        }
+
+        return 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    float getWidgetTop(tgui::Widget* widget)
+    void recalculateLayout(tgui::LayoutImpl* layout)
     {
-        return widget->getPosition().y;
+        // Only the roots should be told to update as they will update their children with them
+        if (layout->parents.empty())
+        {
+            layout->recalculate();
+        }
+        else
+        {
+            for (auto& parent : layout->parents)
+                recalculateLayout(parent);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    float getWidgetWidth(tgui::Widget* widget)
+    void resetLayout(std::shared_ptr<tgui::LayoutImpl> layout, float value)
     {
-        return widget->getSize().x;
+        // When updates are deferred, the layout is only recalculated when the gui flushes the layouts
+        if (tgui::LayoutImpl::getDeferredUpdates())
+        {
+            if (layout->operation == tgui::LayoutImpl::Operation::Value)
+                layout->value = value;
+
+            layout->markDirty();
+            return;
+        }
+
+        layout->value = value;
+        recalculateLayout(layout.get());
+
+        for (auto& attachedLayout : layout->attachedLayouts)
+            attachedLayout->update();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    float getWidgetHeight(tgui::Widget* widget)
+    // Operations are identified by their type and their operands. Constant operands are identified by their value instead of
+    // by their address, so that e.g. "bindWidth(panel) * 0.25f" gives the same key every time it is created.
+    typedef std::tuple<int, const tgui::LayoutImpl*, std::uint32_t, const tgui::LayoutImpl*, std::uint32_t, const tgui::LayoutImpl*, std::uint32_t> OperationKey;
+
+    struct BoundLayout
     {
-        return widget->getSize().y;
-    }
+        std::weak_ptr<tgui::Widget> widget;
+        std::weak_ptr<tgui::LayoutImpl> layout;
+    };
+
+    // Layouts are shared between all places where the same expression is used. The tables don't keep the layouts alive.
+    // All layout state is kept per thread, so that independent guis can be updated from different threads.
+    thread_local std::map<OperationKey, std::weak_ptr<tgui::LayoutImpl>> internedOperations;
+    thread_local std::map<std::pair<const tgui::Widget*, tgui::LayoutImpl::WidgetProperty>, BoundLayout> internedBindings;
+    thread_local std::size_t internedOperationsCleanupSize = 64;
+    thread_local std::size_t internedBindingsCleanupSize = 64;
+
+    thread_local bool deferredUpdates = false;
+    thread_local std::vector<std::weak_ptr<tgui::LayoutImpl>> dirtyLayouts;
+    thread_local unsigned long long calculationCount = 0;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    float getWidgetRight(tgui::Widget* widget)
+    // Forget about layouts that no longer exist. To keep this cheap, it is only done when the table has doubled in size.
+    template <typename Map, typename Func>
+    void removeExpiredEntries(Map& entries, std::size_t& cleanupSize, Func isExpired)
     {
-        return widget->getPosition().x + widget->getSize().x;
+        if (entries.size() < cleanupSize)
+            return;
+
+        for (auto it = entries.begin(); it != entries.end();)
+        {
+            if (isExpired(it->second))
+                it = entries.erase(it);
+            else
+                ++it;
+        }
+
+        cleanupSize = std::max<std::size_t>(64, 2 * entries.size());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    float getWidgetBottom(tgui::Widget* widget)
+    OperationKey makeOperationKey(tgui::LayoutImpl::Operation operation, const std::vector<std::shared_ptr<tgui::LayoutImpl>>& operands)
     {
-        return widget->getPosition().y + widget->getSize().y;
+        const tgui::LayoutImpl* layouts[3] = {nullptr, nullptr, nullptr};
+        std::uint32_t constants[3] = {0, 0, 0};
+        for (std::size_t i = 0; i < operands.size(); ++i)
+        {
+            if ((operands[i]->operation == tgui::LayoutImpl::Operation::Value) && !operands[i]->boundToWidget)
+                std::memcpy(&constants[i], &operands[i]->value, sizeof(float));
+            else
+                layouts[i] = operands[i].get();
+        }
+
+        return OperationKey{static_cast<int>(operation), layouts[0], constants[0], layouts[1], constants[1], layouts[2], constants[2]};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void recalculateLayout(tgui::LayoutImpl* layout)
+    tgui::Layout createOperation(tgui::LayoutImpl::Operation operation, const std::vector<std::shared_ptr<tgui::LayoutImpl>>& operands)
     {
-        // Only the roots should be told to update as they will update their children with them
-        if (layout->parents.empty())
-        {
-            layout->recalculate();
-        }
-        else
+        const OperationKey key = makeOperationKey(operation, operands);
+
+        // Reuse the layout when the same operation was already performed on the same operands
+        auto it = internedOperations.find(key);
+        if (it != internedOperations.end())
         {
-            for (auto& parent : layout->parents)
-                recalculateLayout(parent);
+            auto existingLayout = it->second.lock();
+            if (existingLayout)
+                return tgui::Layout{existingLayout};
         }
+
+        tgui::Layout result;
+        result.getImpl()->operation = operation;
+        result.getImpl()->operands = operands;
+        for (auto& operand : operands)
+            operand->parents.insert(result.getImpl().get());
+
+        result.getImpl()->recalculate();
+
+        internedOperations[key] = result.getImpl();
+        removeExpiredEntries(internedOperations, internedOperationsCleanupSize,
+                             [](const std::weak_ptr<tgui::LayoutImpl>& layout){ return layout.expired(); });
+        return result;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void resetLayout(std::shared_ptr<tgui::LayoutImpl> layout, float value)
+    tgui::Layout layoutOperator(tgui::Layout&& left, tgui::Layout&& right, tgui::LayoutImpl::Operation operation)
     {
-        layout->value = value;
-        recalculateLayout(layout.get());
-
-        for (auto& attachedLayout : layout->attachedLayouts)
-            attachedLayout->update();
+        return createOperation(operation, {left.getImpl(), right.getImpl()});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    tgui::Layout layoutOperator(tgui::Layout&& left, tgui::Layout&& right, tgui::LayoutImpl::Operation operation)
+    tgui::Layout bindWidgetProperty(const tgui::Widget::Ptr& widget, tgui::LayoutImpl::WidgetProperty property)
     {
+        // All layouts that are bound to the same property of the same widget share the same object
+        const auto key = std::make_pair(static_cast<const tgui::Widget*>(widget.get()), property);
+        auto it = internedBindings.find(key);
+        if ((it != internedBindings.end()) && (it->second.widget.lock() == widget))
+        {
+            auto existingLayout = it->second.layout.lock();
+            if (existingLayout)
+                return tgui::Layout{existingLayout};
+        }
+
         tgui::Layout result;
-        result.getImpl()->operation = operation;
-        result.getImpl()->operands.push_back(left.getImpl());
-        result.getImpl()->operands.push_back(right.getImpl());
-        left.getImpl()->parents.insert(result.getImpl().get());
-        right.getImpl()->parents.insert(result.getImpl().get());
-        result.getImpl()->recalculate();
+        result.getImpl()->value = getWidgetProperty(widget.get(), property);
+        result.getImpl()->boundToWidget = true;
+
+        const bool dependsOnPosition = (property != tgui::LayoutImpl::WidgetProperty::Width) && (property != tgui::LayoutImpl::WidgetProperty::Height);
+        const bool dependsOnSize = (property != tgui::LayoutImpl::WidgetProperty::Left) && (property != tgui::LayoutImpl::WidgetProperty::Top);
+        result.getImpl()->addWidgetDependency(widget.get(), property, dependsOnPosition, dependsOnSize);
+
+        internedBindings[key] = {widget, result.getImpl()};
+        removeExpiredEntries(internedBindings, internedBindingsCleanupSize,
+                             [](const BoundLayout& bound){ return bound.widget.expired() || bound.layout.expired(); });
         return result;
     }
 
@@ -130,6 +236,72 @@ namespace tgui
     {
         for (auto& operand : operands)
             operand->parents.erase(this);
+
+        // The widgets no longer have to inform this layout about their changes.
+        // The weak pointers to this layout have already expired, so the entries are removed the next time the list is compacted.
+        for (auto& widget : boundWidgets)
+        {
+            auto& dependencies = widget->m_layoutDependencies;
+            widget->m_destroyedLayoutDependencies++;
+            if (widget->m_destroyedLayoutDependencies * 2 >= dependencies.size())
+            {
+                dependencies.erase(std::remove_if(dependencies.begin(), dependencies.end(),
+                                                  [](const WidgetDependency& dependency){ return dependency.layout.expired(); }),
+                                   dependencies.end());
+                widget->m_destroyedLayoutDependencies = 0;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutImpl::addWidgetDependency(Widget* widget, WidgetProperty property, bool position, bool size)
+    {
+        widget->m_layoutDependencies.push_back({shared_from_this(), property, position, size});
+
+        if (std::find(boundWidgets.begin(), boundWidgets.end(), widget) == boundWidgets.end())
+            boundWidgets.push_back(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutImpl::widgetChanged(Widget* widget, bool positionChanged, bool sizeChanged)
+    {
+        if (widget->m_layoutDependencies.empty())
+            return;
+
+        // Recalculating layouts can add or remove dependencies, so we work on a copy which also keeps the layouts alive
+        std::vector<std::pair<std::shared_ptr<LayoutImpl>, WidgetProperty>> changedLayouts;
+        for (auto& dependency : widget->m_layoutDependencies)
+        {
+            if ((positionChanged && dependency.position) || (sizeChanged && dependency.size))
+            {
+                auto layout = dependency.layout.lock();
+                if (layout)
+                    changedLayouts.emplace_back(std::move(layout), dependency.property);
+            }
+        }
+
+        for (auto& changedLayout : changedLayouts)
+            resetLayout(changedLayout.first, getWidgetProperty(widget, changedLayout.second));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutImpl::removeWidgetDependencies(Widget* widget)
+    {
+        for (auto& dependency : widget->m_layoutDependencies)
+        {
+            const auto layout = dependency.layout.lock();
+            if (!layout)
+                continue;
+
+            auto& widgets = layout->boundWidgets;
+            widgets.erase(std::remove(widgets.begin(), widgets.end(), widget), widgets.end());
+        }
+
+        widget->m_layoutDependencies.clear();
+        widget->m_destroyedLayoutDependencies = 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,12 +311,128 @@ namespace tgui
         for (auto& operand : operands)
             operand->recalculate();
 
+        calculateValue();
+
+        // Alert the widgets that are using this layout
+        for (auto& attachedLayout : attachedLayouts)
+            attachedLayout->update();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutImpl::markDirty()
+    {
+        if (!dirty)
+        {
+            dirty = true;
+            dirtyLayouts.push_back(shared_from_this());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutImpl::recalculateDirtyLayouts()
+    {
+        // Updating the widgets can change other layouts again, but there is a limit to avoid looping forever on cyclic layouts
+        unsigned int passes = 0;
+        while (!dirtyLayouts.empty() && (passes++ < 100))
+        {
+            std::vector<std::weak_ptr<LayoutImpl>> changedLayouts;
+            changedLayouts.swap(dirtyLayouts);
+
+            // Find all layouts that depend on the changed ones. Each layout is stored after the layouts that make use of it.
+            std::vector<std::shared_ptr<LayoutImpl>> sortedLayouts;
+            std::set<LayoutImpl*> visitedLayouts;
+            for (auto& weakLayout : changedLayouts)
+            {
+                auto layout = weakLayout.lock();
+                if (layout)
+                {
+                    layout->dirty = false;
+                    layout->sortDependentLayouts(visitedLayouts, sortedLayouts);
+                }
+            }
+
+            // Recalculate every affected layout exactly once, with the operands before the layouts that use them
+            for (auto it = sortedLayouts.rbegin(); it != sortedLayouts.rend(); ++it)
+                (*it)->calculateValue();
+
+            // Only alert the widgets once all values are up-to-date
+            for (auto it = sortedLayouts.rbegin(); it != sortedLayouts.rend(); ++it)
+            {
+                const std::vector<Layout*> attached((*it)->attachedLayouts.begin(), (*it)->attachedLayouts.end());
+                for (auto& attachedLayout : attached)
+                {
+                    // A previous callback might have removed the layout
+                    if ((*it)->attachedLayouts.find(attachedLayout) != (*it)->attachedLayouts.end())
+                        attachedLayout->update();
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutImpl::setDeferredUpdates(bool deferred)
+    {
+        deferredUpdates = deferred;
+
+        // Don't leave any layouts behind with an outdated value
+        if (!deferred)
+            recalculateDirtyLayouts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool LayoutImpl::getDeferredUpdates()
+    {
+        return deferredUpdates;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool LayoutImpl::hasDirtyLayouts()
+    {
+        return !dirtyLayouts.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned long long LayoutImpl::getCalculationCount()
+    {
+        return calculationCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutImpl::sortDependentLayouts(std::set<LayoutImpl*>& visitedLayouts, std::vector<std::shared_ptr<LayoutImpl>>& sortedLayouts)
+    {
+        if (!visitedLayouts.insert(this).second)
+            return;
+
+        for (auto& parent : parents)
+            parent->sortDependentLayouts(visitedLayouts, sortedLayouts);
+
+        sortedLayouts.push_back(shared_from_this());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutImpl::calculateValue()
+    {
+        calculationCount++;
+        TGUI_FRAME_STATS(priv::FrameStatsCounters::add(&FrameStats::layoutRecalculations));
+
         switch (operation)
         {
         case Operation::Value:
             break;
         case Operation::String:
-            value = parseLayoutString(stringExpression);
+            // The string is only parsed once, afterwards only the compiled expression has to be evaluated
+            if (expressionNodes.empty())
+                expressionRoot = compileExpression(stringExpression);
+
+            value = evaluateExpression(expressionRoot);
             break;
         case Operation::Plus:
             value = operands[0]->value + operands[1]->value;
@@ -195,107 +483,104 @@ namespace tgui
             value = operands[0]->value ? operands[1]->value : operands[2]->value;
             break;
         }
+    }
 
-        // Alert the widgets that are using this layout
-        for (auto& attachedLayout : attachedLayouts)
-            attachedLayout->update();
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t LayoutImpl::addExpressionNode(Operation nodeOperation, std::size_t first, std::size_t second, std::size_t third)
+    {
+        ExpressionNode node;
+        node.operation = nodeOperation;
+        node.value = 0;
+        node.operands[0] = first;
+        node.operands[1] = second;
+        node.operands[2] = third;
+        expressionNodes.push_back(node);
+        return expressionNodes.size() - 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t LayoutImpl::addConstantNode(float constant)
+    {
+        auto node = addExpressionNode(Operation::Value);
+        expressionNodes[node].value = constant;
+        return node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string LayoutImpl::getNodePlaceholder(std::size_t node)
+    {
+        // Already compiled parts are put back into the expression as a token that can't occur in a normal expression
+        return "\x01" + tgui::to_string(node) + "\x01";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    float LayoutImpl::parseLayoutString(std::string expression)
+    std::size_t LayoutImpl::compileExpression(std::string expression)
     {
         // Empty strings have value 0 (although this might indicate a mistake in the expression, it also happens on unary plus and minus)
         expression = tgui::trim(expression);
         if (expression.empty())
-            return 0;
+            return addConstantNode(0);
 
-        // First calculate expressions withing brackets
+        // First compile expressions withing brackets
         auto openBracketPos = expression.rfind('(');
         while (openBracketPos != std::string::npos)
         {
             auto closeBracketPos = expression.find(')', openBracketPos + 1);
             if (closeBracketPos == std::string::npos)
-                return 0; // Opening bracket without matching closing bracket
+                return addConstantNode(0); // Opening bracket without matching closing bracket
 
             std::string newExpression;
-            if ((openBracketPos >= 3) && (expression.substr(openBracketPos - 3, 3) == "max"))
+            if ((openBracketPos >= 3) && ((expression.substr(openBracketPos - 3, 3) == "max") || (expression.substr(openBracketPos - 3, 3) == "min")))
             {
+                const bool maximum = (expression.substr(openBracketPos - 3, 3) == "max");
                 newExpression += expression.substr(0, openBracketPos - 3);
 
                 auto commaPos = expression.find(',', openBracketPos);
                 if (commaPos < closeBracketPos)
                 {
-                    auto prevPos = openBracketPos;
-                    float maxNum = -std::numeric_limits<float>::infinity();
-                    while (commaPos < closeBracketPos)
-                    {
-                        maxNum = std::max(maxNum, parseLayoutString(expression.substr(prevPos + 1, commaPos - prevPos - 1)));
-
-                        prevPos = commaPos;
-                        commaPos = expression.find(',', prevPos + 1);
-                    }
-
-                    maxNum = std::max(maxNum, parseLayoutString(expression.substr(prevPos + 1, closeBracketPos - prevPos - 1)));
-                    newExpression += tgui::to_string(maxNum);
-                }
-                else
-                    newExpression += tgui::to_string(parseLayoutString(expression.substr(openBracketPos + 1, closeBracketPos - openBracketPos - 1)));
-            }
-            else if ((openBracketPos >= 3) && (expression.substr(openBracketPos - 3, 3) == "min"))
-            {
-                newExpression += expression.substr(0, openBracketPos - 3);
+                    const Operation foldOperation = maximum ? Operation::Maximum : Operation::Minimum;
 
-                auto commaPos = expression.find(',', openBracketPos);
-                if (commaPos < closeBracketPos)
-                {
                     auto prevPos = openBracketPos;
-                    float maxNum = std::numeric_limits<float>::infinity();
+                    auto node = addConstantNode(maximum ? -std::numeric_limits<float>::infinity() : std::numeric_limits<float>::infinity());
                     while (commaPos < closeBracketPos)
                     {
-                        maxNum = std::min(maxNum, parseLayoutString(expression.substr(prevPos + 1, commaPos - prevPos - 1)));
+                        node = addExpressionNode(foldOperation, node, compileExpression(expression.substr(prevPos + 1, commaPos - prevPos - 1)));
 
                         prevPos = commaPos;
                         commaPos = expression.find(',', prevPos + 1);
                     }
 
-                    maxNum = std::min(maxNum, parseLayoutString(expression.substr(prevPos + 1, closeBracketPos - prevPos - 1)));
-                    newExpression += tgui::to_string(maxNum);
+                    node = addExpressionNode(foldOperation, node, compileExpression(expression.substr(prevPos + 1, closeBracketPos - prevPos - 1)));
+                    newExpression += getNodePlaceholder(node);
                 }
                 else
-                    newExpression += tgui::to_string(parseLayoutString(expression.substr(openBracketPos + 1, closeBracketPos - openBracketPos - 1)));
+                    newExpression += getNodePlaceholder(compileExpression(expression.substr(openBracketPos + 1, closeBracketPos - openBracketPos - 1)));
             }
             else if ((openBracketPos >= 5) && (expression.substr(openBracketPos - 5, 5) == "range"))
             {
                 newExpression += expression.substr(0, openBracketPos - 5);
 
                 auto firstCommaPos = expression.find(',', openBracketPos);
-                if (firstCommaPos < closeBracketPos)
+                auto secondCommaPos = (firstCommaPos < closeBracketPos) ? expression.find(',', firstCommaPos + 1) : std::string::npos;
+                auto thirdCommaPos = (secondCommaPos < closeBracketPos) ? expression.find(',', secondCommaPos + 1) : std::string::npos;
+                if ((firstCommaPos < closeBracketPos) && (secondCommaPos < closeBracketPos) && (thirdCommaPos > closeBracketPos))
                 {
-                    auto secondCommaPos = expression.find(',', firstCommaPos + 1);
-                    if (secondCommaPos < closeBracketPos)
-                    {
-                        auto thirdCommaPos = expression.find(',', secondCommaPos + 1);
-                        if (thirdCommaPos > closeBracketPos)
-                        {
-                            float minValue = parseLayoutString(expression.substr(openBracketPos + 1, firstCommaPos - openBracketPos - 1));
-                            float maxValue = parseLayoutString(expression.substr(firstCommaPos + 1, secondCommaPos - firstCommaPos - 1));
-                            float wantedValue = parseLayoutString(expression.substr(secondCommaPos + 1, closeBracketPos - secondCommaPos - 1));
-                            newExpression += tgui::to_string(std::max(std::min(wantedValue, maxValue), minValue));
-                        }
-                        else // There shouldn't be a third comma
-                            newExpression += "0";
-                    }
-                    else // Second comma missing
-                        newExpression += "0";
+                    auto minValue = compileExpression(expression.substr(openBracketPos + 1, firstCommaPos - openBracketPos - 1));
+                    auto maxValue = compileExpression(expression.substr(firstCommaPos + 1, secondCommaPos - firstCommaPos - 1));
+                    auto wantedValue = compileExpression(expression.substr(secondCommaPos + 1, closeBracketPos - secondCommaPos - 1));
+                    newExpression += getNodePlaceholder(addExpressionNode(Operation::Maximum, addExpressionNode(Operation::Minimum, wantedValue, maxValue), minValue));
                 }
-                else // First comma missing
+                else // There should be exactly three parameters
                     newExpression += "0";
             }
             else // Normal set of brackets
             {
                 newExpression += expression.substr(0, openBracketPos);
-                newExpression += tgui::to_string(parseLayoutString(expression.substr(openBracketPos + 1, closeBracketPos - openBracketPos - 1)));
+                newExpression += getNodePlaceholder(compileExpression(expression.substr(openBracketPos + 1, closeBracketPos - openBracketPos - 1)));
             }
             newExpression += expression.substr(closeBracketPos + 1);
 
@@ -325,12 +610,12 @@ namespace tgui
                 }
 
                 if (matchingColonPos == std::string::npos)
-                    return 0; // '?' without matching ':'
+                    return addConstantNode(0); // '?' without matching ':'
 
-                if (parseLayoutString(expression.substr(0, questionMarkPos)) != 0)
-                    return parseLayoutString(expression.substr(questionMarkPos + 1, matchingColonPos - questionMarkPos - 1));
-                else
-                    return parseLayoutString(expression.substr(matchingColonPos + 1));
+                auto condition = compileExpression(expression.substr(0, questionMarkPos));
+                auto trueValue = compileExpression(expression.substr(questionMarkPos + 1, matchingColonPos - questionMarkPos - 1));
+                auto falseValue = compileExpression(expression.substr(matchingColonPos + 1));
+                return addExpressionNode(Operation::Conditional, condition, trueValue, falseValue);
             }
             else // if-then-else instead of ?:
             {
@@ -363,7 +648,7 @@ namespace tgui
                 }
 
                 if (thenPos == std::string::npos)
-                    return 0; // 'if' without matching 'then'
+                    return addConstantNode(0); // 'if' without matching 'then'
 
                 auto elsePos = expression.find("else", thenPos + 4);
                 nextifPos = expression.find("if", thenPos + 4);
@@ -394,27 +679,27 @@ namespace tgui
                 }
 
                 if (elsePos == std::string::npos)
-                    return 0; // 'if' and 'then' found without matching 'else'
+                    return addConstantNode(0); // 'if' and 'then' found without matching 'else'
 
-                if (parseLayoutString(expression.substr(ifPos + 2, thenPos - ifPos - 2)) != 0)
-                    expression = expression.substr(0, ifPos) + tgui::to_string(parseLayoutString(expression.substr(thenPos + 4, elsePos - thenPos - 4)));
-                else
-                    expression = expression.substr(0, ifPos) + tgui::to_string(parseLayoutString(expression.substr(elsePos + 4)));
+                auto condition = compileExpression(expression.substr(ifPos + 2, thenPos - ifPos - 2));
+                auto trueValue = compileExpression(expression.substr(thenPos + 4, elsePos - thenPos - 4));
+                auto falseValue = compileExpression(expression.substr(elsePos + 4));
+                expression = expression.substr(0, ifPos) + getNodePlaceholder(addExpressionNode(Operation::Conditional, condition, trueValue, falseValue));
             }
         }
 
         // All brackets and conditionals should be remove by now
         if ((expression.find(')') != std::string::npos) || (expression.find(':') != std::string::npos))
-            return 0;
+            return addConstantNode(0);
 
         auto andPos = expression.rfind("&&");
         auto orPos = expression.rfind("||");
         if ((andPos != std::string::npos) || (orPos != std::string::npos))
         {
             if ((andPos == std::string::npos) || (orPos < andPos))
-                return parseLayoutString(expression.substr(0, orPos)) || parseLayoutString(expression.substr(orPos + 2));
+                return addExpressionNode(Operation::Or, compileExpression(expression.substr(0, orPos)), compileExpression(expression.substr(orPos + 2)));
             else
-                return parseLayoutString(expression.substr(0, andPos)) && parseLayoutString(expression.substr(andPos + 2));
+                return addExpressionNode(Operation::And, compileExpression(expression.substr(0, andPos)), compileExpression(expression.substr(andPos + 2)));
         }
 
         andPos = expression.rfind("and");
@@ -422,9 +707,9 @@ namespace tgui
         if ((andPos != std::string::npos) || (orPos != std::string::npos))
         {
             if ((andPos == std::string::npos) || (orPos < andPos))
-                return parseLayoutString(expression.substr(0, orPos)) || parseLayoutString(expression.substr(orPos + 2));
+                return addExpressionNode(Operation::Or, compileExpression(expression.substr(0, orPos)), compileExpression(expression.substr(orPos + 2)));
             else
-                return parseLayoutString(expression.substr(0, andPos)) && parseLayoutString(expression.substr(andPos + 3));
+                return addExpressionNode(Operation::And, compileExpression(expression.substr(0, andPos)), compileExpression(expression.substr(andPos + 3)));
         }
 
         auto equalsPos = expression.rfind("==");
@@ -432,9 +717,9 @@ namespace tgui
         if ((equalsPos != std::string::npos) || (notEqualsPos != std::string::npos))
         {
             if ((equalsPos == std::string::npos) || (notEqualsPos < equalsPos))
-                return parseLayoutString(expression.substr(0, notEqualsPos)) != parseLayoutString(expression.substr(notEqualsPos + 2));
+                return addExpressionNode(Operation::NotEqual, compileExpression(expression.substr(0, notEqualsPos)), compileExpression(expression.substr(notEqualsPos + 2)));
             else
-                return parseLayoutString(expression.substr(0, equalsPos)) == parseLayoutString(expression.substr(equalsPos + 2));
+                return addExpressionNode(Operation::Equal, compileExpression(expression.substr(0, equalsPos)), compileExpression(expression.substr(equalsPos + 2)));
         }
 
         auto lessThanPos = expression.rfind('<');
@@ -446,16 +731,16 @@ namespace tgui
             if ((greaterThanPos != std::string::npos) && ((lessThanPos == std::string::npos) || (greaterThanPos < lessThanPos)))
             {
                 if ((greaterEqualPos != std::string::npos) && (greaterEqualPos == greaterThanPos))
-                    return parseLayoutString(expression.substr(0, greaterEqualPos)) >= parseLayoutString(expression.substr(greaterEqualPos + 2));
+                    return addExpressionNode(Operation::GreaterOrEqual, compileExpression(expression.substr(0, greaterEqualPos)), compileExpression(expression.substr(greaterEqualPos + 2)));
                 else
-                    return parseLayoutString(expression.substr(0, greaterThanPos)) > parseLayoutString(expression.substr(greaterThanPos + 1));
+                    return addExpressionNode(Operation::GreaterThan, compileExpression(expression.substr(0, greaterThanPos)), compileExpression(expression.substr(greaterThanPos + 1)));
             }
             else // < or <=
             {
                 if ((lessEqualPos != std::string::npos) && (lessEqualPos == lessThanPos))
-                    return parseLayoutString(expression.substr(0, lessEqualPos)) <= parseLayoutString(expression.substr(lessEqualPos + 2));
+                    return addExpressionNode(Operation::LessOrEqual, compileExpression(expression.substr(0, lessEqualPos)), compileExpression(expression.substr(lessEqualPos + 2)));
                 else
-                    return parseLayoutString(expression.substr(0, lessThanPos)) < parseLayoutString(expression.substr(lessThanPos + 1));
+                    return addExpressionNode(Operation::LessThan, compileExpression(expression.substr(0, lessThanPos)), compileExpression(expression.substr(lessThanPos + 1)));
             }
         }
 
@@ -465,17 +750,17 @@ namespace tgui
         while ((plusPos != std::string::npos) || (minusPos != std::string::npos))
         {
             if ((plusPos != std::string::npos) && ((minusPos == std::string::npos) || (minusPos < plusPos)))
-                return parseLayoutString(expression.substr(0, plusPos)) + parseLayoutString(expression.substr(plusPos + 1));
+                return addExpressionNode(Operation::Plus, compileExpression(expression.substr(0, plusPos)), compileExpression(expression.substr(plusPos + 1)));
             else
             {
                 // The minus might be a unary instead of a binary operator
                 auto leftExpr = tgui::trim(expression.substr(0, minusPos));
                 if (leftExpr.empty())
-                    return -parseLayoutString(expression.substr(minusPos + 1));
+                    return addExpressionNode(Operation::Multiplies, addConstantNode(-1), compileExpression(expression.substr(minusPos + 1)));
                 else if ((leftExpr.back() == '+') || (leftExpr.back() == '-') || (leftExpr.back() == '*') || (leftExpr.back() == '/') || (leftExpr.back() == '%'))
                     lastPos = minusPos - 1;
                 else
-                    return parseLayoutString(expression.substr(0, minusPos)) - parseLayoutString(expression.substr(minusPos + 1));
+                    return addExpressionNode(Operation::Minus, compileExpression(expression.substr(0, minusPos)), compileExpression(expression.substr(minusPos + 1)));
             }
 
             plusPos = expression.rfind('+', lastPos);
@@ -492,7 +777,7 @@ namespace tgui
                 if ((dividePos == std::string::npos) || (dividePos < multiplyPos))
                 {
                     if ((modulusPos == std::string::npos) || (modulusPos < multiplyPos))
-                        return parseLayoutString(expression.substr(0, multiplyPos)) * parseLayoutString(expression.substr(multiplyPos + 1));
+                        return addExpressionNode(Operation::Multiplies, compileExpression(expression.substr(0, multiplyPos)), compileExpression(expression.substr(multiplyPos + 1)));
                 }
             }
             if (dividePos != std::string::npos)
@@ -500,7 +785,7 @@ namespace tgui
                 if ((multiplyPos == std::string::npos) || (multiplyPos < dividePos))
                 {
                     if ((modulusPos == std::string::npos) || (modulusPos < dividePos))
-                        return parseLayoutString(expression.substr(0, dividePos)) / parseLayoutString(expression.substr(dividePos + 1));
+                        return addExpressionNode(Operation::Divides, compileExpression(expression.substr(0, dividePos)), compileExpression(expression.substr(dividePos + 1)));
                 }
             }
             if (modulusPos != std::string::npos)
@@ -508,14 +793,18 @@ namespace tgui
                 if ((multiplyPos == std::string::npos) || (multiplyPos < modulusPos))
                 {
                     if ((dividePos == std::string::npos) || (dividePos < modulusPos))
-                        return std::fmod(parseLayoutString(expression.substr(0, modulusPos)),  parseLayoutString(expression.substr(modulusPos + 1)));
+                        return addExpressionNode(Operation::Modulus, compileExpression(expression.substr(0, modulusPos)), compileExpression(expression.substr(modulusPos + 1)));
                 }
             }
         }
 
-        // The expression might reference to a widget instead of being a constant
+        // The expression might be a part that was already compiled
         assert(!expression.empty());
         expression = tgui::toLower(tgui::trim(expression));
+        if ((expression.size() > 2) && (expression.front() == '\x01') && (expression.back() == '\x01') && (expression.find('\x01', 1) == expression.size()-1))
+            return static_cast<std::size_t>(tgui::stoi(expression.substr(1, expression.size() - 2)));
+
+        // The expression might reference to a widget instead of being a constant
         if ((expression.substr(expression.size()-1) == "x")
          || (expression.substr(expression.size()-1) == "y")
          || (expression.substr(expression.size()-1) == "w") // width
@@ -527,125 +816,174 @@ namespace tgui
          || (expression.size() >= 5 && expression.substr(expression.size()-5) == "right")
          || (expression.size() >= 6 && expression.substr(expression.size()-6) == "bottom"))
         {
-            if (parentWidget)
-                return parseWidgetName(expression, parentWidget);
-            else
-                return 0;
+            return compileWidgetReference(expression);
         }
 
-        // The string no longer contains operators, so return the value that it contains
-        return static_cast<float>(tgui::stof(expression));
+        // The string no longer contains operators, so it contains a constant
+        return addConstantNode(static_cast<float>(tgui::stof(expression)));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    float LayoutImpl::parseWidgetName(const std::string& expression, Widget* widget, const std::string& alreadyParsedPart)
+    std::size_t LayoutImpl::compileWidgetReference(std::string expression)
     {
-        if (expression == "x" || expression == "left")
+        WidgetReference reference;
+        std::string alreadyParsedPart;
+        while (true)
         {
-            if (boundCallbacks.find(alreadyParsedPart + "position") == boundCallbacks.end())
+            if (expression == "x" || expression == "left")
+                reference.property = WidgetProperty::Left;
+            else if (expression == "y" || expression == "top")
+                reference.property = WidgetProperty::Top;
+            else if (expression == "w" || expression == "width")
+                reference.property = WidgetProperty::Width;
+            else if (expression == "h" || expression == "height")
+                reference.property = WidgetProperty::Height;
+            else if (expression == "right")
+                reference.property = WidgetProperty::Right;
+            else if (expression == "bottom")
+                reference.property = WidgetProperty::Bottom;
+            else
             {
-                boundCallbacks.insert(alreadyParsedPart + "position");
-                widget->connect("PositionChanged", std::bind(resetLayout, shared_from_this(), std::bind(getWidgetLeft, widget)));
-            }
+                auto dotPos = expression.find('.');
+                if (dotPos == std::string::npos)
+                    return addConstantNode(0); // Illegal expression
 
-            return widget->getPosition().x;
-        }
-        else if (expression == "y" || expression == "top")
-        {
-            if (boundCallbacks.find(alreadyParsedPart + "position") == boundCallbacks.end())
-            {
-                boundCallbacks.insert(alreadyParsedPart + "position");
-                widget->connect("PositionChanged", std::bind(resetLayout, shared_from_this(), std::bind(getWidgetTop, widget)));
-            }
+                std::string widgetName = expression.substr(0, dotPos);
+                if (widgetName == "parent" || widgetName == "&")
+                {
+                    reference.path.push_back("");
+                    alreadyParsedPart = "parent.";
+                }
+                else if (!widgetName.empty())
+                {
+                    reference.path.push_back(widgetName);
+                    alreadyParsedPart = widgetName + ".";
+                }
+                else
+                    return addConstantNode(0); // Illegal expression
 
-            return widget->getPosition().y;
-        }
-        else if (expression == "w" || expression == "width")
-        {
-            if (boundCallbacks.find(alreadyParsedPart + "size") == boundCallbacks.end())
-            {
-                boundCallbacks.insert(alreadyParsedPart + "size");
-                widget->connect("SizeChanged", std::bind(resetLayout, shared_from_this(), std::bind(getWidgetWidth, widget)));
+                expression = expression.substr(dotPos + 1);
+                continue;
             }
 
-            return widget->getSize().x;
+            break;
         }
-        else if (expression == "h" || expression == "height")
-        {
-            if (boundCallbacks.find(alreadyParsedPart + "size") == boundCallbacks.end())
-            {
-                boundCallbacks.insert(alreadyParsedPart + "size");
-                widget->connect("SizeChanged", std::bind(resetLayout, shared_from_this(), std::bind(getWidgetHeight, widget)));
-            }
 
-            return widget->getSize().y;
-        }
-        else if (expression == "right")
-        {
-            if (boundCallbacks.find(alreadyParsedPart + "position") == boundCallbacks.end())
-            {
-                boundCallbacks.insert(alreadyParsedPart + "position");
-                widget->connect("PositionChanged", std::bind(resetLayout, shared_from_this(), std::bind(getWidgetLeft, widget)));
-            }
-            if (boundCallbacks.find(alreadyParsedPart + "size") == boundCallbacks.end())
-            {
-                boundCallbacks.insert(alreadyParsedPart + "size");
-                widget->connect("SizeChanged", std::bind(resetLayout, shared_from_this(), std::bind(getWidgetWidth, widget)));
-            }
+        reference.positionCallbackKey = alreadyParsedPart + "position";
+        reference.sizeCallbackKey = alreadyParsedPart + "size";
+        widgetReferences.push_back(std::move(reference));
+        return addExpressionNode(Operation::String, widgetReferences.size() - 1);
+    }
 
-            return widget->getPosition().x + widget->getSize().x;
-        }
-        else if (expression == "bottom")
-        {
-            if (boundCallbacks.find(alreadyParsedPart + "position") == boundCallbacks.end())
-            {
-                boundCallbacks.insert(alreadyParsedPart + "position");
-                widget->connect("PositionChanged", std::bind(resetLayout, shared_from_this(), std::bind(getWidgetTop, widget)));
-            }
-            if (boundCallbacks.find(alreadyParsedPart + "size") == boundCallbacks.end())
-            {
-                boundCallbacks.insert(alreadyParsedPart + "size");
-                widget->connect("SizeChanged", std::bind(resetLayout, shared_from_this(), std::bind(getWidgetHeight, widget)));
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            return widget->getPosition().y + widget->getSize().y;
+    float LayoutImpl::evaluateExpression(std::size_t node)
+    {
+        const auto& operandNodes = expressionNodes[node].operands;
+        switch (expressionNodes[node].operation)
+        {
+        case Operation::Value:
+            return expressionNodes[node].value;
+        case Operation::String:
+            return evaluateWidgetReference(widgetReferences[operandNodes[0]]);
+        case Operation::Plus:
+            return evaluateExpression(operandNodes[0]) + evaluateExpression(operandNodes[1]);
+        case Operation::Minus:
+            return evaluateExpression(operandNodes[0]) - evaluateExpression(operandNodes[1]);
+        case Operation::Multiplies:
+            return evaluateExpression(operandNodes[0]) * evaluateExpression(operandNodes[1]);
+        case Operation::Divides:
+            return evaluateExpression(operandNodes[0]) / evaluateExpression(operandNodes[1]);
+        case Operation::Modulus:
+            return std::fmod(evaluateExpression(operandNodes[0]), evaluateExpression(operandNodes[1]));
+        case Operation::And:
+            return evaluateExpression(operandNodes[0]) && evaluateExpression(operandNodes[1]);
+        case Operation::Or:
+            return evaluateExpression(operandNodes[0]) || evaluateExpression(operandNodes[1]);
+        case Operation::LessThan:
+            return evaluateExpression(operandNodes[0]) < evaluateExpression(operandNodes[1]);
+        case Operation::LessOrEqual:
+            return evaluateExpression(operandNodes[0]) <= evaluateExpression(operandNodes[1]);
+        case Operation::GreaterThan:
+            return evaluateExpression(operandNodes[0]) > evaluateExpression(operandNodes[1]);
+        case Operation::GreaterOrEqual:
+            return evaluateExpression(operandNodes[0]) >= evaluateExpression(operandNodes[1]);
+        case Operation::Equal:
+            return evaluateExpression(operandNodes[0]) == evaluateExpression(operandNodes[1]);
+        case Operation::NotEqual:
+            return evaluateExpression(operandNodes[0]) != evaluateExpression(operandNodes[1]);
+        case Operation::Minimum:
+            return std::min(evaluateExpression(operandNodes[0]), evaluateExpression(operandNodes[1]));
+        case Operation::Maximum:
+            return std::max(evaluateExpression(operandNodes[0]), evaluateExpression(operandNodes[1]));
+        case Operation::Conditional:
+            // Only the chosen branch is evaluated, so that widgets in the other branch don't get bound yet
+            if (evaluateExpression(operandNodes[0]) != 0)
+                return evaluateExpression(operandNodes[1]);
+            else
+                return evaluateExpression(operandNodes[2]);
         }
 
-        auto dotPos = expression.find('.');
-        if (dotPos != std::string::npos)
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float LayoutImpl::evaluateWidgetReference(const WidgetReference& reference)
+    {
+        if (!parentWidget)
+            return 0;
+
+        // The widgets are looked up on every evaluation as they might have been added or removed since the last time
+        Widget* widget = parentWidget;
+        for (auto& widgetName : reference.path)
         {
-            std::string widgetName = expression.substr(0, dotPos);
-            if (widgetName == "parent" || widgetName == "&")
+            if (widgetName.isEmpty())
             {
-                if (widget->getParent())
-                    return parseWidgetName(expression.substr(dotPos+1), widget->getParent(), "parent.");
-                else
+                widget = widget->getParent();
+                if (!widget)
                     return 0;
             }
-            else if (!widgetName.empty())
+            else
             {
+                Widget* widgetToBind = nullptr;
+
                 // If the widget is a container, search in its children first
                 Container* container = dynamic_cast<Container*>(widget);
                 if (container != nullptr)
-                {
-                    auto widgetToBind = container->get(widgetName);
-                    if (widgetToBind)
-                        return parseWidgetName(expression.substr(dotPos+1), widgetToBind.get(), widgetName + ".");
-                }
+                    widgetToBind = container->get(widgetName).get();
 
                 // If the widget has a parent, look for a sibling
-                if (widget->getParent())
-                {
-                    auto widgetToBind = widget->getParent()->get(widgetName);
-                    if (widgetToBind)
-                        return parseWidgetName(expression.substr(dotPos+1), widgetToBind.get(), widgetName + ".");
-                }
+                if (!widgetToBind && widget->getParent())
+                    widgetToBind = widget->getParent()->get(widgetName).get();
+
+                if (!widgetToBind)
+                    return 0;
+
+                widget = widgetToBind;
             }
         }
 
-        // Illegal expression
-        return 0;
+        const bool dependsOnPosition = (reference.property != WidgetProperty::Width) && (reference.property != WidgetProperty::Height);
+        const bool dependsOnSize = (reference.property != WidgetProperty::Left) && (reference.property != WidgetProperty::Top);
+        if (dependsOnPosition)
+            bindWidget(widget, reference.positionCallbackKey, reference.property, true, false);
+        if (dependsOnSize)
+            bindWidget(widget, reference.sizeCallbackKey, reference.property, false, true);
+
+        return getWidgetProperty(widget, reference.property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutImpl::bindWidget(Widget* widget, const std::string& callbackKey, WidgetProperty property, bool position, bool size)
+    {
+        if (boundCallbacks.find(callbackKey) == boundCallbacks.end())
+        {
+            boundCallbacks.insert(callbackKey);
+            addWidgetDependency(widget, property, position, size);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -684,6 +1022,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Layout::Layout(const std::shared_ptr<LayoutImpl>& impl) :
+        m_impl(impl)
+    {
+        m_impl->attachedLayouts.insert(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Layout::~Layout()
     {
         m_impl->attachedLayouts.erase(this);
@@ -1077,62 +1423,42 @@ namespace tgui
 
     Layout bindLeft(Widget::Ptr widget)
     {
-        Layout result;
-        result.getImpl()->value = widget->getPosition().x;
-        widget->connect("PositionChanged", std::bind(resetLayout, result.getImpl(), std::bind(getWidgetLeft, widget.get())));
-        return result;
+        return bindWidgetProperty(widget, LayoutImpl::WidgetProperty::Left);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout bindTop(Widget::Ptr widget)
     {
-        Layout result;
-        result.getImpl()->value = widget->getPosition().y;
-        widget->connect("PositionChanged", std::bind(resetLayout, result.getImpl(), std::bind(getWidgetTop, widget.get())));
-        return result;
+        return bindWidgetProperty(widget, LayoutImpl::WidgetProperty::Top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout bindWidth(Widget::Ptr widget)
     {
-        Layout result;
-        result.getImpl()->value = widget->getSize().x;
-        widget->connect("SizeChanged", std::bind(resetLayout, result.getImpl(), std::bind(getWidgetWidth, widget.get())));
-        return result;
+        return bindWidgetProperty(widget, LayoutImpl::WidgetProperty::Width);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout bindHeight(Widget::Ptr widget)
     {
-        Layout result;
-        result.getImpl()->value = widget->getSize().y;
-        widget->connect("SizeChanged", std::bind(resetLayout, result.getImpl(), std::bind(getWidgetHeight, widget.get())));
-        return result;
+        return bindWidgetProperty(widget, LayoutImpl::WidgetProperty::Height);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout bindRight(Widget::Ptr widget)
     {
-        Layout result;
-        result.getImpl()->value = widget->getPosition().x + widget->getSize().x;
-        widget->connect("PositionChanged", std::bind(resetLayout, result.getImpl(), std::bind(getWidgetRight, widget.get())));
-        widget->connect("SizeChanged", std::bind(resetLayout, result.getImpl(), std::bind(getWidgetRight, widget.get())));
-        return result;
+        return bindWidgetProperty(widget, LayoutImpl::WidgetProperty::Right);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout bindBottom(Widget::Ptr widget)
     {
-        Layout result;
-        result.getImpl()->value = widget->getPosition().y + widget->getSize().y;
-        widget->connect("PositionChanged", std::bind(resetLayout, result.getImpl(), std::bind(getWidgetBottom, widget.get())));
-        widget->connect("SizeChanged", std::bind(resetLayout, result.getImpl(), std::bind(getWidgetBottom, widget.get())));
-        return result;
+        return bindWidgetProperty(widget, LayoutImpl::WidgetProperty::Bottom);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1230,16 +1556,7 @@ namespace tgui
 
     Layout bindIf(Layout condition, Layout trueExpr, Layout falseExpr)
     {
-        tgui::Layout result;
-        result.getImpl()->operation = LayoutImpl::Operation::Conditional;
-        result.getImpl()->operands.push_back(condition.getImpl());
-        result.getImpl()->operands.push_back(trueExpr.getImpl());
-        result.getImpl()->operands.push_back(falseExpr.getImpl());
-        condition.getImpl()->parents.insert(result.getImpl().get());
-        trueExpr.getImpl()->parents.insert(result.getImpl().get());
-        falseExpr.getImpl()->parents.insert(result.getImpl().get());
-        result.getImpl()->recalculate();
-        return result;
+        return createOperation(LayoutImpl::Operation::Conditional, {condition.getImpl(), trueExpr.getImpl(), falseExpr.getImpl()});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -51,27 +51,27 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::map<std::string, std::function<Widget::Ptr()>> BaseTheme::m_constructors =
+    std::map<WidgetTypeId, std::function<Widget::Ptr()>> BaseTheme::m_constructors =
         {
-            {"button", std::make_shared<Button>},
-            {"chatbox", std::make_shared<ChatBox>},
-            {"checkbox", std::make_shared<CheckBox>},
-            {"childwindow", std::make_shared<ChildWindow>},
-            {"combobox", std::make_shared<ComboBox>},
-            {"editbox", std::make_shared<EditBox>},
-            {"knob", std::make_shared<Knob>},
-            {"label", std::make_shared<Label>},
-            {"listbox", std::make_shared<ListBox>},
-            {"menubar", std::make_shared<MenuBar>},
-            {"messagebox", std::make_shared<MessageBox>},
-            {"panel", std::make_shared<Panel>},
-            {"progressbar", std::make_shared<ProgressBar>},
-            {"radiobutton", std::make_shared<RadioButton>},
-            {"scrollbar", std::make_shared<Scrollbar>},
-            {"slider", std::make_shared<Slider>},
-            {"spinbutton", std::make_shared<SpinButton>},
-            {"tab", std::make_shared<Tab>},
-            {"textbox", std::make_shared<TextBox>}
+            {WidgetTypes::Button, std::make_shared<Button>},
+            {WidgetTypes::ChatBox, std::make_shared<ChatBox>},
+            {WidgetTypes::CheckBox, std::make_shared<CheckBox>},
+            {WidgetTypes::ChildWindow, std::make_shared<ChildWindow>},
+            {WidgetTypes::ComboBox, std::make_shared<ComboBox>},
+            {WidgetTypes::EditBox, std::make_shared<EditBox>},
+            {WidgetTypes::Knob, std::make_shared<Knob>},
+            {WidgetTypes::Label, std::make_shared<Label>},
+            {WidgetTypes::ListBox, std::make_shared<ListBox>},
+            {WidgetTypes::MenuBar, std::make_shared<MenuBar>},
+            {WidgetTypes::MessageBox, std::make_shared<MessageBox>},
+            {WidgetTypes::Panel, std::make_shared<Panel>},
+            {WidgetTypes::ProgressBar, std::make_shared<ProgressBar>},
+            {WidgetTypes::RadioButton, std::make_shared<RadioButton>},
+            {WidgetTypes::Scrollbar, std::make_shared<Scrollbar>},
+            {WidgetTypes::Slider, std::make_shared<Slider>},
+            {WidgetTypes::SpinButton, std::make_shared<SpinButton>},
+            {WidgetTypes::Tab, std::make_shared<Tab>},
+            {WidgetTypes::TextBox, std::make_shared<TextBox>}
         };
 
     std::shared_ptr<BaseThemeLoader> BaseTheme::m_themeLoader = std::make_shared<DefaultThemeLoader>();
@@ -93,7 +93,7 @@ namespace tgui
 
     void BaseTheme::setConstructFunction(const std::string& type, const std::function<Widget::Ptr()>& constructor)
     {
-        m_constructors[toLower(type)] = constructor;
+        m_constructors[WidgetTypes::getId(type)] = constructor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -127,17 +127,17 @@ namespace tgui
     {
         className = toLower(className);
 
-        std::string widgetType;
+        WidgetTypeId widgetType;
         if (m_filename != "")
         {
             if (m_widgetTypes.find(className) != m_widgetTypes.end())
                 widgetType = m_widgetTypes[className];
             else
-                widgetType = toLower(m_themeLoader->load(m_filename, className, m_widgetProperties[className]));
+                widgetType = WidgetTypes::getId(m_themeLoader->load(m_filename, className, m_widgetProperties[className]));
         }
         else // Load the white theme
         {
-            widgetType = className;
+            widgetType = WidgetTypes::getId(className);
         }
 
         auto constructor = m_constructors[widgetType];
@@ -153,7 +153,7 @@ namespace tgui
             return WidgetConverter{widget};
         }
         else
-            throw Exception{"Failed to load widget of type '" + widgetType + "'. No constructor function was set for that type."};
+            throw Exception{"Failed to load widget of type '" + WidgetTypes::getName(widgetType) + "'. No constructor function was set for that type."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -172,7 +172,7 @@ namespace tgui
 
         for (auto& widget : m_widgets)
         {
-            std::string widgetType;
+            WidgetTypeId widgetType;
             if (m_filename != "")
             {
                 if (m_widgetTypes.find(widget.second) != m_widgetTypes.end())
@@ -180,11 +180,11 @@ namespace tgui
                 else
                 {
                     m_widgetProperties[widget.second].clear();
-                    widgetType = toLower(m_themeLoader->load(m_filename, widget.second, m_widgetProperties[widget.second]));
+                    widgetType = WidgetTypes::getId(m_themeLoader->load(m_filename, widget.second, m_widgetProperties[widget.second]));
                 }
             }
             else
-                widgetType = widget.second;
+                widgetType = WidgetTypes::getId(widget.second);
 
             m_widgetTypes[widget.second] = widgetType;
             widgetReload(widget.first, filename, widget.second, false);
@@ -226,7 +226,7 @@ namespace tgui
         className = toLower(className);
 
         // If we don't have the class name in the cache then check if the theme loader has it
-        std::string widgetType;
+        WidgetTypeId widgetType;
         if (m_filename != "")
         {
             if (m_widgetTypes.find(className) != m_widgetTypes.end())
@@ -234,14 +234,14 @@ namespace tgui
             else
             {
                 m_widgetProperties[className].clear();
-                widgetType = toLower(m_themeLoader->load(m_filename, className, m_widgetProperties[className]));
+                widgetType = WidgetTypes::getId(m_themeLoader->load(m_filename, className, m_widgetProperties[className]));
             }
         }
         else // Load the white theme
         {
-            widgetType = className;
+            widgetType = WidgetTypes::getId(className);
             if (!m_constructors[widgetType])
-                throw Exception{"Failed to reload widget of type '" + widgetType + "'. No constructor function was set for that type."};
+                throw Exception{"Failed to reload widget of type '" + className + "'. No constructor function was set for that type."};
         }
 
         widgetAttached(widget.get());
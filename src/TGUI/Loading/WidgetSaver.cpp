@@ -65,6 +65,17 @@ namespace
         str += ")";
         return str;
     }
+
+    const tgui::WidgetSaver::SaveFunction& getSaveFunctionOfWidget(const tgui::Widget& widget)
+    {
+        // Custom widgets that change m_callback.widgetType directly instead of calling setWidgetType have no type id,
+        // or still have the id of the widget they inherit from. Their save function is looked up by name instead.
+        const tgui::WidgetTypeId typeId = widget.getWidgetTypeId();
+        if ((typeId != tgui::WidgetTypes::Unknown) && (tgui::WidgetTypes::getName(typeId) == widget.getWidgetType()))
+            return tgui::WidgetSaver::getSaveFunction(typeId);
+        else
+            return tgui::WidgetSaver::getSaveFunction(widget.getWidgetType());
+    }
 }
 
 // Hidden functions
@@ -125,7 +136,7 @@ namespace tgui
         auto node = saveWidget(container);
         for (auto& child : container->getWidgets())
         {
-            auto& saveFunction = WidgetSaver::getSaveFunction(toLower(child->getWidgetType()));
+            auto& saveFunction = getSaveFunctionOfWidget(*child);
             if (saveFunction)
                 node->children.emplace_back(saveFunction(WidgetConverter{child}));
             else
@@ -544,30 +555,30 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::map<std::string, WidgetSaver::SaveFunction> WidgetSaver::m_saveFunctions =
+    std::map<WidgetTypeId, WidgetSaver::SaveFunction> WidgetSaver::m_saveFunctions =
         {
-            {"widget", saveWidget},
-            {"container", saveContainer},
-            {"button", saveButton},
-            {"canvas", saveWidget},
-            {"chatbox", saveChatBox},
-            {"checkbox", saveRadioButton},
-            {"clickablewidget", saveWidget},
-            {"childwindow", saveChildWindow},
-            {"combobox", saveComboBox},
-            {"editbox", saveEditBox},
-            {"knob", saveKnob},
-            {"label", saveLabel},
-            {"listbox", saveListBox},
-            {"panel", saveContainer},
-            {"picture", savePicture},
-            {"progressbar", saveProgressBar},
-            {"radiobutton", saveRadioButton},
-            {"scrollbar", saveScrollbar},
-            {"slider", saveSlider},
-            {"spinbutton", saveSpinButton},
-            {"tab", saveTab},
-            {"textbox", saveTextBox}
+            {WidgetTypes::getId("widget"), saveWidget},
+            {WidgetTypes::getId("container"), saveContainer},
+            {WidgetTypes::Button, saveButton},
+            {WidgetTypes::Canvas, saveWidget},
+            {WidgetTypes::ChatBox, saveChatBox},
+            {WidgetTypes::CheckBox, saveRadioButton},
+            {WidgetTypes::ClickableWidget, saveWidget},
+            {WidgetTypes::ChildWindow, saveChildWindow},
+            {WidgetTypes::ComboBox, saveComboBox},
+            {WidgetTypes::EditBox, saveEditBox},
+            {WidgetTypes::Knob, saveKnob},
+            {WidgetTypes::Label, saveLabel},
+            {WidgetTypes::ListBox, saveListBox},
+            {WidgetTypes::Panel, saveContainer},
+            {WidgetTypes::Picture, savePicture},
+            {WidgetTypes::ProgressBar, saveProgressBar},
+            {WidgetTypes::RadioButton, saveRadioButton},
+            {WidgetTypes::Scrollbar, saveScrollbar},
+            {WidgetTypes::Slider, saveSlider},
+            {WidgetTypes::SpinButton, saveSpinButton},
+            {WidgetTypes::Tab, saveTab},
+            {WidgetTypes::TextBox, saveTextBox}
         };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -577,7 +588,7 @@ namespace tgui
         auto node = std::make_shared<DataIO::Node>();
         for (auto& child : widget->getWidgets())
         {
-            auto& saveFunction = WidgetSaver::getSaveFunction(toLower(child->getWidgetType()));
+            auto& saveFunction = getSaveFunctionOfWidget(*child);
             if (saveFunction)
                 node->children.emplace_back(saveFunction(WidgetConverter{child}));
             else
@@ -591,14 +602,21 @@ namespace tgui
 
     void WidgetSaver::setSaveFunction(const std::string& type, const SaveFunction& saveFunction)
     {
-        m_saveFunctions[toLower(type)] = saveFunction;
+        m_saveFunctions[WidgetTypes::getId(type)] = saveFunction;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const WidgetSaver::SaveFunction& WidgetSaver::getSaveFunction(const std::string& type)
     {
-        return m_saveFunctions[toLower(type)];
+        return m_saveFunctions[WidgetTypes::getId(type)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const WidgetSaver::SaveFunction& WidgetSaver::getSaveFunction(WidgetTypeId typeId)
+    {
+        return m_saveFunctions[typeId];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
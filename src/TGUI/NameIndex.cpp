@@ -0,0 +1,96 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/NameIndex.hpp>
+
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void NameIndex::insert(const sf::String& name, Widget* widget)
+    {
+        if (name.isEmpty())
+            return;
+
+        m_widgets[name].push_back(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void NameIndex::remove(const sf::String& name, Widget* widget)
+    {
+        auto it = m_widgets.find(name);
+        if (it == m_widgets.end())
+            return;
+
+        auto& widgets = it->second;
+        auto widgetIt = std::find(widgets.begin(), widgets.end(), widget);
+        if (widgetIt != widgets.end())
+        {
+            *widgetIt = widgets.back();
+            widgets.pop_back();
+        }
+
+        if (widgets.empty())
+            m_widgets.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Widget*>& NameIndex::find(const sf::String& name) const
+    {
+        static const std::vector<Widget*> noWidgets;
+
+        auto it = m_widgets.find(name);
+        if (it != m_widgets.end())
+            return it->second;
+        else
+            return noWidgets;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t NameIndex::StringHash::operator()(const sf::String& str) const
+    {
+        // FNV-1a hash over the characters of the string
+        std::size_t hash = 2166136261u;
+        for (auto it = str.begin(); it != str.end(); ++it)
+        {
+            hash ^= static_cast<std::size_t>(*it);
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
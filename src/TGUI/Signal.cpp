@@ -24,6 +24,10 @@
 
 
 #include <TGUI/Signal.hpp>
+#include <TGUI/FrameStats.hpp>
+
+#include <algorithm>
+#include <iterator>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -31,83 +35,229 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::deque<const void*> priv::data; // deque because vector could reallocate when resizing after parameters are already bound
-    unsigned int SignalWidgetBase::m_lastId = 0;
+    std::atomic<unsigned int> SignalWidgetBase::m_lastId{0};
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal::Signal(const char* name, const std::vector<std::vector<std::string>>& types) :
+        m_name        {name},
+        m_allowedTypes{&types}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal::Signal(const Signal& other) :
+        m_name        {other.m_name},
+        m_allowedTypes{other.m_allowedTypes}
+    {
+        addConnectedHandlers(other);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal& Signal::operator=(const Signal& right)
+    {
+        if (this != &right)
+        {
+            m_name = right.m_name;
+            m_allowedTypes = right.m_allowedTypes;
+
+            disconnectAll();
+            addConnectedHandlers(right);
+        }
+
+        return *this;
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal::Signal(std::vector<std::vector<std::string>>&& types)
+    Signal::~Signal()
     {
-        std::size_t maxSize = 0;
-        for (auto& typeList : types)
-            maxSize += typeList.size();
+        if (!m_connections)
+            return;
 
-        m_allowedTypes = types;
-        if (maxSize > priv::data.size())
-            priv::data.resize(maxSize, nullptr);
+        // Let the emit functions that are still running know that they should no longer access this object
+        Emission* outermostEmission = nullptr;
+        for (Emission* emission = m_connections->emission; emission != nullptr; emission = emission->outer)
+        {
+            emission->destroyed = true;
+            outermostEmission = emission;
+        }
+
+        // The handlers are only freed when the outermost emit function returns, as they might still be executing
+        if (outermostEmission)
+            outermostEmission->orphanedConnections = std::move(m_connections);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const char* Signal::getName() const
+    {
+        return m_name;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Signal::disconnect(unsigned int id)
     {
-        return !!m_functions.erase(id) || !!m_functionsEx.erase(id);
+        if (!m_connections)
+            return false;
+
+        auto& handlers = m_connections->handlers;
+        for (auto it = handlers.begin(); it != handlers.end(); ++it)
+        {
+            if ((it->id == id) && it->connected)
+            {
+                // The function can't be destroyed while it might still be executing
+                if (m_connections->emission)
+                {
+                    it->connected = false;
+                    m_connections->handlersDisconnected = true;
+                }
+                else
+                {
+                    handlers.erase(it);
+                    if (handlers.empty())
+                        m_connections = nullptr;
+                }
+
+                return true;
+            }
+        }
+
+        auto& addedHandlers = m_connections->addedHandlers;
+        for (auto it = addedHandlers.begin(); it != addedHandlers.end(); ++it)
+        {
+            if (it->id == id)
+            {
+                addedHandlers.erase(it);
+                return true;
+            }
+        }
+
+        return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_functions.clear();
-        m_functionsEx.clear();
+        if (!m_connections)
+            return;
+
+        if (m_connections->emission)
+        {
+            for (auto& handler : m_connections->handlers)
+                handler.connected = false;
+
+            m_connections->handlersDisconnected = true;
+            m_connections->addedHandlers.clear();
+        }
+        else
+            m_connections = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Signal::isEmpty() const
     {
-        return m_functions.empty();
+        if (!m_connections)
+            return true;
+
+        auto hasFunction = [](const Handler& handler){ return handler.connected && handler.function; };
+        return std::none_of(m_connections->handlers.begin(), m_connections->handlers.end(), hasFunction)
+            && std::none_of(m_connections->addedHandlers.begin(), m_connections->addedHandlers.end(), hasFunction);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Signal::operator()(unsigned int)
+    bool Signal::isBound() const
     {
-        // Copy the functions in case one of the functions destroys the widget to which this Signal instance belongs
-        auto functions = m_functions;
-        for (const auto& function : functions)
-            function.second();
+        if (!m_connections)
+            return false;
+
+        if (!m_connections->addedHandlers.empty())
+            return true;
+
+        return std::any_of(m_connections->handlers.begin(), m_connections->handlers.end(), [](const Handler& handler){ return handler.connected; });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Signal::addHandler(Handler&& handler)
+    {
+        if (!m_connections)
+            m_connections = std::unique_ptr<Connections>(new Connections);
+
+        // Adding to the handlers could reallocate them while one of their functions is being executed
+        if (m_connections->emission)
+            m_connections->addedHandlers.push_back(std::move(handler));
+        else
+            m_connections->handlers.push_back(std::move(handler));
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    SignalWidgetBase::SignalWidgetBase(const SignalWidgetBase& copy)
+    void Signal::addConnectedHandlers(const Signal& other)
     {
-        for (auto& signal : copy.m_signals)
-            m_signals[signal.first] = std::make_shared<Signal>(*signal.second);
+        if (!other.m_connections)
+            return;
+
+        for (const auto& handler : other.m_connections->handlers)
+        {
+            if (handler.connected)
+                addHandler(Handler{handler});
+        }
+
+        for (const auto& handler : other.m_connections->addedHandlers)
+            addHandler(Handler{handler});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    SignalWidgetBase& SignalWidgetBase::operator=(const SignalWidgetBase& right)
+    void Signal::startEmission(Emission& emission)
     {
-        if (this != &right)
+        TGUI_FRAME_STATS(priv::FrameStatsCounters::add(&FrameStats::signalsEmitted));
+
+        emission.outer = m_connections->emission;
+        m_connections->emission = &emission;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Signal::finishEmission()
+    {
+        auto& connections = *m_connections;
+        connections.emission = connections.emission->outer;
+        if (connections.emission)
+            return;
+
+        if (connections.handlersDisconnected)
         {
-            for (auto& signal : right.m_signals)
-                m_signals[signal.first] = std::make_shared<Signal>(*signal.second);
+            connections.handlers.erase(std::remove_if(connections.handlers.begin(), connections.handlers.end(), [](const Handler& handler){ return !handler.connected; }),
+                                       connections.handlers.end());
+            connections.handlersDisconnected = false;
         }
 
-        return *this;
+        if (!connections.addedHandlers.empty())
+        {
+            std::move(connections.addedHandlers.begin(), connections.addedHandlers.end(), std::back_inserter(connections.handlers));
+            connections.addedHandlers.clear();
+        }
+
+        if (connections.handlers.empty())
+            m_connections = nullptr;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void SignalWidgetBase::disconnect(unsigned int id)
     {
-        for (auto& signal : m_signals)
+        for (auto& signal : getSignals())
         {
-            if (signal.second->disconnect(id))
+            if (signal->disconnect(id))
                 return;
         }
 
@@ -119,23 +269,48 @@ namespace tgui
     void SignalWidgetBase::disconnectAll(const std::string& signalName)
     {
         for (auto& name : extractSignalNames(signalName))
-            m_signals.at(toLower(name))->disconnectAll();
+        {
+            Signal* signal = findSignal(name);
+            if (!signal)
+                throw Exception{"Cannot disconnect from unknown signal '" + name + "'."};
+
+            signal->disconnectAll();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void SignalWidgetBase::disconnectAll()
     {
-        for (auto& signal : m_signals)
-            signal.second->disconnectAll();
+        for (auto& signal : getSignals())
+            signal->disconnectAll();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<Signal*> SignalWidgetBase::getSignals()
+    {
+        std::vector<Signal*> signals;
+        for (auto& addedSignal : m_addedSignals)
+            signals.push_back(&addedSignal.signal);
+
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool SignalWidgetBase::isSignalBound(const Signal& signal) const
+    {
+        return signal.isBound();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool SignalWidgetBase::isSignalBound(std::string&& name)
     {
-        assert(m_signals[toLower(name)]);
-        return !m_signals[toLower(name)]->isEmpty() || !m_signals[toLower(name)]->m_functionsEx.empty();
+        Signal* signal = findSignal(name);
+        assert(signal != nullptr);
+        return signal->isBound();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -161,6 +336,20 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal* SignalWidgetBase::findSignal(const std::string& signalName)
+    {
+        const std::string lowerName = toLower(signalName);
+        for (auto& signal : getSignals())
+        {
+            if (toLower(signal->getName()) == lowerName)
+                return signal;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
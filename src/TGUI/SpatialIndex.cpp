@@ -0,0 +1,242 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/SpatialIndex.hpp>
+#include <TGUI/Widget.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Widgets that would be stored in more cells than this are treated as if they didn't have a known mouse area
+    const float maxCellsPerWidget = 256;
+
+    // Cell coordinates have to fit inside an int
+    const float maxCellCoordinate = 1e9f;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SpatialIndex::SpatialIndex(float cellSize) :
+        m_cellSize{cellSize}
+    {
+        assert(cellSize > 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SpatialIndex::insert(const Widget* widget, std::size_t index)
+    {
+        Entry& entry = m_entries[widget];
+        entry.index = index;
+
+        findCells(widget, entry);
+        addToCells(widget, entry);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SpatialIndex::update(const Widget* widget)
+    {
+        auto it = m_entries.find(widget);
+        if (it == m_entries.end())
+            return;
+
+        Entry newEntry = it->second;
+        findCells(widget, newEntry);
+
+        // Most of the time the widget only moves a bit and stays inside the same cells
+        if ((newEntry.bounded == it->second.bounded)
+         && (!newEntry.bounded
+          || ((newEntry.left == it->second.left) && (newEntry.top == it->second.top) && (newEntry.right == it->second.right) && (newEntry.bottom == it->second.bottom))))
+        {
+            return;
+        }
+
+        removeFromCells(widget, it->second);
+        it->second = newEntry;
+        addToCells(widget, newEntry);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SpatialIndex::remove(const Widget* widget)
+    {
+        auto it = m_entries.find(widget);
+        if (it == m_entries.end())
+            return;
+
+        removeFromCells(widget, it->second);
+        m_entries.erase(it);
+        m_orderValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SpatialIndex::clear()
+    {
+        m_entries.clear();
+        m_cells.clear();
+        m_unboundedWidgets.clear();
+        m_orderValid = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<std::size_t>& SpatialIndex::query(float x, float y, const std::vector<std::shared_ptr<Widget>>& widgets)
+    {
+        if (!m_orderValid)
+        {
+            for (std::size_t i = 0; i < widgets.size(); ++i)
+            {
+                auto it = m_entries.find(widgets[i].get());
+                if (it != m_entries.end())
+                    it->second.index = i;
+            }
+
+            m_orderValid = true;
+        }
+
+        m_candidates.clear();
+        for (auto& widget : m_unboundedWidgets)
+            m_candidates.push_back(m_entries[widget].index);
+
+        if ((std::abs(x / m_cellSize) < maxCellCoordinate) && (std::abs(y / m_cellSize) < maxCellCoordinate))
+        {
+            auto cellIt = m_cells.find(getCellKey(static_cast<int>(std::floor(x / m_cellSize)), static_cast<int>(std::floor(y / m_cellSize))));
+            if (cellIt != m_cells.end())
+            {
+                for (auto& widget : cellIt->second)
+                    m_candidates.push_back(m_entries[widget].index);
+            }
+        }
+
+        // The widget that was added last is drawn on top, so it has to be checked first
+        std::sort(m_candidates.begin(), m_candidates.end(), [](std::size_t left, std::size_t right) { return left > right; });
+        return m_candidates;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SpatialIndex::findCells(const Widget* widget, Entry& entry) const
+    {
+        sf::FloatRect area;
+        entry.bounded = widget->getMouseArea(area);
+        if (!entry.bounded)
+            return;
+
+        // The area may have a negative width or height
+        const float left = std::min(area.left, area.left + area.width) / m_cellSize;
+        const float top = std::min(area.top, area.top + area.height) / m_cellSize;
+        const float right = std::max(area.left, area.left + area.width) / m_cellSize;
+        const float bottom = std::max(area.top, area.top + area.height) / m_cellSize;
+
+        // Checking this way around also rejects NaN values
+        if (!((std::abs(left) < maxCellCoordinate) && (std::abs(top) < maxCellCoordinate)
+           && (std::abs(right) < maxCellCoordinate) && (std::abs(bottom) < maxCellCoordinate)
+           && ((std::floor(right) - std::floor(left) + 1) * (std::floor(bottom) - std::floor(top) + 1) <= maxCellsPerWidget)))
+        {
+            entry.bounded = false;
+            return;
+        }
+
+        entry.left = static_cast<int>(std::floor(left));
+        entry.top = static_cast<int>(std::floor(top));
+        entry.right = static_cast<int>(std::floor(right));
+        entry.bottom = static_cast<int>(std::floor(bottom));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SpatialIndex::addToCells(const Widget* widget, const Entry& entry)
+    {
+        if (!entry.bounded)
+        {
+            m_unboundedWidgets.push_back(widget);
+            return;
+        }
+
+        for (int row = entry.top; row <= entry.bottom; ++row)
+        {
+            for (int column = entry.left; column <= entry.right; ++column)
+                m_cells[getCellKey(column, row)].push_back(widget);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SpatialIndex::removeFromCells(const Widget* widget, const Entry& entry)
+    {
+        auto removeFromList = [widget](std::vector<const Widget*>& list)
+            {
+                auto it = std::find(list.begin(), list.end(), widget);
+                if (it != list.end())
+                {
+                    *it = list.back();
+                    list.pop_back();
+                }
+            };
+
+        if (!entry.bounded)
+        {
+            removeFromList(m_unboundedWidgets);
+            return;
+        }
+
+        for (int row = entry.top; row <= entry.bottom; ++row)
+        {
+            for (int column = entry.left; column <= entry.right; ++column)
+            {
+                auto cellIt = m_cells.find(getCellKey(column, row));
+                if (cellIt == m_cells.end())
+                    continue;
+
+                removeFromList(cellIt->second);
+                if (cellIt->second.empty())
+                    m_cells.erase(cellIt);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned long long SpatialIndex::getCellKey(int column, int row)
+    {
+        return (static_cast<unsigned long long>(static_cast<unsigned int>(column)) << 32) | static_cast<unsigned int>(row);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
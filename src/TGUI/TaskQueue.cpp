@@ -0,0 +1,159 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/TaskQueue.hpp>
+
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TaskQueue::TaskQueue() :
+        m_back {&m_stub},
+        m_front{&m_stub}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TaskQueue::~TaskQueue()
+    {
+        while (Node* node = pop())
+            delete node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TaskQueue::post(std::function<void()> task)
+    {
+        Node* node = new Node;
+        node->task = std::move(task);
+
+        // The counter is increased first so that it can't drop below zero when the task is executed right away
+        m_queuedTasks.fetch_add(1, std::memory_order_relaxed);
+        push(node);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TaskQueue::executeTasks(std::size_t maxTasks)
+    {
+        // Tasks that are posted by the executed tasks themselves have to wait until the next call
+        const std::size_t queuedTasks = m_queuedTasks.load(std::memory_order_relaxed);
+        if (queuedTasks == 0)
+        {
+            m_stats.lastExecutedTasks = 0;
+            return 0;
+        }
+
+        m_stats.peakQueuedTasks = std::max(m_stats.peakQueuedTasks, queuedTasks);
+
+        sf::Clock clock;
+        std::size_t executedTasks = 0;
+        const std::size_t taskCount = std::min(queuedTasks, maxTasks);
+        while (executedTasks < taskCount)
+        {
+            std::unique_ptr<Node> node{pop()};
+            if (!node)
+                break;
+
+            m_queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+            executedTasks++;
+            node->task();
+        }
+
+        m_stats.lastExecutedTasks = executedTasks;
+        m_stats.lastExecutionTime = clock.getElapsedTime();
+        m_stats.totalExecutedTasks += executedTasks;
+        return executedTasks;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TaskQueueStats TaskQueue::getStats() const
+    {
+        TaskQueueStats stats = m_stats;
+        stats.queuedTasks = m_queuedTasks.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TaskQueue::push(Node* node)
+    {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        Node* previous = m_back.exchange(node, std::memory_order_acq_rel);
+
+        // Between these two lines the node is not reachable from the front yet, pop will act as if the queue is empty
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TaskQueue::Node* TaskQueue::pop()
+    {
+        Node* front = m_front;
+        Node* next = front->next.load(std::memory_order_acquire);
+
+        // Skip the stub node
+        if (front == &m_stub)
+        {
+            if (!next)
+                return nullptr;
+
+            m_front = next;
+            front = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next)
+        {
+            m_front = next;
+            return front;
+        }
+
+        // The front node is the last one. It can only be removed when another node follows it, so the stub is added again.
+        if (front != m_back.load(std::memory_order_acquire))
+            return nullptr;
+
+        push(&m_stub);
+
+        next = front->next.load(std::memory_order_acquire);
+        if (next)
+        {
+            m_front = next;
+            return front;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,11 +23,11 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <TGUI/Clipping.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Texture.hpp>
 #include <TGUI/Global.hpp>
 
-#include <SFML/OpenGL.hpp>
-
 #include <cassert>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -159,11 +159,11 @@ namespace tgui
         m_loaded = true;
 
         if (middleRect == sf::IntRect{})
-            m_middleRect = {0, 0, static_cast<int>(m_data->texture.getSize().x), static_cast<int>(m_data->texture.getSize().y)};
+            m_middleRect = {0, 0, static_cast<int>(m_data->getSize().x), static_cast<int>(m_data->getSize().y)};
         else
             m_middleRect = middleRect;
 
-        setSize(sf::Vector2f{m_data->texture.getSize()});
+        setSize(sf::Vector2f{m_data->getSize()});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -220,8 +220,26 @@ namespace tgui
 
     void Texture::setSmooth(bool smooth)
     {
-        if (m_loaded)
-            m_data->texture.setSmooth(smooth);
+        if (!m_loaded)
+            return;
+
+        // Pages of the texture atlas are never smoothed, the image needs a texture of its own
+        if (smooth && m_data->atlasTexture)
+        {
+            auto data = std::make_shared<TextureData>();
+            data->image = m_data->image;
+            data->rect = m_data->rect;
+            data->texture.loadFromImage(*data->image, data->rect);
+
+            // The copy is no longer managed by the texture manager
+            const sf::Vector2f size = m_size;
+            setTexture(data, m_middleRect);
+            setSize(size);
+            m_copyCallback = nullptr;
+            m_destructCallback = nullptr;
+        }
+
+        m_data->texture.setSmooth(smooth);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -241,69 +259,69 @@ namespace tgui
         {
             case ScalingType::Normal:
             {
-                pixel.x = static_cast<unsigned int>(x / m_size.x * m_data->texture.getSize().x);
-                pixel.y = static_cast<unsigned int>(y / m_size.y * m_data->texture.getSize().y);
+                pixel.x = static_cast<unsigned int>(x / m_size.x * m_data->getSize().x);
+                pixel.y = static_cast<unsigned int>(y / m_size.y * m_data->getSize().y);
                 break;
             }
             case ScalingType::Horizontal:
             {
-                if (x >= m_size.x - (m_data->texture.getSize().x - m_middleRect.left - m_middleRect.width) * (m_size.y / m_data->texture.getSize().y))
+                if (x >= m_size.x - (m_data->getSize().x - m_middleRect.left - m_middleRect.width) * (m_size.y / m_data->getSize().y))
                 {
-                    float xDiff = (x - (m_size.x - (m_data->texture.getSize().x - m_middleRect.left - m_middleRect.width) * (m_size.y / m_data->texture.getSize().y)));
-                    pixel.x = static_cast<unsigned int>(m_middleRect.left + m_middleRect.width + (xDiff / m_size.y * m_data->texture.getSize().y));
+                    float xDiff = (x - (m_size.x - (m_data->getSize().x - m_middleRect.left - m_middleRect.width) * (m_size.y / m_data->getSize().y)));
+                    pixel.x = static_cast<unsigned int>(m_middleRect.left + m_middleRect.width + (xDiff / m_size.y * m_data->getSize().y));
                 }
-                else if (x >= m_middleRect.left * (m_size.y / m_data->texture.getSize().y))
+                else if (x >= m_middleRect.left * (m_size.y / m_data->getSize().y))
                 {
-                    float xDiff = x - (m_middleRect.left * (m_size.y / m_data->texture.getSize().y));
-                    pixel.x = static_cast<unsigned int>(m_middleRect.left + (xDiff / (m_size.x - ((m_data->texture.getSize().x - m_middleRect.width) * (m_size.y / m_data->texture.getSize().y))) * m_middleRect.width));
+                    float xDiff = x - (m_middleRect.left * (m_size.y / m_data->getSize().y));
+                    pixel.x = static_cast<unsigned int>(m_middleRect.left + (xDiff / (m_size.x - ((m_data->getSize().x - m_middleRect.width) * (m_size.y / m_data->getSize().y))) * m_middleRect.width));
                 }
                 else // Mouse on the left part
                 {
-                    pixel.x = static_cast<unsigned int>(x / m_size.y * m_data->texture.getSize().y);
+                    pixel.x = static_cast<unsigned int>(x / m_size.y * m_data->getSize().y);
                 }
 
-                pixel.y = static_cast<unsigned int>(y / m_size.y * m_data->texture.getSize().y);
+                pixel.y = static_cast<unsigned int>(y / m_size.y * m_data->getSize().y);
                 break;
             }
             case ScalingType::Vertical:
             {
-                if (y >= m_size.y - (m_data->texture.getSize().y - m_middleRect.top - m_middleRect.height) * (m_size.x / m_data->texture.getSize().x))
+                if (y >= m_size.y - (m_data->getSize().y - m_middleRect.top - m_middleRect.height) * (m_size.x / m_data->getSize().x))
                 {
-                    float yDiff = (y - (m_size.y - (m_data->texture.getSize().y - m_middleRect.top - m_middleRect.height) * (m_size.x / m_data->texture.getSize().x)));
-                    pixel.y = static_cast<unsigned int>(m_middleRect.top + m_middleRect.height + (yDiff / m_size.x * m_data->texture.getSize().x));
+                    float yDiff = (y - (m_size.y - (m_data->getSize().y - m_middleRect.top - m_middleRect.height) * (m_size.x / m_data->getSize().x)));
+                    pixel.y = static_cast<unsigned int>(m_middleRect.top + m_middleRect.height + (yDiff / m_size.x * m_data->getSize().x));
                 }
-                else if (y >= m_middleRect.top * (m_size.x / m_data->texture.getSize().x))
+                else if (y >= m_middleRect.top * (m_size.x / m_data->getSize().x))
                 {
-                    float yDiff = y - (m_middleRect.top * (m_size.x / m_data->texture.getSize().x));
-                    pixel.y = static_cast<unsigned int>(m_middleRect.top + (yDiff / (m_size.y - ((m_data->texture.getSize().y - m_middleRect.height) * (m_size.x / m_data->texture.getSize().x))) * m_middleRect.height));
+                    float yDiff = y - (m_middleRect.top * (m_size.x / m_data->getSize().x));
+                    pixel.y = static_cast<unsigned int>(m_middleRect.top + (yDiff / (m_size.y - ((m_data->getSize().y - m_middleRect.height) * (m_size.x / m_data->getSize().x))) * m_middleRect.height));
                 }
                 else // Mouse on the top part
                 {
-                    pixel.y = static_cast<unsigned int>(y / m_size.x * m_data->texture.getSize().x);
+                    pixel.y = static_cast<unsigned int>(y / m_size.x * m_data->getSize().x);
                 }
 
-                pixel.x = static_cast<unsigned int>(x / m_size.x * m_data->texture.getSize().x);
+                pixel.x = static_cast<unsigned int>(x / m_size.x * m_data->getSize().x);
                 break;
             }
             case ScalingType::NineSlice:
             {
                 if (x < m_middleRect.left)
                     pixel.x = static_cast<unsigned int>(x);
-                else if (x >= m_size.x - (m_data->texture.getSize().x - m_middleRect.width - m_middleRect.left))
-                    pixel.x = static_cast<unsigned int>(x - m_size.x + m_data->texture.getSize().x);
+                else if (x >= m_size.x - (m_data->getSize().x - m_middleRect.width - m_middleRect.left))
+                    pixel.x = static_cast<unsigned int>(x - m_size.x + m_data->getSize().x);
                 else
                 {
-                    float xDiff = (x - m_middleRect.left) / (m_size.x - (m_data->texture.getSize().x - m_middleRect.width)) * m_middleRect.width;
+                    float xDiff = (x - m_middleRect.left) / (m_size.x - (m_data->getSize().x - m_middleRect.width)) * m_middleRect.width;
                     pixel.x = static_cast<unsigned int>(m_middleRect.left + xDiff);
                 }
 
                 if (y < m_middleRect.top)
                     pixel.y = static_cast<unsigned int>(y);
-                else if (y >= m_size.y - (m_data->texture.getSize().y - m_middleRect.height - m_middleRect.top))
-                    pixel.y = static_cast<unsigned int>(y - m_size.y + m_data->texture.getSize().y);
+                else if (y >= m_size.y - (m_data->getSize().y - m_middleRect.height - m_middleRect.top))
+                    pixel.y = static_cast<unsigned int>(y - m_size.y + m_data->getSize().y);
                 else
                 {
-                    float yDiff = (y - m_middleRect.top) / (m_size.y - (m_data->texture.getSize().y - m_middleRect.height)) * m_middleRect.height;
+                    float yDiff = (y - m_middleRect.top) / (m_size.y - (m_data->getSize().y - m_middleRect.height)) * m_middleRect.height;
                     pixel.y = static_cast<unsigned int>(m_middleRect.top + yDiff);
                 }
 
@@ -311,7 +329,7 @@ namespace tgui
             }
         };
 
-        assert(pixel.x < m_data->texture.getSize().x && pixel.y < m_data->texture.getSize().y);
+        assert(pixel.x < m_data->getSize().x && pixel.y < m_data->getSize().y);
         if (m_data->image->getPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top).a == 0)
             return true;
         else
@@ -367,40 +385,40 @@ namespace tgui
     void Texture::updateVertices()
     {
         // Figure out how the image is scaled best
-        if (m_middleRect == sf::IntRect(0, 0, m_data->texture.getSize().x, m_data->texture.getSize().y))
+        if (m_middleRect == sf::IntRect(0, 0, m_data->getSize().x, m_data->getSize().y))
         {
             m_scalingType = ScalingType::Normal;
         }
-        else if (m_middleRect.height == static_cast<int>(m_data->texture.getSize().y))
+        else if (m_middleRect.height == static_cast<int>(m_data->getSize().y))
         {
-            if (m_size.x >= (m_data->texture.getSize().x - m_middleRect.width) * (m_size.y / m_data->texture.getSize().y))
+            if (m_size.x >= (m_data->getSize().x - m_middleRect.width) * (m_size.y / m_data->getSize().y))
                 m_scalingType = ScalingType::Horizontal;
             else
                 m_scalingType = ScalingType::Normal;
         }
-        else if (m_middleRect.width == static_cast<int>(m_data->texture.getSize().x))
+        else if (m_middleRect.width == static_cast<int>(m_data->getSize().x))
         {
-            if (m_size.y >= (m_data->texture.getSize().y - m_middleRect.height) * (m_size.x / m_data->texture.getSize().x))
+            if (m_size.y >= (m_data->getSize().y - m_middleRect.height) * (m_size.x / m_data->getSize().x))
                 m_scalingType = ScalingType::Vertical;
             else
                 m_scalingType = ScalingType::Normal;
         }
         else
         {
-            if (m_size.x >= m_data->texture.getSize().x - m_middleRect.width)
+            if (m_size.x >= m_data->getSize().x - m_middleRect.width)
             {
-                if (m_size.y >= m_data->texture.getSize().y - m_middleRect.height)
+                if (m_size.y >= m_data->getSize().y - m_middleRect.height)
                     m_scalingType = ScalingType::NineSlice;
                 else
                     m_scalingType = ScalingType::Horizontal;
             }
-            else if (m_size.y >= (m_data->texture.getSize().y - m_middleRect.height) * (m_size.x / m_data->texture.getSize().x))
+            else if (m_size.y >= (m_data->getSize().y - m_middleRect.height) * (m_size.x / m_data->getSize().x))
                 m_scalingType = ScalingType::Vertical;
             else
                 m_scalingType = ScalingType::Normal;
         }
 
-        sf::Vector2f textureSize{m_data->texture.getSize()};
+        sf::Vector2f textureSize{m_data->getSize()};
         sf::FloatRect middleRect{m_middleRect};
 
         // Calculate the vertices based on the way we are scaling
@@ -496,6 +514,16 @@ namespace tgui
             m_vertices[21] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
             break;
         };
+
+        // Images in the texture atlas only occupy a part of the page
+        if (m_data->atlasTexture)
+        {
+            for (auto& vertex : m_vertices)
+            {
+                vertex.texCoords.x += m_data->atlasRect.left;
+                vertex.texCoords.y += m_data->atlasRect.top;
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -517,17 +545,13 @@ namespace tgui
         {
             if (m_textureRect == sf::FloatRect(0, 0, 0, 0))
             {
-                states.texture = &m_data->texture;
-                target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+                states.texture = &m_data->getTexture();
+                DrawBatcher::draw(target, m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
             }
             else
             {
                 const sf::View& view = target.getView();
 
-                // Calculate the scale factor of the view
-                float scaleViewX = target.getSize().x / view.getSize().x;
-                float scaleViewY = target.getSize().y / view.getSize().y;
-
 /// TODO: Check this code! Other places don't use transformPoint
                 // Get the global position
                 sf::Vector2f topLeftPosition = states.transform.transformPoint(((m_textureRect.left - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
@@ -535,31 +559,15 @@ namespace tgui
                 sf::Vector2f bottomRightPosition = states.transform.transformPoint((m_textureRect.left + m_textureRect.width - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
                                                                                    (m_textureRect.top + m_textureRect.height - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
 
-                // Get the old clipping area
-                GLint scissor[4];
-                glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-                // Calculate the clipping area
-                GLint scissorLeft = std::max(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-                GLint scissorTop = std::max(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-                GLint scissorRight = std::min(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-                GLint scissorBottom = std::min(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-                // If the object outside the window then don't draw anything
-                if (scissorRight < scissorLeft)
-                    scissorRight = scissorLeft;
-                else if (scissorBottom < scissorTop)
-                    scissorTop = scissorBottom;
-
                 // Set the clipping area
-                glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+                Clipping::push(target, topLeftPosition, bottomRightPosition);
 
                 // Draw the texture
-                states.texture = &m_data->texture;
-                target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+                states.texture = &m_data->getTexture();
+                DrawBatcher::draw(target, m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
 
                 // Reset the old clipping area
-                glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+                Clipping::pop();
             }
         }
     }
@@ -0,0 +1,181 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TextureAtlas.hpp>
+
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    std::vector<TextureAtlas::Page> TextureAtlas::m_pages;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureAtlas::add(TextureData& data)
+    {
+        if (!data.image)
+            return false;
+
+        // Use the same part of the image as when the image would be loaded in a separate texture
+        const sf::Vector2u imageSize = data.image->getSize();
+        sf::IntRect rect = data.rect;
+        if (rect == sf::IntRect{})
+            rect = {0, 0, static_cast<int>(imageSize.x), static_cast<int>(imageSize.y)};
+        else
+        {
+            rect.left = std::max(rect.left, 0);
+            rect.top = std::max(rect.top, 0);
+            rect.width = std::min(rect.width, static_cast<int>(imageSize.x) - rect.left);
+            rect.height = std::min(rect.height, static_cast<int>(imageSize.y) - rect.top);
+        }
+
+        if ((rect.width <= 0) || (rect.height <= 0))
+            return false;
+
+        // Large images would leave too little room for other images on the page
+        const unsigned int pageSize = getPageSize();
+        const unsigned int width = static_cast<unsigned int>(rect.width) + 2;
+        const unsigned int height = static_cast<unsigned int>(rect.height) + 2;
+        if ((width > pageSize / 4) || (height > pageSize / 4))
+            return false;
+
+        sf::Vector2u position;
+        auto pageIt = std::find_if(m_pages.begin(), m_pages.end(), [&](Page& page){ return allocate(page, width, height, position); });
+        if (pageIt == m_pages.end())
+        {
+            Page page;
+            page.texture = std::make_shared<sf::Texture>();
+            if (!page.texture->create(pageSize, pageSize))
+                return false;
+
+            m_pages.push_back(std::move(page));
+            pageIt = m_pages.end() - 1;
+            allocate(*pageIt, width, height, position);
+        }
+
+        // Copy the image with a border around it that repeats the pixels on the edge of the image
+        sf::Image paddedImage;
+        paddedImage.create(width, height);
+        paddedImage.copy(*data.image, 1, 1, rect);
+        for (unsigned int x = 0; x < width; ++x)
+        {
+            paddedImage.setPixel(x, 0, paddedImage.getPixel(x, 1));
+            paddedImage.setPixel(x, height - 1, paddedImage.getPixel(x, height - 2));
+        }
+        for (unsigned int y = 0; y < height; ++y)
+        {
+            paddedImage.setPixel(0, y, paddedImage.getPixel(1, y));
+            paddedImage.setPixel(width - 1, y, paddedImage.getPixel(width - 2, y));
+        }
+
+        pageIt->texture->update(paddedImage, position.x, position.y);
+        pageIt->images++;
+        pageIt->usedPixels += width * height;
+
+        data.atlasTexture = pageIt->texture;
+        data.atlasRect = {static_cast<int>(position.x) + 1, static_cast<int>(position.y) + 1, rect.width, rect.height};
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureAtlas::remove(const TextureData& data)
+    {
+        auto pageIt = std::find_if(m_pages.begin(), m_pages.end(), [&](const Page& page){ return page.texture == data.atlasTexture; });
+        if (pageIt == m_pages.end())
+            return;
+
+        pageIt->usedPixels -= static_cast<unsigned long long>(data.atlasRect.width + 2) * (data.atlasRect.height + 2);
+
+        // The page can only be filled again once it is completely empty
+        if (--pageIt->images == 0)
+            m_pages.erase(pageIt);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureAtlasStats TextureAtlas::getStats()
+    {
+        const unsigned long long pageSize = getPageSize();
+
+        TextureAtlasStats stats;
+        stats.pages = m_pages.size();
+        stats.totalPixels = m_pages.size() * pageSize * pageSize;
+        for (const auto& page : m_pages)
+        {
+            stats.images += page.images;
+            stats.usedPixels += page.usedPixels;
+        }
+
+        return stats;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureAtlas::allocate(Page& page, unsigned int width, unsigned int height, sf::Vector2u& position)
+    {
+        const unsigned int pageSize = getPageSize();
+
+        // Find the least high row in which the image still fits, rows that are more than twice as high as the image are skipped
+        Shelf* bestShelf = nullptr;
+        for (auto& shelf : page.shelves)
+        {
+            if ((shelf.height >= height) && (shelf.height <= 2 * height) && (pageSize - shelf.usedWidth >= width))
+            {
+                if (!bestShelf || (shelf.height < bestShelf->height))
+                    bestShelf = &shelf;
+            }
+        }
+
+        // Start a new row when none of the existing ones can be used
+        if (!bestShelf)
+        {
+            if (pageSize - page.usedHeight < height)
+                return false;
+
+            page.shelves.push_back({page.usedHeight, height, 0});
+            page.usedHeight += height;
+            bestShelf = &page.shelves.back();
+        }
+
+        position = {bestShelf->usedWidth, bestShelf->top};
+        bestShelf->usedWidth += width;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextureAtlas::getPageSize()
+    {
+        return std::min(1024u, sf::Texture::getMaximumSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
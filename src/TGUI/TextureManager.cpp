@@ -32,6 +32,7 @@
 namespace tgui
 {
     std::map<std::string, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    bool TextureManager::m_atlasEnabled = false;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -81,6 +82,10 @@ namespace tgui
         texture.getData()->image = texture.getImageLoader()(filename);
         if (texture.getData()->image != nullptr)
         {
+            // Small images share a texture with other images when possible
+            if (m_atlasEnabled && TextureAtlas::add(*texture.getData()))
+                return true;
+
             // Create a texture from the image
             if (partRect == sf::IntRect{})
                 return texture.getData()->texture.loadFromImage(*texture.getData()->image);
@@ -130,6 +135,9 @@ namespace tgui
                     // If this was the only place where the texture is used then delete it
                     if (--(dataIt->users) == 0)
                     {
+                        if (dataIt->data->atlasTexture)
+                            TextureAtlas::remove(*dataIt->data);
+
                         imageIt->second.erase(dataIt);
                         if (imageIt->second.empty())
                             m_imageMap.erase(imageIt);
@@ -144,6 +152,27 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasEnabled(bool enabled)
+    {
+        m_atlasEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAtlasEnabled()
+    {
+        return m_atlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureAtlasStats TextureManager::getAtlasStats()
+    {
+        return TextureAtlas::getStats();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
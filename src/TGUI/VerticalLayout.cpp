@@ -9,7 +9,7 @@ namespace tgui
 
     VerticalLayout::VerticalLayout()
     {
-        m_callback.widgetType = "VerticalLayout";
+        setWidgetType(WidgetTypes::VerticalLayout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,7 @@
 #include <TGUI/Animation.hpp>
 
 #include <cassert>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -64,13 +65,6 @@ namespace tgui
     Widget::Widget()
     {
         m_callback.widget = this;
-
-        addSignal<sf::Vector2f>("PositionChanged");
-        addSignal<sf::Vector2f>("SizeChanged");
-        addSignal("Focused");
-        addSignal("Unfocused");
-        addSignal("MouseEntered");
-        addSignal("MouseLeft");
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -79,6 +73,8 @@ namespace tgui
     {
         detachTheme();
 
+        LayoutImpl::removeWidgetDependencies(this);
+
         if (m_position.x.getImpl()->parentWidget == this)
             m_position.x.getImpl()->parentWidget = nullptr;
         if (m_position.y.getImpl()->parentWidget == this)
@@ -105,9 +101,19 @@ namespace tgui
         m_mouseDown      {false},
         m_focused        {false},
         m_allowFocus     {copy.m_allowFocus},
+        m_tabIndex       {copy.m_tabIndex},
+        m_widgetTypeId   {copy.m_widgetTypeId},
+        m_builtInType    {copy.m_builtInType},
+        m_updatedEveryFrame{copy.m_updatedEveryFrame},
         m_draggableWidget{copy.m_draggableWidget},
         m_containerWidget{copy.m_containerWidget},
-        m_font           {copy.m_font}
+        m_font           {copy.m_font},
+        m_onPositionChanged{copy.m_onPositionChanged},
+        m_onSizeChanged  {copy.m_onSizeChanged},
+        m_onFocused      {copy.m_onFocused},
+        m_onUnfocused    {copy.m_onUnfocused},
+        m_onMouseEntered {copy.m_onMouseEntered},
+        m_onMouseLeft    {copy.m_onMouseLeft}
     {
         m_callback.widget = this;
         m_callback.widgetType = copy.m_callback.widgetType;
@@ -116,7 +122,10 @@ namespace tgui
             m_toolTip = copy.m_toolTip->clone();
 
         if (copy.m_renderer != nullptr)
+        {
             m_renderer = copy.m_renderer->clone(this);
+            m_renderer->m_widget = this;
+        }
 
         m_position.x.getImpl()->parentWidget = this;
         m_position.x.getImpl()->recalculate();
@@ -151,9 +160,19 @@ namespace tgui
             m_mouseDown           = false;
             m_focused             = false;
             m_allowFocus          = right.m_allowFocus;
+            m_tabIndex            = right.m_tabIndex;
+            m_widgetTypeId        = right.m_widgetTypeId;
+            m_builtInType         = right.m_builtInType;
+            m_updatedEveryFrame   = right.m_updatedEveryFrame;
             m_draggableWidget     = right.m_draggableWidget;
             m_containerWidget     = right.m_containerWidget;
             m_font                = right.m_font;
+            m_onPositionChanged   = right.m_onPositionChanged;
+            m_onSizeChanged       = right.m_onSizeChanged;
+            m_onFocused           = right.m_onFocused;
+            m_onUnfocused         = right.m_onUnfocused;
+            m_onMouseEntered      = right.m_onMouseEntered;
+            m_onMouseLeft         = right.m_onMouseLeft;
             m_callback.widget     = this;
             m_callback.widgetType = right.m_callback.widgetType;
 
@@ -163,7 +182,10 @@ namespace tgui
                 m_toolTip = nullptr;
 
             if (right.m_renderer != nullptr)
+            {
                 m_renderer = right.m_renderer->clone(this);
+                m_renderer->m_widget = this;
+            }
             else
                 m_renderer = nullptr;
 
@@ -190,42 +212,62 @@ namespace tgui
 
     void Widget::setPosition(const Layout2d& position)
     {
-        if (position.x.getImpl()->parentWidget != this)
+        // Only layouts that are defined by a string depend on the widget to which they belong
+        if ((position.x.getImpl()->operation == LayoutImpl::Operation::String) && (position.x.getImpl()->parentWidget != this))
         {
             position.x.getImpl()->parentWidget = this;
             position.x.getImpl()->recalculate();
         }
-        if (position.y.getImpl()->parentWidget != this)
+        if ((position.y.getImpl()->operation == LayoutImpl::Operation::String) && (position.y.getImpl()->parentWidget != this))
         {
             position.y.getImpl()->parentWidget = this;
             position.y.getImpl()->recalculate();
         }
 
+        // The area where the widget was drawn before it moved has to be redrawn as well
+        invalidate();
+
         Transformable::setPosition(position);
 
         m_callback.position = getPosition();
-        sendSignal("PositionChanged", getPosition());
+        LayoutImpl::widgetChanged(this, true, false);
+
+        if (m_parent)
+            m_parent->widgetMouseAreaChanged(this);
+
+        invalidate();
+        sendSignal(m_onPositionChanged, getPosition());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setSize(const Layout2d& size)
     {
-        if (size.x.getImpl()->parentWidget != this)
+        // Only layouts that are defined by a string depend on the widget to which they belong
+        if ((size.x.getImpl()->operation == LayoutImpl::Operation::String) && (size.x.getImpl()->parentWidget != this))
         {
             size.x.getImpl()->parentWidget = this;
             size.x.getImpl()->recalculate();
         }
-        if (size.y.getImpl()->parentWidget != this)
+        if ((size.y.getImpl()->operation == LayoutImpl::Operation::String) && (size.y.getImpl()->parentWidget != this))
         {
             size.y.getImpl()->parentWidget = this;
             size.y.getImpl()->recalculate();
         }
 
+        // The area where the widget was drawn before it was resized has to be redrawn as well
+        invalidate();
+
         Transformable::setSize(size);
 
         m_callback.size = getSize();
-        sendSignal("SizeChanged", getSize());
+        LayoutImpl::widgetChanged(this, false, true);
+
+        if (m_parent)
+            m_parent->widgetMouseAreaChanged(this);
+
+        invalidate();
+        sendSignal(m_onSizeChanged, getSize());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -243,6 +285,15 @@ namespace tgui
     void Widget::show()
     {
         m_visible = true;
+
+        if (m_parent)
+            m_parent->focusOrderChanged();
+
+        invalidate();
+
+        // Hidden widgets aren't updated, so the updates have to be requested again
+        if (isUpdatedEveryFrame() || isUpdateNeeded())
+            requestUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -304,6 +355,8 @@ namespace tgui
                 break;
             }
         }
+
+        requestUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -314,6 +367,11 @@ namespace tgui
 
         // If the widget is focused then it must be unfocused
         unfocus();
+
+        if (m_parent)
+            m_parent->focusOrderChanged();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -366,6 +424,8 @@ namespace tgui
                 break;
             }
         }
+
+        requestUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -373,6 +433,11 @@ namespace tgui
     void Widget::enable()
     {
         m_enabled = true;
+
+        if (m_parent)
+            m_parent->focusOrderChanged();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -388,6 +453,11 @@ namespace tgui
 
         // If the widget is focused then it must be unfocused
         unfocus();
+
+        if (m_parent)
+            m_parent->focusOrderChanged();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -409,6 +479,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::setTabIndex(int tabIndex)
+    {
+        m_tabIndex = tabIndex;
+
+        if (m_parent)
+            m_parent->focusOrderChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setOpacity(float opacity)
     {
         if (opacity < 0)
@@ -417,6 +497,8 @@ namespace tgui
             m_opacity = 1;
         else
             m_opacity = opacity;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -437,6 +519,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::invalidate()
+    {
+        if (m_parent)
+            m_parent->widgetInvalidated(getDrawnArea());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setToolTip(Widget::Ptr toolTip)
     {
         m_toolTip = toolTip;
@@ -454,6 +544,7 @@ namespace tgui
     void Widget::setFont(const Font& font)
     {
         m_font = font.getFont();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -479,12 +570,19 @@ namespace tgui
     void Widget::setParent(Container* parent)
     {
         m_parent = parent;
+
+        // The renderer tells the widget when one of its properties changes
+        if (m_renderer)
+            m_renderer->m_widget = this;
+
         if (m_parent)
         {
-            m_position.x.getImpl()->recalculate();
-            m_position.y.getImpl()->recalculate();
-            m_size.x.getImpl()->recalculate();
-            m_size.y.getImpl()->recalculate();
+            // Layouts that are defined by a string might refer to the parent or sibling widgets
+            for (auto& layout : {m_position.x.getImpl(), m_position.y.getImpl(), m_size.x.getImpl(), m_size.y.getImpl()})
+            {
+                if (layout->operation == LayoutImpl::Operation::String)
+                    layout->recalculate();
+            }
         }
     }
 
@@ -505,6 +603,76 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::requestUpdates()
+    {
+        if (m_parent && !m_updateRequested)
+            m_parent->widgetNeedsUpdates(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::isUpdateNeeded() const
+    {
+        return !m_showAnimations.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::isUpdatedEveryFrame() const
+    {
+        if (!m_updatedEveryFrame)
+            return false;
+
+        // Only the TGUI widgets know when they need updates, a class derived from them might override update
+        return (m_builtInType == nullptr) || (typeid(*this) != *m_builtInType);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Widget::timeUntilNextUpdate() const
+    {
+        // Animations move or fade the widget on every update
+        if (!m_showAnimations.empty())
+            return sf::Time::Zero;
+        else
+            return sf::microseconds(std::numeric_limits<sf::Int64>::max());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::FloatRect Widget::getDrawnArea() const
+    {
+        return {getAbsolutePosition() - getWidgetOffset(), getFullSize()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::setWidgetType(WidgetTypeId typeId)
+    {
+        m_widgetTypeId = typeId;
+        m_callback.widgetType = WidgetTypes::getName(typeId);
+
+        // Only the TGUI widgets pass an id from their constructor, while constructing typeid returns the class being constructed
+        m_builtInType = &typeid(*this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::setWidgetType(const std::string& type)
+    {
+        m_widgetTypeId = WidgetTypes::getId(type);
+        m_callback.widgetType = type;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::getMouseArea(sf::FloatRect&) const
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::leftMousePressed(float, float)
     {
     }
@@ -545,7 +713,8 @@ namespace tgui
 
     void Widget::widgetFocused()
     {
-        sendSignal("Focused");
+        invalidate();
+        sendSignal(m_onFocused);
 
         // Make sure the parent is also focused
         if (m_parent)
@@ -556,7 +725,8 @@ namespace tgui
 
     void Widget::widgetUnfocused()
     {
-        sendSignal("Unfocused");
+        invalidate();
+        sendSignal(m_onUnfocused);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -608,7 +778,8 @@ namespace tgui
     void Widget::mouseEnteredWidget()
     {
         m_mouseHover = true;
-        sendSignal("MouseEntered");
+        invalidate();
+        sendSignal(m_onMouseEntered);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -616,7 +787,8 @@ namespace tgui
     void Widget::mouseLeftWidget()
     {
         m_mouseHover = false;
-        sendSignal("MouseLeft");
+        invalidate();
+        sendSignal(m_onMouseLeft);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -626,6 +798,15 @@ namespace tgui
         return m_disabledBlockingMouseEvents;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<Signal*> Widget::getSignals()
+    {
+        auto signals = SignalWidgetBase::getSignals();
+        signals.insert(signals.end(), {&m_onPositionChanged, &m_onSizeChanged, &m_onFocused, &m_onUnfocused, &m_onMouseEntered, &m_onMouseLeft});
+        return signals;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -656,6 +837,14 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::invalidateWidget()
+    {
+        if (m_widget)
+            m_widget->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
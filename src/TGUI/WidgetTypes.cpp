@@ -0,0 +1,128 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/WidgetTypes.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Names of the built-in types, in the same order as the WidgetTypes::BuiltIn enum
+        const char* const builtInTypeNames[] =
+        {
+            "Unknown",
+            "Button",
+            "Canvas",
+            "ChatBox",
+            "CheckBox",
+            "ChildWindow",
+            "ClickableWidget",
+            "ComboBox",
+            "EditBox",
+            "FrameStatsOverlay",
+            "Grid",
+            "GuiContainer",
+            "HorizontalLayout",
+            "Knob",
+            "Label",
+            "ListBox",
+            "MenuBar",
+            "MessageBox",
+            "Panel",
+            "Picture",
+            "ProgressBar",
+            "RadioButton",
+            "RichTextLabel",
+            "Scrollbar",
+            "Slider",
+            "SpinButton",
+            "Tab",
+            "Table",
+            "TableItem",
+            "TableRow",
+            "TextBox",
+            "VerticalLayout"
+        };
+
+        static_assert(sizeof(builtInTypeNames) / sizeof(builtInTypeNames[0]) == WidgetTypes::VerticalLayout + 1,
+                      "Every built-in widget type needs a name");
+
+        struct WidgetTypeRegistry
+        {
+            WidgetTypeRegistry()
+            {
+                for (const char* name : builtInTypeNames)
+                {
+                    ids[toLower(name)] = static_cast<WidgetTypeId>(names.size());
+                    names.push_back(name);
+                }
+            }
+
+            std::vector<std::string> names;
+            std::unordered_map<std::string, WidgetTypeId> ids; // Lowercase names
+        };
+
+        // The registry is created on first use, as it is already needed while static members of other classes are initialized
+        WidgetTypeRegistry& getRegistry()
+        {
+            static WidgetTypeRegistry registry;
+            return registry;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetTypeId WidgetTypes::getId(const std::string& type)
+    {
+        auto& registry = getRegistry();
+
+        const auto result = registry.ids.insert({toLower(type), static_cast<WidgetTypeId>(registry.names.size())});
+        if (result.second)
+            registry.names.push_back(type);
+
+        return result.first->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& WidgetTypes::getName(WidgetTypeId id)
+    {
+        const auto& registry = getRegistry();
+        if (id < registry.names.size())
+            return registry.names[id];
+        else
+            return registry.names[Unknown];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Loading/Theme.hpp>
 
@@ -35,9 +36,7 @@ namespace tgui
 
     Button::Button()
     {
-        m_callback.widgetType = "Button";
-
-        addSignal<sf::String>("Pressed");
+        setWidgetType(WidgetTypes::Button);
 
         m_renderer = std::make_shared<ButtonRenderer>(this);
         reload();
@@ -57,6 +56,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> Button::getSignals()
+    {
+        auto signals = ClickableWidget::getSignals();
+        signals.insert(signals.end(), {&m_onPressed});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Button::setPosition(const Layout2d& position)
     {
         Widget::setPosition(position);
@@ -160,6 +168,8 @@ namespace tgui
         // Set the position of the text
         m_text.setPosition(getPosition().x + (getSize().x - m_text.getSize().x) * 0.5f,
                            getPosition().y + (getSize().y - m_text.getSize().y) * 0.5f);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -171,6 +181,8 @@ namespace tgui
 
         // Call setText to reposition the text
         setText(m_string);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -206,6 +218,7 @@ namespace tgui
         ClickableWidget::leftMousePressed(x, y);
 
         m_text.setTextColor(getRenderer()->m_textColorDown);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -213,12 +226,15 @@ namespace tgui
     void Button::leftMouseReleased(float x, float y)
     {
         if (m_mouseDown)
-            sendSignal("Pressed", m_text.getText());
+            sendSignal(m_onPressed, m_text.getText());
 
         ClickableWidget::leftMouseReleased(x, y);
 
         if (m_mouseHover)
+        {
             m_text.setTextColor(getRenderer()->m_textColorHover);
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -226,7 +242,7 @@ namespace tgui
     void Button::keyPressed(const sf::Event::KeyEvent& event)
     {
         if ((event.code == sf::Keyboard::Space) || (event.code == sf::Keyboard::Return))
-            sendSignal("Pressed", m_text.getText());
+            sendSignal(m_onPressed, m_text.getText());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -264,8 +280,13 @@ namespace tgui
 
             // The widget can only be focused when there is an image available for this phase
             if (getRenderer()->m_textureFocused.isLoaded())
+            {
                 m_allowFocus = true;
 
+                if (m_parent)
+                    m_parent->focusOrderChanged();
+            }
+
             if (force)
             {
                 if (getRenderer()->m_textureNormal.isLoaded())
@@ -303,7 +324,7 @@ namespace tgui
         getRenderer()->draw(target, states);
 
         // If the button has a text then also draw the text
-        target.draw(m_text, states);
+        DrawBatcher::draw(target, m_text, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -469,11 +490,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ButtonRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+
+        invalidateWidget();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ButtonRenderer::setTextColor(const Color& color)
     {
         setTextColorNormal(color);
         setTextColorHover(color);
         setTextColorDown(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -484,6 +516,8 @@ namespace tgui
 
         if (!m_button->m_mouseHover)
             m_button->m_text.setTextColor(calcColorOpacity(m_textColorNormal, m_button->getOpacity()));
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -494,6 +528,8 @@ namespace tgui
 
         if (m_button->m_mouseHover && !m_button->m_mouseDown)
             m_button->m_text.setTextColor(calcColorOpacity(m_textColorHover, m_button->getOpacity()));
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -504,6 +540,8 @@ namespace tgui
 
         if (m_button->m_mouseHover && m_button->m_mouseDown)
             m_button->m_text.setTextColor(calcColorOpacity(m_textColorDown, m_button->getOpacity()));
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -513,6 +551,8 @@ namespace tgui
         setBackgroundColorNormal(color);
         setBackgroundColorHover(color);
         setBackgroundColorDown(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -520,6 +560,8 @@ namespace tgui
     void ButtonRenderer::setBackgroundColorNormal(const Color& color)
     {
         m_backgroundColorNormal = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -527,6 +569,8 @@ namespace tgui
     void ButtonRenderer::setBackgroundColorHover(const Color& color)
     {
         m_backgroundColorHover = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -534,6 +578,8 @@ namespace tgui
     void ButtonRenderer::setBackgroundColorDown(const Color& color)
     {
         m_backgroundColorDown = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -541,6 +587,8 @@ namespace tgui
     void ButtonRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -554,6 +602,8 @@ namespace tgui
             m_textureNormal.setSize(m_button->getSize());
             m_textureNormal.setColor({m_textureNormal.getColor().r, m_textureNormal.getColor().g, m_textureNormal.getColor().b, static_cast<sf::Uint8>(m_button->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -567,6 +617,8 @@ namespace tgui
             m_textureHover.setSize(m_button->getSize());
             m_textureHover.setColor({m_textureHover.getColor().r, m_textureHover.getColor().g, m_textureHover.getColor().b, static_cast<sf::Uint8>(m_button->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -580,6 +632,8 @@ namespace tgui
             m_textureDown.setSize(m_button->getSize());
             m_textureDown.setColor({m_textureDown.getColor().r, m_textureDown.getColor().g, m_textureDown.getColor().b, static_cast<sf::Uint8>(m_button->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -593,6 +647,8 @@ namespace tgui
             m_textureFocused.setSize(m_button->getSize());
             m_textureFocused.setColor({m_textureFocused.getColor().r, m_textureFocused.getColor().g, m_textureFocused.getColor().b, static_cast<sf::Uint8>(m_button->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -633,7 +689,7 @@ namespace tgui
             else
                 button.setFillColor(calcColorOpacity(m_backgroundColorNormal, m_button->getOpacity()));
 
-            target.draw(button, states);
+            DrawBatcher::draw(target, button, states);
         }
 
         // Draw the borders around the button
@@ -646,22 +702,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(m_borderColor, m_button->getOpacity()));
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
         }
     }
 
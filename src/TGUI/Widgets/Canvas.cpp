@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Widgets/Canvas.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,7 +34,7 @@ namespace tgui
 
     Canvas::Canvas(const Layout2d& size)
     {
-        m_callback.widgetType = "Canvas";
+        setWidgetType(WidgetTypes::Canvas);
 
         setSize(size);
     }
@@ -125,6 +126,7 @@ namespace tgui
     void Canvas::display()
     {
         m_renderTexture.display();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -140,7 +142,7 @@ namespace tgui
 
     void Canvas::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        target.draw(m_sprite, states);
+        DrawBatcher::draw(target, m_sprite, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
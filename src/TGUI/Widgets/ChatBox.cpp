@@ -23,13 +23,13 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <TGUI/Clipping.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Widgets/ChatBox.hpp>
 #include <TGUI/Loading/Theme.hpp>
 
-#include <SFML/OpenGL.hpp>
-
 #include <cassert>
 #include <cmath>
 
@@ -41,7 +41,7 @@ namespace tgui
 
     ChatBox::ChatBox()
     {
-        m_callback.widgetType = "ChatBox";
+        setWidgetType(WidgetTypes::ChatBox);
         m_draggableWidget = true;
 
         m_renderer = std::make_shared<ChatBoxRenderer>(this);
@@ -176,6 +176,8 @@ namespace tgui
 
         recalculateFullTextHeight();
         updateDisplayedText();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -236,6 +238,7 @@ namespace tgui
 
             recalculateFullTextHeight();
             updateDisplayedText();
+            invalidate();
             return true;
         }
         else // Index too high
@@ -250,6 +253,8 @@ namespace tgui
 
         recalculateFullTextHeight();
         updateDisplayedText();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -276,6 +281,8 @@ namespace tgui
             recalculateFullTextHeight();
             updateDisplayedText();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -320,6 +327,8 @@ namespace tgui
         // There is a minimum text size
         if (m_textSize < 8)
             m_textSize = 8;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -327,6 +336,8 @@ namespace tgui
     void ChatBox::setTextColor(const Color& color)
     {
         m_textColor = color;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -343,6 +354,8 @@ namespace tgui
         }
 
         recalculateAllLines();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -362,6 +375,8 @@ namespace tgui
 
             updateDisplayedText();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -376,6 +391,8 @@ namespace tgui
     void ChatBox::setNewLinesBelowOthers(bool newLinesBelowOthers)
     {
         m_newLinesBelowOthers = newLinesBelowOthers;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -425,6 +442,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ChatBox::getMouseArea(sf::FloatRect& area) const
+    {
+        area = {getPosition().x, getPosition().y, getSize().x, getSize().y};
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::leftMousePressed(float x, float y)
     {
         // Set the mouse down flag to true
@@ -446,6 +471,8 @@ namespace tgui
             // If the value of the scrollbar has changed then update the text
             if (oldValue != m_scroll->getValue())
                 updateDisplayedText();
+
+            invalidate();
         }
     }
 
@@ -494,6 +521,8 @@ namespace tgui
 
                     updateDisplayedText();
                 }
+
+                invalidate();
             }
         }
     }
@@ -511,6 +540,10 @@ namespace tgui
             x -= getPosition().x;
             y -= getPosition().y;
 
+            // Only redraw the chat box when the look of the scrollbar changed
+            const bool oldScrollbarHover = m_scroll->m_mouseHover;
+            const auto oldScrollbarHoverPart = m_scroll->m_mouseHoverOverPart;
+
             // Check if you are dragging the thumb of the scrollbar
             if ((m_scroll->m_mouseDown) && (m_scroll->m_mouseDownOnThumb))
             {
@@ -523,6 +556,8 @@ namespace tgui
                 // If the value of the scrollbar has changed then update the text
                 if (oldValue != m_scroll->getValue())
                     updateDisplayedText();
+
+                invalidate();
             }
             else // You are just moving the mouse
             {
@@ -531,6 +566,9 @@ namespace tgui
                     m_scroll->mouseMoved(x, y);
                 else
                     m_scroll->mouseNoLongerOnWidget();
+
+                if ((m_scroll->m_mouseHover != oldScrollbarHover) || (m_scroll->m_mouseHoverOverPart != oldScrollbarHoverPart))
+                    invalidate();
             }
         }
     }
@@ -552,8 +590,11 @@ namespace tgui
     {
         Widget::mouseNoLongerDown();
 
-        if (m_scroll != nullptr)
+        if ((m_scroll != nullptr) && m_scroll->m_mouseDown)
+        {
             m_scroll->m_mouseDown = false;
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -584,6 +625,7 @@ namespace tgui
 
                 updateDisplayedText();
                 mouseMoved(static_cast<float>(x), static_cast<float>(y));
+                invalidate();
             }
         }
     }
@@ -817,10 +859,6 @@ namespace tgui
 
         const sf::View& view = target.getView();
 
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
         // Get the global position
         Padding padding = getRenderer()->getScaledPadding();
         sf::Vector2f topLeftPosition = {((getAbsolutePosition().x + padding.left - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
@@ -828,34 +866,19 @@ namespace tgui
         sf::Vector2f bottomRightPosition = {(getAbsolutePosition().x + getSize().x - padding.right - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
                                             (getAbsolutePosition().y + getSize().y - padding.bottom - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top)};
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = std::max(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = std::max(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = std::min(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = std::min(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        Clipping::push(target, topLeftPosition, bottomRightPosition);
 
         // Draw the text
         for (auto& line : m_lines)
-            target.draw(line.text, states);
+            DrawBatcher::draw(target, line.text, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        Clipping::pop();
 
         // Draw the scrollbar if there is one
         if (m_scroll != nullptr)
-            target.draw(*m_scroll, states);
+            DrawBatcher::draw(target, *m_scroll, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -981,9 +1004,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ChatBoxRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+
+        invalidateWidget();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBoxRenderer::setBorderColor(const Color& borderColor)
     {
         m_borderColor = borderColor;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -991,6 +1025,8 @@ namespace tgui
     void ChatBoxRenderer::setBackgroundColor(const Color& backgroundColor)
     {
         m_backgroundColor = backgroundColor;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1003,6 +1039,8 @@ namespace tgui
             m_backgroundTexture.setSize(m_chatBox->getSize());
             m_backgroundTexture.setColor({m_backgroundTexture.getColor().r, m_backgroundTexture.getColor().g, m_backgroundTexture.getColor().b, static_cast<sf::Uint8>(m_chatBox->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1012,6 +1050,8 @@ namespace tgui
         WidgetPadding::setPadding(padding);
 
         m_chatBox->updateRendering();
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1024,7 +1064,7 @@ namespace tgui
         {
             sf::RectangleShape background(m_chatBox->getSize());
             background.setFillColor(calcColorOpacity(m_backgroundColor, m_chatBox->getOpacity()));
-            target.draw(background, states);
+            DrawBatcher::draw(target, background, states);
         }
 
         if (m_borders != Borders{0, 0, 0, 0})
@@ -1036,22 +1076,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition({position.x - m_borders.left, position.y - m_borders.top});
             border.setFillColor(calcColorOpacity(m_borderColor, m_chatBox->getOpacity()));
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition({position.x, position.y - m_borders.top});
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition({position.x + size.x, position.y});
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition({position.x - m_borders.left, position.y + size.y});
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
         }
     }
 
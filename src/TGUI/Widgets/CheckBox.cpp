@@ -23,11 +23,11 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <TGUI/Clipping.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Widgets/CheckBox.hpp>
 
-#include <SFML/OpenGL.hpp>
-
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,7 +38,7 @@ namespace tgui
 
     CheckBox::CheckBox()
     {
-        m_callback.widgetType = "CheckBox";
+        setWidgetType(WidgetTypes::CheckBox);
 
         m_renderer = std::make_shared<CheckBoxRenderer>(this);
         reload();
@@ -65,7 +65,9 @@ namespace tgui
             m_checked = true;
 
             m_callback.checked = true;
-            sendSignal("Checked", m_checked);
+            sendSignal(m_onChecked, m_checked);
+
+            invalidate();
         }
     }
 
@@ -78,7 +80,9 @@ namespace tgui
             m_checked = false;
 
             m_callback.checked = false;
-            sendSignal("Unchecked", m_checked);
+            sendSignal(m_onUnchecked, m_checked);
+
+            invalidate();
         }
     }
 
@@ -164,7 +168,7 @@ namespace tgui
                     rect.setOutlineColor(calcColorOpacity(m_backgroundColorNormal, m_radioButton->getOpacity()));
                 }
 
-                target.draw(rect, states);
+                DrawBatcher::draw(target, rect, states);
             }
             else // Draw background and foreground separately
             {
@@ -182,19 +186,19 @@ namespace tgui
 
                     border.setSize({m_padding.left, size.y - m_padding.top});
                     border.setPosition(position.x, position.y + m_padding.top);
-                    target.draw(border, states);
+                    DrawBatcher::draw(target, border, states);
 
                     border.setSize({size.x - m_padding.right, m_padding.top});
                     border.setPosition(position.x, position.y);
-                    target.draw(border, states);
+                    DrawBatcher::draw(target, border, states);
 
                     border.setSize({m_padding.right, size.y - m_padding.bottom});
                     border.setPosition(position.x + size.x - m_padding.right, position.y);
-                    target.draw(border, states);
+                    DrawBatcher::draw(target, border, states);
 
                     border.setSize({size.x - m_padding.left, m_padding.bottom});
                     border.setPosition(position.x + m_padding.left, position.y + size.y - m_padding.top);
-                    target.draw(border, states);
+                    DrawBatcher::draw(target, border, states);
                 }
 
                 // Draw the foreground
@@ -207,7 +211,7 @@ namespace tgui
                     else
                         foreground.setFillColor(calcColorOpacity(m_foregroundColorNormal, m_radioButton->getOpacity()));
 
-                    target.draw(foreground, states);
+                    DrawBatcher::draw(target, foreground, states);
                 }
             }
 
@@ -217,10 +221,7 @@ namespace tgui
                 sf::Vector2f position = m_radioButton->getPosition();
                 sf::Vector2f size = m_radioButton->getSize();
 
-                // Calculate the scale factor of the view
                 const sf::View& view = target.getView();
-                float scaleViewX = target.getSize().x / view.getSize().x;
-                float scaleViewY = target.getSize().y / view.getSize().y;
 
                 Padding padding{m_padding.left + 1, m_padding.top + 1, m_padding.left + 1, m_padding.top + 1};
 
@@ -230,23 +231,8 @@ namespace tgui
                 sf::Vector2f bottomRightPosition = {(m_radioButton->getAbsolutePosition().x + size.x - padding.right - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
                                                     (m_radioButton->getAbsolutePosition().y + size.y - padding.bottom - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top)};
 
-                // Get the old clipping area
-                GLint scissor[4];
-                glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-                // Calculate the clipping area
-                GLint scissorLeft = std::max(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-                GLint scissorTop = std::max(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-                GLint scissorRight = std::min(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-                GLint scissorBottom = std::min(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-                if (scissorRight < scissorLeft)
-                    scissorRight = scissorLeft;
-                else if (scissorBottom < scissorTop)
-                    scissorTop = scissorBottom;
-
                 // Set the clipping area
-                glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+                Clipping::push(target, topLeftPosition, bottomRightPosition);
 
                 sf::Vector2f leftPoint = {position.x + padding.left, position.y + (size.y * 5/12)};
                 sf::Vector2f middlePoint = {position.x + (size.x / 2), position.y + size.y - padding.bottom};
@@ -273,11 +259,11 @@ namespace tgui
                     right.setFillColor(calcColorOpacity(m_checkColorNormal, m_radioButton->getOpacity()));
                 }
 
-                target.draw(left, states);
-                target.draw(right, states);
+                DrawBatcher::draw(target, left, states);
+                DrawBatcher::draw(target, right, states);
 
                 // Reset the old clipping area
-                glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+                Clipping::pop();
             }
         }
     }
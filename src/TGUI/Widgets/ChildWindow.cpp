@@ -23,11 +23,11 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <TGUI/Clipping.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Widgets/ChildWindow.hpp>
 #include <TGUI/Loading/Theme.hpp>
 
-#include <SFML/OpenGL.hpp>
-
 #include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -54,12 +54,7 @@ namespace tgui
 
     ChildWindow::ChildWindow()
     {
-        m_callback.widgetType = "ChildWindow";
-
-        addSignal<sf::Vector2f>("MousePressed");
-        addSignal<ChildWindow::Ptr>("Closed");
-        addSignal<ChildWindow::Ptr>("Minimized");
-        addSignal<ChildWindow::Ptr>("Maximized");
+        setWidgetType(WidgetTypes::ChildWindow);
 
         m_minimizeButton->hide();
         m_maximizeButton->hide();
@@ -84,6 +79,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> ChildWindow::getSignals()
+    {
+        auto signals = Container::getSignals();
+        signals.insert(signals.end(), {&m_onMousePressed, &m_onClosed, &m_onMinimized, &m_onMaximized});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChildWindow::setPosition(const Layout2d& position)
     {
         float x = position.getValue().x;
@@ -200,6 +204,8 @@ namespace tgui
         }
 
         m_maximumSize = size;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -220,6 +226,8 @@ namespace tgui
         }
 
         m_minimumSize = size;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -268,6 +276,8 @@ namespace tgui
 
         // Reposition the images and text
         updatePosition();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -281,6 +291,8 @@ namespace tgui
         m_closeButton->setText(m_closeButtonText);
         m_minimizeButton->setText(m_minimizeButtonText);
         m_maximizeButton->setText(m_maximizeButtonText);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -291,6 +303,8 @@ namespace tgui
 
         // Reposition the images and text
         updatePosition();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -314,6 +328,8 @@ namespace tgui
             m_maximizeButton->show();
         else
             m_maximizeButton->hide();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,6 +338,8 @@ namespace tgui
     {
         m_iconTexture = icon;
         updateSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -343,6 +361,8 @@ namespace tgui
     void ChildWindow::setResizable(bool resizable)
     {
         m_resizable = resizable;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -372,6 +392,8 @@ namespace tgui
     {
         m_closeButton = closeButton;
         updatePosition();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -387,6 +409,8 @@ namespace tgui
     {
         m_minimizeButton = minimizeButton;
         updatePosition();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -402,6 +426,8 @@ namespace tgui
     {
         m_maximizeButton = maximizeButton;
         updatePosition();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -447,7 +473,7 @@ namespace tgui
 
         m_callback.mouse.x = static_cast<int>(x - getPosition().x);
         m_callback.mouse.y = static_cast<int>(y - getPosition().y);
-        sendSignal("MousePressed", sf::Vector2f{x - getPosition().x, y - getPosition().y});
+        sendSignal(m_onMousePressed, sf::Vector2f{x - getPosition().x, y - getPosition().y});
 
         // Check if the mouse is on top of the title bar
         if (sf::FloatRect{getPosition().x, getPosition().y, getSize().x + getRenderer()->getBorders().left + getRenderer()->getBorders().right, getRenderer()->m_titleBarHeight}.contains(x, y))
@@ -474,6 +500,8 @@ namespace tgui
                 m_draggingPosition.y = y - getPosition().y;
             }
 
+            // The buttons in the title bar don't have a parent that could be told that they changed
+            invalidate();
             return;
         }
         else // The mouse is not on top of the title bar
@@ -482,7 +510,10 @@ namespace tgui
             for (auto& button : {m_closeButton, m_maximizeButton, m_minimizeButton})
             {
                 if (button->m_mouseHover)
+                {
                     button->mouseNoLongerOnWidget();
+                    invalidate();
+                }
             }
 
             // Check if the mouse is on top of the borders
@@ -546,8 +577,8 @@ namespace tgui
                 // Check if the mouse is still on the close button
                 if (m_closeButton->mouseOnWidget(x, y))
                 {
-                    if (isSignalBound("closed"))
-                        sendSignal("closed", std::static_pointer_cast<ChildWindow>(shared_from_this()));
+                    if (isSignalBound(m_onClosed))
+                        sendSignal(m_onClosed, std::static_pointer_cast<ChildWindow>(shared_from_this()));
                     else // The user won't stop the closing, so destroy the window
                     {
                         destroy();
@@ -561,8 +592,8 @@ namespace tgui
                 // Check if the mouse is still on the minimize button
                 if (m_minimizeButton->mouseOnWidget(x, y))
                 {
-                    if (isSignalBound("minimized"))
-                        sendSignal("minimized", std::static_pointer_cast<ChildWindow>(shared_from_this()));
+                    if (isSignalBound(m_onMinimized))
+                        sendSignal(m_onMinimized, std::static_pointer_cast<ChildWindow>(shared_from_this()));
                 }
             }
 
@@ -572,8 +603,8 @@ namespace tgui
                 // Check if the mouse is still on the minimize button
                 if (m_maximizeButton->mouseOnWidget(x, y))
                 {
-                    if (isSignalBound("maximized"))
-                        sendSignal("maximized", std::static_pointer_cast<ChildWindow>(shared_from_this()));
+                    if (isSignalBound(m_onMaximized))
+                        sendSignal(m_onMaximized, std::static_pointer_cast<ChildWindow>(shared_from_this()));
                 }
             }
 
@@ -584,6 +615,9 @@ namespace tgui
             // When the mouse is not on the title bar, the mouse can't be on the button inside it
             for (auto& button : {m_closeButton, m_maximizeButton, m_minimizeButton})
             {
+                if (button->m_mouseHover || button->m_mouseDown)
+                    invalidate();
+
                 if (button->m_mouseHover)
                     button->mouseNoLongerOnWidget();
 
@@ -597,8 +631,7 @@ namespace tgui
                                 getSize().x, getSize().y}.contains(x, y)))
             {
                 // Tell the widgets about that the mouse was released
-                for (unsigned int i = 0; i < m_widgets.size(); ++i)
-                    m_widgets[i]->mouseNoLongerDown();
+                mouseNoLongerDownOnWidgets();
 
                 // Don't send the event to the widgets
                 return;
@@ -658,10 +691,15 @@ namespace tgui
             // Send the hover event to the button inside the title bar
             for (auto& button : {m_closeButton, m_maximizeButton, m_minimizeButton})
             {
+                const bool mouseWasOnButton = button->m_mouseHover;
+
                 if (button->mouseOnWidget(x, y))
                     button->mouseMoved(x, y);
                 else
                     button->mouseNoLongerOnWidget();
+
+                if (button->m_mouseHover != mouseWasOnButton)
+                    invalidate();
             }
 
             return;
@@ -672,7 +710,10 @@ namespace tgui
             for (auto& button : {m_closeButton, m_maximizeButton, m_minimizeButton})
             {
                 if (button->m_mouseHover)
+                {
                     button->mouseNoLongerOnWidget();
+                    invalidate();
+                }
             }
 
             // Check if the mouse is on top of the borders
@@ -703,6 +744,10 @@ namespace tgui
     void ChildWindow::mouseNoLongerOnWidget()
     {
         Container::mouseNoLongerOnWidget();
+
+        if (m_closeButton->m_mouseHover || m_minimizeButton->m_mouseHover || m_maximizeButton->m_mouseHover)
+            invalidate();
+
         m_closeButton->mouseNoLongerOnWidget();
         m_minimizeButton->mouseNoLongerOnWidget();
         m_maximizeButton->mouseNoLongerOnWidget();
@@ -713,6 +758,10 @@ namespace tgui
     void ChildWindow::mouseNoLongerDown()
     {
         Container::mouseNoLongerDown();
+
+        if (m_closeButton->m_mouseDown || m_minimizeButton->m_mouseDown || m_maximizeButton->m_mouseDown)
+            invalidate();
+
         m_closeButton->mouseNoLongerDown();
         m_minimizeButton->mouseNoLongerDown();
         m_maximizeButton->mouseNoLongerDown();
@@ -796,10 +845,7 @@ namespace tgui
         if (m_iconTexture.isLoaded())
             target.draw(m_iconTexture, states);
 
-        // Calculate the scale factor of the view
         const sf::View& view = target.getView();
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
 
         // Get the global position
         sf::Vector2f topLeftPanelPosition = {((getAbsolutePosition().x + getRenderer()->m_borders.left - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
@@ -835,32 +881,17 @@ namespace tgui
                                         - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
                                        (getAbsolutePosition().y + getRenderer()->m_titleBarHeight - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top)};
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
         // Check if there is a title
         if (!m_titleText.getText().isEmpty())
         {
-            // Calculate the clipping area
-            GLint scissorLeft = std::max(static_cast<GLint>(topLeftTitleBarPosition.x * scaleViewX), scissor[0]);
-            GLint scissorTop = std::max(static_cast<GLint>(topLeftTitleBarPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-            GLint scissorRight = std::min(static_cast<GLint>(bottomRightTitleBarPosition.x * scaleViewX), scissor[0] + scissor[2]);
-            GLint scissorBottom = std::min(static_cast<GLint>(bottomRightTitleBarPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-            if (scissorRight < scissorLeft)
-                scissorRight = scissorLeft;
-            else if (scissorBottom < scissorTop)
-                scissorTop = scissorBottom;
-
             // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+            Clipping::push(target, topLeftTitleBarPosition, bottomRightTitleBarPosition);
 
             // Draw the text in the title bar
-            target.draw(m_titleText, states);
+            DrawBatcher::draw(target, m_titleText, states);
 
             // Reset the old clipping area
-            glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+            Clipping::pop();
         }
 
 
@@ -871,28 +902,17 @@ namespace tgui
         {
             sf::RectangleShape background(getSize());
             background.setFillColor(calcColorOpacity(getRenderer()->m_backgroundColor, getOpacity()));
-            target.draw(background, states);
+            DrawBatcher::draw(target, background, states);
         }
 
-        // Calculate the clipping area
-        GLint scissorLeft = std::max(static_cast<GLint>(topLeftPanelPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = std::max(static_cast<GLint>(topLeftPanelPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = std::min(static_cast<GLint>(bottomRightPanelPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = std::min(static_cast<GLint>(bottomRightPanelPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        Clipping::push(target, topLeftPanelPosition, bottomRightPanelPosition);
 
         // Draw the widgets in the child window
         drawWidgetContainer(&target, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        Clipping::pop();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1154,6 +1174,8 @@ namespace tgui
     void ChildWindowRenderer::setTitleBarColor(const Color& color)
     {
         m_titleBarColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1181,6 +1203,8 @@ namespace tgui
 
         // Reposition the images and text
         m_childWindow->updatePosition();
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1189,6 +1213,8 @@ namespace tgui
     {
         m_titleColor = color;
         m_childWindow->m_titleText.setTextColor(calcColorOpacity(m_titleColor, m_childWindow->getOpacity()));
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1196,6 +1222,8 @@ namespace tgui
     void ChildWindowRenderer::setBorderColor(const Color& borderColor)
     {
         m_borderColor = borderColor;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1208,6 +1236,8 @@ namespace tgui
 
         // Reposition the images and text
         m_childWindow->updatePosition();
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1218,6 +1248,8 @@ namespace tgui
 
         // Reposition the images and text
         m_childWindow->updatePosition();
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1228,6 +1260,8 @@ namespace tgui
 
         // Reposition the images and text
         m_childWindow->updatePosition();
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1235,6 +1269,8 @@ namespace tgui
     void ChildWindowRenderer::setBackgroundColor(const Color& backgroundColor)
     {
         m_backgroundColor = backgroundColor;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1250,6 +1286,8 @@ namespace tgui
         }
 
         setTitleBarHeight(m_titleBarHeight);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1285,18 +1323,18 @@ namespace tgui
             sf::RectangleShape titleBar{{m_childWindow->getSize().x + m_borders.left + m_borders.right, m_titleBarHeight}};
             titleBar.setPosition({m_childWindow->getPosition().x, m_childWindow->getPosition().y});
             titleBar.setFillColor(calcColorOpacity(m_titleBarColor, m_childWindow->getOpacity()));
-            target.draw(titleBar, states);
+            DrawBatcher::draw(target, titleBar, states);
         }
 
         // Draw the buttons
         if (m_childWindow->m_closeButton->isVisible())
-            target.draw(*m_childWindow->m_closeButton, states);
+            DrawBatcher::draw(target, *m_childWindow->m_closeButton, states);
 
         if (m_childWindow->m_minimizeButton->isVisible())
-            target.draw(*m_childWindow->m_minimizeButton, states);
+            DrawBatcher::draw(target, *m_childWindow->m_minimizeButton, states);
 
         if (m_childWindow->m_maximizeButton->isVisible())
-            target.draw(*m_childWindow->m_maximizeButton, states);
+            DrawBatcher::draw(target, *m_childWindow->m_maximizeButton, states);
 
         // Draw the borders
         if (m_borders != Borders{0, 0, 0, 0})
@@ -1308,22 +1346,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x, position.y);
             border.setFillColor(calcColorOpacity(m_borderColor, m_childWindow->getOpacity()));
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x + m_borders.left, position.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x + m_borders.left, position.y + m_borders.top);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x, position.y + size.y + m_borders.top);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
         }
     }
 
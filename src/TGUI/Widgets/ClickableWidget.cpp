@@ -33,11 +33,7 @@ namespace tgui
 
     ClickableWidget::ClickableWidget(const Layout2d& size)
     {
-        m_callback.widgetType = "ClickableWidget";
-
-        addSignal<sf::Vector2f>("MousePressed");
-        addSignal<sf::Vector2f>("MouseReleased");
-        addSignal<sf::Vector2f>("Clicked");
+        setWidgetType(WidgetTypes::ClickableWidget);
 
         setSize(size);
     }
@@ -61,6 +57,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> ClickableWidget::getSignals()
+    {
+        auto signals = Widget::getSignals();
+        signals.insert(signals.end(), {&m_onMousePressed, &m_onMouseReleased, &m_onClicked});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ClickableWidget::mouseOnWidget(float x, float y) const
     {
         return sf::FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(x, y);
@@ -68,13 +73,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ClickableWidget::getMouseArea(sf::FloatRect& area) const
+    {
+        area = {getPosition().x, getPosition().y, getSize().x, getSize().y};
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ClickableWidget::leftMousePressed(float x, float y)
     {
         m_mouseDown = true;
 
         m_callback.mouse.x = static_cast<int>(x - getPosition().x);
         m_callback.mouse.y = static_cast<int>(y - getPosition().y);
-        sendSignal("MousePressed", sf::Vector2f{x - getPosition().x, y - getPosition().y});
+        sendSignal(m_onMousePressed, sf::Vector2f{x - getPosition().x, y - getPosition().y});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -83,10 +96,10 @@ namespace tgui
     {
         m_callback.mouse.x = static_cast<int>(x - getPosition().x);
         m_callback.mouse.y = static_cast<int>(y - getPosition().y);
-        sendSignal("MouseReleased", sf::Vector2f{x - getPosition().x, y - getPosition().y});
+        sendSignal(m_onMouseReleased, sf::Vector2f{x - getPosition().x, y - getPosition().y});
 
         if (m_mouseDown)
-            sendSignal("Clicked", sf::Vector2f{x - getPosition().x, y - getPosition().y});
+            sendSignal(m_onClicked, sf::Vector2f{x - getPosition().x, y - getPosition().y});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
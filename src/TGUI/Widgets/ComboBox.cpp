@@ -23,9 +23,9 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <SFML/OpenGL.hpp>
-
+#include <TGUI/Clipping.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/ComboBox.hpp>
 
@@ -37,11 +37,9 @@ namespace tgui
 
     ComboBox::ComboBox()
     {
-        m_callback.widgetType = "ComboBox";
+        setWidgetType(WidgetTypes::ComboBox);
         m_draggableWidget = true;
 
-        addSignal<sf::String, TypeSet<sf::String, sf::String>>("ItemSelected");
-
         initListBox();
 
         m_renderer = std::make_shared<ComboBoxRenderer>(this);
@@ -56,7 +54,8 @@ namespace tgui
         Widget              {listBoxToCopy},
         m_nrOfItemsToDisplay{listBoxToCopy.m_nrOfItemsToDisplay},
         m_listBox           {ListBox::copy(listBoxToCopy.m_listBox)},
-        m_text              {listBoxToCopy.m_text}
+        m_text              {listBoxToCopy.m_text},
+        m_onItemSelected    {listBoxToCopy.m_onItemSelected}
     {
         if (m_listBox != nullptr)
         {
@@ -77,6 +76,7 @@ namespace tgui
             std::swap(m_nrOfItemsToDisplay, temp.m_nrOfItemsToDisplay);
             std::swap(m_listBox,            temp.m_listBox);
             std::swap(m_text,               temp.m_text);
+            std::swap(m_onItemSelected,     temp.m_onItemSelected);
         }
 
         return *this;
@@ -94,6 +94,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> ComboBox::getSignals()
+    {
+        auto signals = Widget::getSignals();
+        signals.insert(signals.end(), {&m_onItemSelected});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ComboBox::setPosition(const Layout2d& position)
     {
         Widget::setPosition(position);
@@ -198,6 +207,7 @@ namespace tgui
     {
         bool ret = m_listBox->setSelectedItem(itemName);
         m_text.setText(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -207,6 +217,7 @@ namespace tgui
     {
         bool ret = m_listBox->setSelectedItemById(id);
         m_text.setText(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -216,6 +227,7 @@ namespace tgui
     {
         bool ret = m_listBox->setSelectedItemByIndex(index);
         m_text.setText(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -225,6 +237,7 @@ namespace tgui
     {
         m_text.setText("");
         m_listBox->deselectItem();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,6 +255,7 @@ namespace tgui
             m_listBox->setSize({m_listBox->getSize().x, (m_listBox->getItemHeight() * std::max<std::size_t>(m_listBox->getItemCount(), 1)) + padding.top + padding.bottom});
         }
 
+        invalidate();
         return ret;
     }
 
@@ -260,6 +274,7 @@ namespace tgui
             m_listBox->setSize({m_listBox->getSize().x, (m_listBox->getItemHeight() * std::max<std::size_t>(m_listBox->getItemCount(), 1)) + padding.top + padding.bottom});
         }
 
+        invalidate();
         return ret;
     }
 
@@ -278,6 +293,7 @@ namespace tgui
             m_listBox->setSize({m_listBox->getSize().x, (m_listBox->getItemHeight() * std::max<std::size_t>(m_listBox->getItemCount(), 1)) + padding.top + padding.bottom});
         }
 
+        invalidate();
         return ret;
     }
 
@@ -291,6 +307,8 @@ namespace tgui
         // Shrink the list size
         Padding padding = m_listBox->getRenderer()->getScaledPadding();
         m_listBox->setSize({m_listBox->getSize().x, m_listBox->getItemHeight() + padding.top + padding.bottom});
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -299,6 +317,7 @@ namespace tgui
     {
         bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setText(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -308,6 +327,7 @@ namespace tgui
     {
         bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setText(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -317,6 +337,7 @@ namespace tgui
     {
         bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setText(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -369,6 +390,8 @@ namespace tgui
             m_listBox->setSelectedItemByIndex(static_cast<std::size_t>(m_listBox->getSelectedItemIndex()));
         else
             m_listBox->deselectItem();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -398,6 +421,7 @@ namespace tgui
     {
         m_listBox->setTextSize(textSize);
         m_text.setTextSize(m_listBox->getTextSize());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -478,6 +502,9 @@ namespace tgui
         }
         else // This list was already open, so close it now
             hideListBox();
+
+        // The arrow points in the other direction
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -502,6 +529,7 @@ namespace tgui
             }
 
             m_text.setText(m_listBox->getSelectedItem());
+            invalidate();
         }
     }
 
@@ -595,7 +623,7 @@ namespace tgui
 
         m_callback.text   = m_listBox->getSelectedItem();
         m_callback.itemId = m_listBox->getSelectedItemId();
-        sendSignal("ItemSelected", m_listBox->getSelectedItem(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
+        sendSignal(m_onItemSelected, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -615,10 +643,6 @@ namespace tgui
 
         const sf::View& view = target.getView();
 
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
         Padding padding = getRenderer()->getScaledPadding();
 
         float arrowWidth;
@@ -633,29 +657,14 @@ namespace tgui
         sf::Vector2f bottomRightPosition = {(getAbsolutePosition().x + (getSize().x - padding.right - arrowWidth) - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
                                             (getAbsolutePosition().y + (getSize().y - padding.bottom) - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top)};
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = std::max(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = std::max(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = std::min(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = std::min(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        Clipping::push(target, topLeftPosition, bottomRightPosition);
 
         // Draw the selected item
-        target.draw(m_text, states);
+        DrawBatcher::draw(target, m_text, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        Clipping::pop();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -872,6 +881,8 @@ namespace tgui
     void ComboBoxRenderer::setBackgroundColor(const Color& backgroundColor)
     {
         getListBox()->setBackgroundColor(backgroundColor);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -880,6 +891,8 @@ namespace tgui
     {
         setArrowBackgroundColorNormal(color);
         setArrowBackgroundColorHover(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -887,6 +900,8 @@ namespace tgui
     void ComboBoxRenderer::setArrowBackgroundColorNormal(const Color& color)
     {
         m_arrowBackgroundColorNormal = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -894,6 +909,8 @@ namespace tgui
     void ComboBoxRenderer::setArrowBackgroundColorHover(const Color& color)
     {
         m_arrowBackgroundColorHover = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -902,6 +919,8 @@ namespace tgui
     {
         setArrowColorNormal(color);
         setArrowColorHover(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -909,6 +928,8 @@ namespace tgui
     void ComboBoxRenderer::setArrowColorNormal(const Color& color)
     {
         m_arrowColorNormal = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -916,6 +937,8 @@ namespace tgui
     void ComboBoxRenderer::setArrowColorHover(const Color& color)
     {
         m_arrowColorHover = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -924,6 +947,8 @@ namespace tgui
     {
         m_textColor = textColor;
         m_comboBox->m_text.setTextColor(calcColorOpacity(m_textColor, m_comboBox->getOpacity()));
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -931,6 +956,8 @@ namespace tgui
     void ComboBoxRenderer::setBorderColor(const Color& borderColor)
     {
         getListBox()->setBorderColor(borderColor);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -944,6 +971,8 @@ namespace tgui
             m_backgroundTexture.setSize(m_comboBox->getSize());
             m_backgroundTexture.setColor({m_backgroundTexture.getColor().r, m_backgroundTexture.getColor().g, m_backgroundTexture.getColor().b, static_cast<sf::Uint8>(m_comboBox->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -960,6 +989,8 @@ namespace tgui
             m_textureArrowUpNormal.setPosition({m_comboBox->getPosition().x + m_comboBox->getSize().x - m_textureArrowUpNormal.getSize().x - padding.right, m_comboBox->getPosition().y + padding.top});
             m_textureArrowUpNormal.setColor({m_textureArrowUpNormal.getColor().r, m_textureArrowUpNormal.getColor().g, m_textureArrowUpNormal.getColor().b, static_cast<sf::Uint8>(m_comboBox->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -976,6 +1007,8 @@ namespace tgui
             m_textureArrowDownNormal.setPosition({m_comboBox->getPosition().x + m_comboBox->getSize().x - m_textureArrowDownNormal.getSize().x - padding.right, m_comboBox->getPosition().y + padding.top});
             m_textureArrowDownNormal.setColor({m_textureArrowDownNormal.getColor().r, m_textureArrowDownNormal.getColor().g, m_textureArrowDownNormal.getColor().b, static_cast<sf::Uint8>(m_comboBox->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -992,6 +1025,8 @@ namespace tgui
             m_textureArrowUpHover.setPosition({m_comboBox->getPosition().x + m_comboBox->getSize().x - m_textureArrowUpHover.getSize().x - padding.right, m_comboBox->getPosition().y + padding.top});
             m_textureArrowUpHover.setColor({m_textureArrowUpHover.getColor().r, m_textureArrowUpHover.getColor().g, m_textureArrowUpHover.getColor().b, static_cast<sf::Uint8>(m_comboBox->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1008,6 +1043,8 @@ namespace tgui
             m_textureArrowDownHover.setPosition({m_comboBox->getPosition().x + m_comboBox->getSize().x - m_textureArrowDownHover.getSize().x - padding.right, m_comboBox->getPosition().y + padding.top});
             m_textureArrowDownHover.setColor({m_textureArrowDownHover.getColor().r, m_textureArrowDownHover.getColor().g, m_textureArrowDownHover.getColor().b, static_cast<sf::Uint8>(m_comboBox->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1016,6 +1053,8 @@ namespace tgui
     {
         WidgetBorders::setBorders(borders);
         getListBox()->setBorders({m_borders.left, 0, m_borders.right, m_borders.bottom});
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1024,6 +1063,8 @@ namespace tgui
     {
         WidgetPadding::setPadding(padding);
         m_comboBox->updateSize();
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1047,7 +1088,7 @@ namespace tgui
             sf::RectangleShape front(size);
             front.setPosition(position);
             front.setFillColor(calcColorOpacity(getListBox()->m_backgroundColor, m_comboBox->getOpacity()));
-            target.draw(front, states);
+            DrawBatcher::draw(target, front, states);
         }
 
         // Draw the borders
@@ -1057,22 +1098,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(getListBox()->m_borderColor, m_comboBox->getOpacity()));
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
         }
 
         // Check if we have textures for the arrow
@@ -1127,8 +1168,8 @@ namespace tgui
                 arrowBackground.setFillColor(calcColorOpacity(m_arrowBackgroundColorNormal, m_comboBox->getOpacity()));
             }
 
-            target.draw(arrowBackground, states);
-            target.draw(arrow, states);
+            DrawBatcher::draw(target, arrowBackground, states);
+            DrawBatcher::draw(target, arrow, states);
         }
     }
 
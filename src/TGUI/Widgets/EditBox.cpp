@@ -23,13 +23,14 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <TGUI/Clipping.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Widgets/EditBox.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Clipboard.hpp>
 
-#include <SFML/OpenGL.hpp>
-
+#include <algorithm>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -46,13 +47,10 @@ namespace tgui
 
     EditBox::EditBox()
     {
-        m_callback.widgetType = "EditBox";
+        setWidgetType(WidgetTypes::EditBox);
         m_draggableWidget = true;
         m_allowFocus = true;
 
-        addSignal<sf::String>("TextChanged");
-        addSignal<sf::String>("ReturnKeyPressed");
-
         m_defaultText.setStyle(sf::Text::Italic);
 
         m_caret.setSize({1, 0});
@@ -75,6 +73,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> EditBox::getSignals()
+    {
+        auto signals = ClickableWidget::getSignals();
+        signals.insert(signals.end(), {&m_onTextChanged, &m_onReturnKeyPressed});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::setPosition(const Layout2d& position)
     {
         Widget::setPosition(position);
@@ -225,6 +232,8 @@ namespace tgui
 
         // Set the caret behind the last character
         setCaretPosition(m_displayedText.getSize());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -232,6 +241,8 @@ namespace tgui
     void EditBox::setDefaultText(const sf::String& text)
     {
         m_defaultText.setString(text);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -255,6 +266,8 @@ namespace tgui
 
         // Call setText to re-position the text
         setText(m_text);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -266,6 +279,8 @@ namespace tgui
 
         // Recalculate the text position
         setText(m_text);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -291,6 +306,8 @@ namespace tgui
             // Set the caret behind the last character
             setCaretPosition(m_displayedText.getSize());
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -299,6 +316,8 @@ namespace tgui
     {
         m_textAlignment = alignment;
         setText(m_text);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -370,6 +389,8 @@ namespace tgui
         }
 
         recalculateTextPositions();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -378,6 +399,8 @@ namespace tgui
     {
         m_caret.setPosition(m_caret.getPosition().x + ((m_caret.getSize().x - width) / 2.0f), m_caret.getPosition().y);
         m_caret.setSize({width, getSize().y - getRenderer()->getScaledPadding().bottom - getRenderer()->getScaledPadding().top});
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -388,6 +411,8 @@ namespace tgui
         m_regex = m_regexString;
 
         setText(m_text);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -410,6 +435,8 @@ namespace tgui
         m_textAfterSelection.setString("");
 
         recalculateTextPositions();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -488,19 +515,21 @@ namespace tgui
 
             // If the next click comes soon enough then it will be a double click
             m_possibleDoubleClick = true;
+            requestUpdates();
         }
 
         // Set the mouse down flag
         m_mouseDown = true;
         m_callback.mouse.x = static_cast<int>(x - getPosition().x);
         m_callback.mouse.y = static_cast<int>(y - getPosition().y);
-        sendSignal("MousePressed", sf::Vector2f{x - getPosition().x, y - getPosition().y});
+        sendSignal(m_onMousePressed, sf::Vector2f{x - getPosition().x, y - getPosition().y});
 
         recalculateTextPositions();
 
         // The caret should be visible
         m_caretVisible = true;
         m_animationTimeElapsed = {};
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -516,6 +545,9 @@ namespace tgui
         // Check if the mouse is hold down (we are selecting multiple characters)
         if (m_mouseDown)
         {
+            const unsigned int oldTextCropPosition = m_textCropPosition;
+            const std::size_t oldSelEnd = m_selEnd;
+
             // Check if there is a text width limit
             if (m_limitTextWidth)
             {
@@ -610,6 +642,9 @@ namespace tgui
 
                 recalculateTextPositions();
             }
+
+            if ((m_textCropPosition != oldTextCropPosition) || (m_selEnd != oldSelEnd))
+                invalidate();
         }
     }
 
@@ -639,6 +674,7 @@ namespace tgui
             // Our caret has moved, it should be visible
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+            invalidate();
         }
         else if (event.code == sf::Keyboard::Right)
         {
@@ -661,6 +697,7 @@ namespace tgui
             // Our caret has moved, it should be visible
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+            invalidate();
         }
         else if (event.code == sf::Keyboard::Home)
         {
@@ -670,6 +707,7 @@ namespace tgui
             // Our caret has moved, it should be visible
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+            invalidate();
         }
         else if (event.code == sf::Keyboard::End)
         {
@@ -679,11 +717,12 @@ namespace tgui
             // Our caret has moved, it should be visible
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+            invalidate();
         }
         else if (event.code == sf::Keyboard::Return)
         {
             m_callback.text = m_text;
-            sendSignal("ReturnKeyPressed", getText());
+            sendSignal(m_onReturnKeyPressed, getText());
         }
         else if (event.code == sf::Keyboard::BackSpace)
         {
@@ -721,9 +760,10 @@ namespace tgui
             // The caret should be visible again
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+            invalidate();
 
             m_callback.text = m_text;
-            sendSignal("TextChanged", getText());
+            sendSignal(m_onTextChanged, getText());
         }
         else if (event.code == sf::Keyboard::Delete)
         {
@@ -760,9 +800,10 @@ namespace tgui
             // The caret should be visible again
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+            invalidate();
 
             m_callback.text = m_text;
-            sendSignal("TextChanged", getText());
+            sendSignal(m_onTextChanged, getText());
         }
         else
         {
@@ -792,7 +833,7 @@ namespace tgui
                         setCaretPosition(oldCaretPos + clipboardContents.getSize());
 
                         m_callback.text = m_text;
-                        sendSignal("TextChanged", getText());
+                        sendSignal(m_onTextChanged, getText());
                     }
                 }
                 else if (event.code == sf::Keyboard::X)
@@ -801,7 +842,7 @@ namespace tgui
                     deleteSelectedCharacters();
 
                     m_callback.text = m_text;
-                    sendSignal("TextChanged", getText());
+                    sendSignal(m_onTextChanged, getText());
                 }
                 else if (event.code == sf::Keyboard::A)
                 {
@@ -867,7 +908,7 @@ namespace tgui
         m_animationTimeElapsed = {};
 
         m_callback.text = m_text;
-        sendSignal("TextChanged", getText());
+        sendSignal(m_onTextChanged, getText());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -878,6 +919,11 @@ namespace tgui
         sf::Keyboard::setVirtualKeyboardVisible(true);
     #endif
 
+        // The caret didn't blink while the widget was unfocused, it is shown right away when the widget gets focused
+        m_caretVisible = true;
+        m_animationTimeElapsed = {};
+        requestUpdates();
+
         Widget::widgetFocused();
     }
 
@@ -1161,6 +1207,7 @@ namespace tgui
 
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
+            invalidate();
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
@@ -1169,15 +1216,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool EditBox::isUpdateNeeded() const
+    {
+        return m_focused || m_possibleDoubleClick || Widget::isUpdateNeeded();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time EditBox::timeUntilNextUpdate() const
+    {
+        // The caret time also ends the double click time, because the widget is focused while waiting for a second click
+        if (!m_focused)
+            return Widget::timeUntilNextUpdate();
+
+        const sf::Time caretTime = (m_animationTimeElapsed < sf::milliseconds(500)) ? (sf::milliseconds(500) - m_animationTimeElapsed) : sf::Time::Zero;
+        return std::min(caretTime, Widget::timeUntilNextUpdate());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         // Draw the background
         getRenderer()->draw(target, states);
 
-        // Calculate the scale factor of the view
         const sf::View& view = target.getView();
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
 
         Padding padding = getRenderer()->getScaledPadding();
 
@@ -1187,47 +1250,32 @@ namespace tgui
         sf::Vector2f bottomRightPosition = {(getAbsolutePosition().x + getSize().x - padding.right - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
                                             (getAbsolutePosition().y + getSize().y - padding.bottom - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top)};
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = std::max(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = std::max(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = std::min(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = std::min(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        Clipping::push(target, topLeftPosition, bottomRightPosition);
 
         if ((m_textBeforeSelection.getString() != "") || (m_textSelection.getString() != ""))
         {
-            target.draw(m_textBeforeSelection, states);
+            DrawBatcher::draw(target, m_textBeforeSelection, states);
 
             if (m_textSelection.getString() != "")
             {
-                target.draw(m_selectedTextBackground, states);
+                DrawBatcher::draw(target, m_selectedTextBackground, states);
 
-                target.draw(m_textSelection, states);
-                target.draw(m_textAfterSelection, states);
+                DrawBatcher::draw(target, m_textSelection, states);
+                DrawBatcher::draw(target, m_textAfterSelection, states);
             }
         }
         else if (m_defaultText.getString() != "")
         {
-            target.draw(m_defaultText, states);
+            DrawBatcher::draw(target, m_defaultText, states);
         }
 
         // Draw the caret
         if ((m_focused) && (m_caretVisible))
-            target.draw(m_caret, states);
+            DrawBatcher::draw(target, m_caret, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        Clipping::pop();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1403,6 +1451,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void EditBoxRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+
+        invalidateWidget();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBoxRenderer::setPadding(const Padding& padding)
     {
         WidgetPadding::setPadding(padding);
@@ -1413,6 +1470,8 @@ namespace tgui
         // Set the size of the caret
         m_editBox->m_caret.setSize({m_editBox->m_caret.getSize().x,
                                     m_editBox->getSize().y - getScaledPadding().bottom - getScaledPadding().top});
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1420,6 +1479,8 @@ namespace tgui
     void EditBoxRenderer::setCaretWidth(float width)
     {
         m_editBox->setCaretWidth(width);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1434,6 +1495,8 @@ namespace tgui
         m_editBox->m_textBeforeSelection.setColor(calcColorOpacity(m_textColor, m_editBox->getOpacity()));
         m_editBox->m_textAfterSelection.setColor(calcColorOpacity(m_textColor, m_editBox->getOpacity()));
 #endif
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1446,6 +1509,8 @@ namespace tgui
 #else
         m_editBox->m_textSelection.setColor(calcColorOpacity(m_selectedTextColor, m_editBox->getOpacity()));
 #endif
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1454,6 +1519,8 @@ namespace tgui
     {
         m_selectedTextBackgroundColor = selectedTextBackgroundColor;
         m_editBox->m_selectedTextBackground.setFillColor(calcColorOpacity(m_selectedTextBackgroundColor, m_editBox->getOpacity()));
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1466,6 +1533,8 @@ namespace tgui
 #else
         m_editBox->m_defaultText.setColor(calcColorOpacity(m_defaultTextColor, m_editBox->getOpacity()));
 #endif
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1474,6 +1543,8 @@ namespace tgui
     {
         setBackgroundColorNormal(color);
         setBackgroundColorHover(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1481,6 +1552,8 @@ namespace tgui
     void EditBoxRenderer::setBackgroundColorNormal(const Color& color)
     {
         m_backgroundColorNormal = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1488,6 +1561,8 @@ namespace tgui
     void EditBoxRenderer::setBackgroundColorHover(const Color& color)
     {
         m_backgroundColorHover = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1496,6 +1571,8 @@ namespace tgui
     {
         m_caretColor = caretColor;
         m_editBox->m_caret.setFillColor(calcColorOpacity(m_caretColor, m_editBox->getOpacity()));
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1503,6 +1580,8 @@ namespace tgui
     void EditBoxRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1516,6 +1595,8 @@ namespace tgui
             m_textureNormal.setSize(m_editBox->getSize());
             m_textureNormal.setColor({m_textureNormal.getColor().r, m_textureNormal.getColor().g, m_textureNormal.getColor().b, static_cast<sf::Uint8>(m_editBox->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1529,6 +1610,8 @@ namespace tgui
             m_textureHover.setSize(m_editBox->getSize());
             m_textureHover.setColor({m_textureHover.getColor().r, m_textureHover.getColor().g, m_textureHover.getColor().b, static_cast<sf::Uint8>(m_editBox->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1542,6 +1625,8 @@ namespace tgui
             m_textureFocused.setSize(m_editBox->getSize());
             m_textureFocused.setColor({m_textureFocused.getColor().r, m_textureFocused.getColor().g, m_textureFocused.getColor().b, static_cast<sf::Uint8>(m_editBox->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1570,7 +1655,7 @@ namespace tgui
             else
                 editBox.setFillColor(calcColorOpacity(m_backgroundColorNormal, m_editBox->getOpacity()));
 
-            target.draw(editBox, states);
+            DrawBatcher::draw(target, editBox, states);
         }
 
         // Draw the borders around the edit box
@@ -1583,22 +1668,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(m_borderColor, m_editBox->getOpacity()));
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
         }
     }
 
@@ -0,0 +1,93 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Widgets/FrameStatsOverlay.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FrameStatsOverlay::FrameStatsOverlay()
+    {
+        setWidgetType(WidgetTypes::FrameStatsOverlay);
+
+        setTextSize(12);
+        setTextColor(sf::Color::White);
+        getRenderer()->setBackgroundColor({0, 0, 0, 180});
+
+        setFrameStats({});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FrameStatsOverlay::Ptr FrameStatsOverlay::copy(FrameStatsOverlay::ConstPtr overlay)
+    {
+        if (overlay)
+            return std::static_pointer_cast<FrameStatsOverlay>(overlay->clone());
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FrameStatsOverlay::setFrameStats(const FrameStats& stats)
+    {
+        m_frameStats = stats;
+
+        setText("Draw calls: " + to_string(stats.drawCalls)
+                + "\nVertices: " + to_string(stats.vertices)
+                + "\nTexture binds: " + to_string(stats.textureBinds)
+                + "\nScissor changes: " + to_string(stats.scissorChanges)
+                + "\nWidgets drawn: " + to_string(stats.widgetsDrawn) + " (" + to_string(stats.widgetsCulled) + " culled)"
+                + "\nUpdate calls: " + to_string(stats.updateCalls)
+                + "\nLayout recalculations: " + to_string(stats.layoutRecalculations)
+                + "\nSignals emitted: " + to_string(stats.signalsEmitted)
+                + "\nEvent time: " + to_string(stats.handleEventTime.asMicroseconds()) + " us"
+                + "\nUpdate time: " + to_string(stats.updateTime.asMicroseconds()) + " us"
+                + "\nDraw time: " + to_string(stats.drawTime.asMicroseconds()) + " us");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const FrameStats& FrameStatsOverlay::getFrameStats() const
+    {
+        return m_frameStats;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FrameStatsOverlay::mouseOnWidget(float, float) const
+    {
+        // The overlay is only for looking at, the widgets below it keep receiving the mouse events
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Widgets/Grid.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,7 +34,7 @@ namespace tgui
 
     Grid::Grid()
     {
-        m_callback.widgetType = "Grid";
+        setWidgetType(WidgetTypes::Grid);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -103,57 +104,33 @@ namespace tgui
 
     bool Grid::remove(const Widget::Ptr& widget)
     {
-        auto callbackIt = m_connectedCallbacks.find(widget);
-        if (callbackIt != m_connectedCallbacks.end())
-            m_connectedCallbacks.erase(callbackIt);
+        // Update the positions of all remaining widgets
+        if (removeFromGrid(widget))
+            updatePositionsOfAllWidgets();
 
-        // Find the widget in the grid
-        for (unsigned int row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (unsigned int col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                {
-                    // Remove the widget from the grid
-                    m_gridWidgets[row].erase(m_gridWidgets[row].begin() + col);
-                    m_objBorders[row].erase(m_objBorders[row].begin() + col);
-                    m_objAlignment[row].erase(m_objAlignment[row].begin() + col);
+        return Container::remove(widget);
+    }
 
-                    // Check if this is the last column
-                    if (m_columnWidth.size() == m_gridWidgets[row].size() + 1)
-                    {
-                        // Check if there is another row with this many columns
-                        bool rowFound = false;
-                        for (unsigned int i = 0; i < m_gridWidgets.size(); ++i)
-                        {
-                            if (m_gridWidgets[i].size() >= m_columnWidth.size())
-                            {
-                                rowFound = true;
-                                break;
-                            }
-                        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                        // Erase the last column if no other row is using it
-                        if (!rowFound)
-                            m_columnWidth.erase(m_columnWidth.end()-1);
-                    }
+    std::size_t Grid::removeIf(const std::function<bool(const Widget::Ptr&)>& predicate)
+    {
+        bool gridChanged = false;
+        const std::size_t removedWidgets = Container::removeIf([&](const Widget::Ptr& widget)
+            {
+                if (!predicate(widget))
+                    return false;
 
-                    // If the row is empty then remove it as well
-                    if (m_gridWidgets[row].empty())
-                    {
-                        m_gridWidgets.erase(m_gridWidgets.begin() + row);
-                        m_objBorders.erase(m_objBorders.begin() + row);
-                        m_objAlignment.erase(m_objAlignment.begin() + row);
-                        m_rowHeight.erase(m_rowHeight.begin() + row);
-                    }
+                if (removeFromGrid(widget))
+                    gridChanged = true;
 
-                    // Update the positions of all remaining widgets
-                    updatePositionsOfAllWidgets();
-                }
-            }
-        }
+                return true;
+            });
 
-        return Container::remove(widget);
+        if (gridChanged)
+            updatePositionsOfAllWidgets();
+
+        return removedWidgets;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -395,6 +372,64 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Grid::removeFromGrid(const Widget::Ptr& widget)
+    {
+        auto callbackIt = m_connectedCallbacks.find(widget);
+        if (callbackIt != m_connectedCallbacks.end())
+            m_connectedCallbacks.erase(callbackIt);
+
+        bool widgetFound = false;
+
+        // Find the widget in the grid
+        for (unsigned int row = 0; row < m_gridWidgets.size(); ++row)
+        {
+            for (unsigned int col = 0; col < m_gridWidgets[row].size(); ++col)
+            {
+                if (m_gridWidgets[row][col] == widget)
+                {
+                    // Remove the widget from the grid
+                    m_gridWidgets[row].erase(m_gridWidgets[row].begin() + col);
+                    m_objBorders[row].erase(m_objBorders[row].begin() + col);
+                    m_objAlignment[row].erase(m_objAlignment[row].begin() + col);
+
+                    // Check if this is the last column
+                    if (m_columnWidth.size() == m_gridWidgets[row].size() + 1)
+                    {
+                        // Check if there is another row with this many columns
+                        bool rowFound = false;
+                        for (unsigned int i = 0; i < m_gridWidgets.size(); ++i)
+                        {
+                            if (m_gridWidgets[i].size() >= m_columnWidth.size())
+                            {
+                                rowFound = true;
+                                break;
+                            }
+                        }
+
+                        // Erase the last column if no other row is using it
+                        if (!rowFound)
+                            m_columnWidth.erase(m_columnWidth.end()-1);
+                    }
+
+                    // If the row is empty then remove it as well
+                    if (m_gridWidgets[row].empty())
+                    {
+                        m_gridWidgets.erase(m_gridWidgets.begin() + row);
+                        m_objBorders.erase(m_objBorders.begin() + row);
+                        m_objAlignment.erase(m_objAlignment.begin() + row);
+                        m_rowHeight.erase(m_rowHeight.begin() + row);
+                    }
+
+                    widgetFound = true;
+                }
+            }
+        }
+
+        return widgetFound;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Grid::updatePositionsOfAllWidgets()
     {
         sf::Vector2f position;
@@ -515,7 +550,7 @@ namespace tgui
                 if (m_gridWidgets[row][col].get() != nullptr)
                 {
                     if (m_gridWidgets[row][col]->isVisible())
-                        target.draw(*m_gridWidgets[row][col], states);
+                        DrawBatcher::draw(target, *m_gridWidgets[row][col], states);
                 }
             }
         }
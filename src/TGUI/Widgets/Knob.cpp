@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Widgets/Knob.hpp>
 #include <TGUI/Loading/Theme.hpp>
 
@@ -37,11 +38,9 @@ namespace tgui
 
     Knob::Knob()
     {
-        m_callback.widgetType = "Knob";
+        setWidgetType(WidgetTypes::Knob);
         m_draggableWidget = true;
 
-        addSignal<int>("ValueChanged");
-
         m_renderer = std::make_shared<KnobRenderer>(this);
         reload();
 
@@ -60,6 +59,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> Knob::getSignals()
+    {
+        auto signals = Widget::getSignals();
+        signals.insert(signals.end(), {&m_onValueChanged});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Knob::setPosition(const Layout2d& position)
     {
         Widget::setPosition(position);
@@ -107,6 +115,8 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -122,6 +132,8 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -144,6 +156,8 @@ namespace tgui
             // The knob might have to point in a different direction even though it has the same value
             recalculateRotation();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -169,6 +183,8 @@ namespace tgui
             // The knob might have to point in a different direction even though it has the same value
             recalculateRotation();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -190,7 +206,9 @@ namespace tgui
             recalculateRotation();
 
             m_callback.value = m_value;
-            sendSignal("ValueChanged", m_value);
+            sendSignal(m_onValueChanged, m_value);
+
+            invalidate();
         }
     }
 
@@ -202,6 +220,8 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -248,6 +268,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Knob::getMouseArea(sf::FloatRect& area) const
+    {
+        area = {getPosition().x, getPosition().y, getSize().x, getSize().y};
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Knob::leftMousePressed(float x, float y)
     {
         // Set the mouse down flag
@@ -276,6 +304,8 @@ namespace tgui
         // Check if the mouse button is down
         if (m_mouseDown)
         {
+            const float oldAngle = m_angle;
+
             // Find out the direction that the knob should now point
             if (compareFloats(x, centerPosition.x))
             {
@@ -375,6 +405,10 @@ namespace tgui
                     setValue(static_cast<int>(((m_angle + (360.0 - m_startRotation)) / allowedAngle * (m_maximum - m_minimum)) + m_minimum));
                 }
             }
+
+            // The knob follows the mouse even when the value didn't change
+            if (!compareFloats(m_angle, oldAngle))
+                invalidate();
         }
     }
 
@@ -581,9 +615,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void KnobRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+
+        invalidateWidget();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void KnobRenderer::setImageRotation(float rotation)
     {
         m_imageRotation = rotation;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -591,6 +636,8 @@ namespace tgui
     void KnobRenderer::setBackgroundColor(const Color& color)
     {
         m_backgroundColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -598,6 +645,8 @@ namespace tgui
     void KnobRenderer::setThumbColor(const Color& color)
     {
         m_thumbColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -605,6 +654,8 @@ namespace tgui
     void KnobRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -619,6 +670,8 @@ namespace tgui
             if (m_foregroundTexture.isLoaded())
                 m_knob->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -638,6 +691,8 @@ namespace tgui
             else
                 m_foregroundTexture.setRotation(360 - m_knob->m_angle + m_imageRotation);
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -658,13 +713,13 @@ namespace tgui
             background.setFillColor(calcColorOpacity(m_backgroundColor, m_knob->getOpacity()));
             background.setOutlineColor(calcColorOpacity(m_borderColor, m_knob->getOpacity()));
             background.setOutlineThickness(std::min({m_borders.left, m_borders.top, m_borders.right, m_borders.bottom}));
-            target.draw(background, states);
+            DrawBatcher::draw(target, background, states);
 
             sf::CircleShape thumb{size / 10.0f};
             thumb.setFillColor(calcColorOpacity(m_thumbColor, m_knob->getOpacity()));
             thumb.setPosition({m_knob->getPosition().x + (size / 2.0f) - thumb.getRadius() + (std::cos(m_knob->m_angle / 180 * pi) * background.getRadius() * 3/5),
                                m_knob->getPosition().y + (size / 2.0f) - thumb.getRadius() + (-std::sin(m_knob->m_angle / 180 * pi) * background.getRadius() * 3/5)});
-            target.draw(thumb, states);
+            DrawBatcher::draw(target, thumb, states);
         }
     }
 
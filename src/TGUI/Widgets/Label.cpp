@@ -23,12 +23,12 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <TGUI/Clipping.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Widgets/Label.hpp>
 #include <TGUI/Loading/Theme.hpp>
 
-#include <SFML/OpenGL.hpp>
-
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -39,9 +39,7 @@ namespace tgui
 
     Label::Label()
     {
-        m_callback.widgetType = "Label";
-
-        addSignal<sf::String>("DoubleClicked");
+        setWidgetType(WidgetTypes::Label);
 
         m_renderer = std::make_shared<LabelRenderer>(this);
         reload();
@@ -61,6 +59,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> Label::getSignals()
+    {
+        auto signals = ClickableWidget::getSignals();
+        signals.insert(signals.end(), {&m_onDoubleClicked});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::setPosition(const Layout2d& position)
     {
         Widget::setPosition(position);
@@ -152,6 +159,8 @@ namespace tgui
     {
         m_string = string;
         rearrangeText();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -163,6 +172,8 @@ namespace tgui
             m_textSize = size;
             rearrangeText();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -178,6 +189,8 @@ namespace tgui
     {
         m_horizontalAlignment = alignment;
         updatePosition();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -193,6 +206,8 @@ namespace tgui
     {
         m_verticalAlignment = alignment;
         updatePosition();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -222,6 +237,8 @@ namespace tgui
     {
         m_textStyle = style;
         rearrangeText();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -240,6 +257,8 @@ namespace tgui
             m_autoSize = autoSize;
             rearrangeText();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -251,6 +270,8 @@ namespace tgui
             m_maximumTextWidth = maximumWidth;
             rearrangeText();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -312,12 +333,13 @@ namespace tgui
                 m_possibleDoubleClick = false;
 
                 m_callback.text = m_string;
-                sendSignal("DoubleClicked", m_string);
+                sendSignal(m_onDoubleClicked, m_string);
             }
             else // This is the first click
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestUpdates();
             }
         }
     }
@@ -350,6 +372,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Label::isUpdateNeeded() const
+    {
+        return m_possibleDoubleClick || Widget::isUpdateNeeded();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Label::timeUntilNextUpdate() const
+    {
+        // The gui has to wake up when the time for the second click runs out
+        if (!m_possibleDoubleClick)
+            return Widget::timeUntilNextUpdate();
+
+        const sf::Time doubleClickTime = (m_animationTimeElapsed < sf::milliseconds(500)) ? (sf::milliseconds(500) - m_animationTimeElapsed) : sf::Time::Zero;
+        return std::min(doubleClickTime, Widget::timeUntilNextUpdate());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::rearrangeText()
     {
         if (!getFont())
@@ -467,6 +508,10 @@ namespace tgui
                       (lineCount * getFont()->getLineSpacing(m_textSize)) + getRenderer()->getPadding().top + getRenderer()->getPadding().bottom};
 
             m_background.setSize(getSize());
+
+            // The size was changed without calling setSize, so the parent has to be informed manually
+            if (m_parent)
+                m_parent->widgetMouseAreaChanged(this);
         }
 
         updatePosition();
@@ -480,55 +525,35 @@ namespace tgui
         {
             // Draw the background
             if (m_background.getFillColor() != sf::Color::Transparent)
-                target.draw(m_background, states);
+                DrawBatcher::draw(target, m_background, states);
 
             // Draw the text
             for (auto& line : m_lines)
-                target.draw(line, states);
+                DrawBatcher::draw(target, line, states);
         }
         else
         {
             const sf::View& view = target.getView();
 
-            // Calculate the scale factor of the view
-            float scaleViewX = target.getSize().x / view.getSize().x;
-            float scaleViewY = target.getSize().y / view.getSize().y;
-
             // Get the global position
             sf::Vector2f topLeftPosition = {((getAbsolutePosition().x + getRenderer()->getPadding().left - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
                                             ((getAbsolutePosition().y + getRenderer()->getPadding().top - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top)};
             sf::Vector2f bottomRightPosition = {(getAbsolutePosition().x + getSize().x - getRenderer()->getPadding().right - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
                                                 (getAbsolutePosition().y + getSize().y - getRenderer()->getPadding().bottom - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top)};
 
-            // Get the old clipping area
-            GLint scissor[4];
-            glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-            // Calculate the clipping area
-            GLint scissorLeft = std::max(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-            GLint scissorTop = std::max(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-            GLint scissorRight = std::min(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-            GLint scissorBottom = std::min(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-            // If the object outside the window then don't draw anything
-            if (scissorRight < scissorLeft)
-                scissorRight = scissorLeft;
-            else if (scissorBottom < scissorTop)
-                scissorTop = scissorBottom;
-
             // Draw the background
             if (m_background.getFillColor() != sf::Color::Transparent)
-                target.draw(m_background, states);
+                DrawBatcher::draw(target, m_background, states);
 
             // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+            Clipping::push(target, topLeftPosition, bottomRightPosition);
 
             // Draw the text
             for (auto& line : m_lines)
-                target.draw(line, states);
+                DrawBatcher::draw(target, line, states);
 
             // Reset the old clipping area
-            glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+            Clipping::pop();
         }
 
         getRenderer()->draw(target, states);
@@ -619,6 +644,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void LabelRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+
+        invalidateWidget();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void LabelRenderer::setPadding(const Padding& padding)
     {
         if (padding != getPadding())
@@ -626,6 +660,8 @@ namespace tgui
             WidgetPadding::setPadding(padding);
             m_label->rearrangeText();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -641,6 +677,8 @@ namespace tgui
 #else
             line.setColor(textColor);
 #endif
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -649,6 +687,8 @@ namespace tgui
     {
         m_backgroundColor = color;
         m_label->m_background.setFillColor(calcColorOpacity(m_backgroundColor, m_label->getOpacity()));
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -656,6 +696,8 @@ namespace tgui
     void LabelRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -672,22 +714,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(m_borderColor, m_label->getOpacity()));
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
         }
     }
 
@@ -23,9 +23,9 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <SFML/OpenGL.hpp>
-
+#include <TGUI/Clipping.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/ListBox.hpp>
 #include <TGUI/Widgets/Label.hpp>
@@ -38,14 +38,9 @@ namespace tgui
 
     ListBox::ListBox()
     {
-        m_callback.widgetType = "ListBox";
+        setWidgetType(WidgetTypes::ListBox);
         m_draggableWidget = true;
 
-        addSignal<sf::String, TypeSet<sf::String, sf::String>>("ItemSelected");
-        addSignal<sf::String, TypeSet<sf::String, sf::String>>("MousePressed");
-        addSignal<sf::String, TypeSet<sf::String, sf::String>>("MouseReleased");
-        addSignal<sf::String, TypeSet<sf::String, sf::String>>("DoubleClicked");
-
         m_renderer = std::make_shared<ListBoxRenderer>(this);
         reload();
 
@@ -66,7 +61,11 @@ namespace tgui
         m_textSize           {listBoxToCopy.m_textSize},
         m_maxItems           {listBoxToCopy.m_maxItems},
         m_scroll             {Scrollbar::copy(listBoxToCopy.m_scroll)},
-        m_possibleDoubleClick{listBoxToCopy.m_possibleDoubleClick}
+        m_possibleDoubleClick{listBoxToCopy.m_possibleDoubleClick},
+        m_onItemSelected     {listBoxToCopy.m_onItemSelected},
+        m_onMousePressed     {listBoxToCopy.m_onMousePressed},
+        m_onMouseReleased    {listBoxToCopy.m_onMouseReleased},
+        m_onDoubleClicked    {listBoxToCopy.m_onDoubleClicked}
     {
     }
 
@@ -89,6 +88,10 @@ namespace tgui
             std::swap(m_maxItems,            temp.m_maxItems);
             std::swap(m_scroll,              temp.m_scroll);
             std::swap(m_possibleDoubleClick, temp.m_possibleDoubleClick);
+            std::swap(m_onItemSelected,      temp.m_onItemSelected);
+            std::swap(m_onMousePressed,      temp.m_onMousePressed);
+            std::swap(m_onMouseReleased,     temp.m_onMouseReleased);
+            std::swap(m_onDoubleClicked,     temp.m_onDoubleClicked);
         }
 
         return *this;
@@ -106,6 +109,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> ListBox::getSignals()
+    {
+        auto signals = Widget::getSignals();
+        signals.insert(signals.end(), {&m_onItemSelected, &m_onMousePressed, &m_onMouseReleased, &m_onDoubleClicked});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::setPosition(const Layout2d& position)
     {
         Widget::setPosition(position);
@@ -215,6 +227,7 @@ namespace tgui
             m_itemIds.push_back(id);
 
             updatePosition();
+            invalidate();
             return true;
         }
         else // The item limit was reached
@@ -279,6 +292,7 @@ namespace tgui
             updatePosition();
         }
 
+        invalidate();
         return true;
     }
 
@@ -290,6 +304,7 @@ namespace tgui
         {
             m_items[m_selectedItem].setTextColor(getRenderer()->m_textColor);
             m_selectedItem = -1;
+            invalidate();
         }
     }
 
@@ -353,6 +368,7 @@ namespace tgui
         if (m_hoveringItem >= 0)
             m_items[m_hoveringItem].setTextColor(getRenderer()->m_hoverTextColor);
 
+        invalidate();
         return true;
     }
 
@@ -371,6 +387,8 @@ namespace tgui
         // If there is a scrollbar then tell it that all item were removed
         if (m_scroll != nullptr)
             m_scroll->setMaximum(0);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -441,6 +459,7 @@ namespace tgui
             return false;
 
         m_items[index].setText(newValue);
+        invalidate();
         return true;
     }
 
@@ -491,6 +510,7 @@ namespace tgui
         }
 
         updatePosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -534,6 +554,7 @@ namespace tgui
         }
 
         updatePosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -558,6 +579,7 @@ namespace tgui
             item.setTextSize(m_textSize);
 
         updatePosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -587,6 +609,8 @@ namespace tgui
                 m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
                 updatePosition();
             }
+
+            invalidate();
         }
     }
 
@@ -627,6 +651,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListBox::getMouseArea(sf::FloatRect& area) const
+    {
+        area = {getPosition().x, getPosition().y, getSize().x, getSize().y};
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::leftMousePressed(float x, float y)
     {
         // If there is a scrollbar then pass the event
@@ -650,7 +682,7 @@ namespace tgui
             {
                 m_callback.text = m_items[m_hoveringItem].getText();
                 m_callback.itemId = m_itemIds[m_hoveringItem];
-                sendSignal("MousePressed", m_items[m_hoveringItem].getText(), m_items[m_hoveringItem].getText(), m_itemIds[m_hoveringItem]);
+                sendSignal(m_onMousePressed, m_items[m_hoveringItem].getText(), m_itemIds[m_hoveringItem]);
             }
 
             if (m_selectedItem != m_hoveringItem)
@@ -668,16 +700,18 @@ namespace tgui
 
                     m_callback.text  = m_items[m_selectedItem].getText();
                     m_callback.itemId = m_itemIds[m_selectedItem];
-                    sendSignal("ItemSelected", m_items[m_selectedItem].getText(), m_items[m_selectedItem].getText(), m_itemIds[m_selectedItem]);
+                    sendSignal(m_onItemSelected, m_items[m_selectedItem].getText(), m_itemIds[m_selectedItem]);
                 }
                 else
                 {
                     m_callback.text  = "";
                     m_callback.itemId = "";
-                    sendSignal("ItemSelected", "", "", "");
+                    sendSignal(m_onItemSelected, "", "");
                 }
             }
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -715,6 +749,7 @@ namespace tgui
             }
 
             updatePosition();
+            invalidate();
         }
 
         if (m_mouseDown)
@@ -723,7 +758,7 @@ namespace tgui
             {
                 m_callback.text  = m_items[m_selectedItem].getText();
                 m_callback.itemId = m_itemIds[m_selectedItem];
-                sendSignal("MouseReleased", m_items[m_selectedItem].getText(), m_items[m_selectedItem].getText(), m_itemIds[m_selectedItem]);
+                sendSignal(m_onMouseReleased, m_items[m_selectedItem].getText(), m_itemIds[m_selectedItem]);
             }
 
             // Check if you double-clicked
@@ -732,12 +767,13 @@ namespace tgui
                 m_possibleDoubleClick = false;
 
                 if (m_selectedItem >= 0)
-                    sendSignal("DoubleClicked", m_items[m_selectedItem].getText(), m_items[m_selectedItem].getText(), m_itemIds[m_selectedItem]);
+                    sendSignal(m_onDoubleClicked, m_items[m_selectedItem].getText(), m_itemIds[m_selectedItem]);
             }
             else // This is the first click
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestUpdates();
             }
         }
     }
@@ -749,6 +785,12 @@ namespace tgui
         if (!m_mouseHover)
             mouseEnteredWidget();
 
+        // Only redraw the list box when the mouse changed what is highlighted
+        const int oldHoveringItem = m_hoveringItem;
+        const int oldSelectedItem = m_selectedItem;
+        const bool oldScrollbarHover = m_scroll && m_scroll->m_mouseHover;
+        const auto oldScrollbarHoverPart = m_scroll ? m_scroll->m_mouseHoverOverPart : Scrollbar::Part::Thumb;
+
         // If there is a scrollbar then pass the event
         bool mouseOnScrollbar = false;
         if (m_scroll != nullptr)
@@ -836,13 +878,13 @@ namespace tgui
 
                         m_callback.text = m_items[m_selectedItem].getText();
                         m_callback.itemId = m_itemIds[m_selectedItem];
-                        sendSignal("ItemSelected", m_items[m_selectedItem].getText(), m_items[m_selectedItem].getText(), m_itemIds[m_selectedItem]);
+                        sendSignal(m_onItemSelected, m_items[m_selectedItem].getText(), m_itemIds[m_selectedItem]);
                     }
                     else
                     {
                         m_callback.text = "";
                         m_callback.itemId = "";
-                        sendSignal("ItemSelected", "", "", "");
+                        sendSignal(m_onItemSelected, "", "");
                     }
                 }
             }
@@ -852,6 +894,13 @@ namespace tgui
                     m_items[m_hoveringItem].setTextColor(getRenderer()->m_hoverTextColor);
             }
         }
+
+        if ((m_hoveringItem != oldHoveringItem) || (m_selectedItem != oldSelectedItem)
+         || (m_scroll && ((m_scroll->m_mouseDown && m_scroll->m_mouseDownOnThumb)
+                       || (m_scroll->m_mouseHover != oldScrollbarHover) || (m_scroll->m_mouseHoverOverPart != oldScrollbarHoverPart))))
+        {
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -882,6 +931,7 @@ namespace tgui
 
                 updatePosition();
                 mouseMoved(static_cast<float>(x), static_cast<float>(y));
+                invalidate();
             }
         }
     }
@@ -911,7 +961,13 @@ namespace tgui
     {
         Widget::mouseNoLongerDown();
         if (m_scroll != nullptr)
+        {
+            // The thumb of the scrollbar may have been dragged between two values
+            if (m_scroll->m_mouseDown)
+                invalidate();
+
             m_scroll->mouseNoLongerDown();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -975,6 +1031,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListBox::isUpdateNeeded() const
+    {
+        return m_possibleDoubleClick || Widget::isUpdateNeeded();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time ListBox::timeUntilNextUpdate() const
+    {
+        // The gui has to wake up when the time for the second click runs out
+        if (!m_possibleDoubleClick)
+            return Widget::timeUntilNextUpdate();
+
+        const sf::Time doubleClickTime = (m_animationTimeElapsed < sf::milliseconds(500)) ? (sf::milliseconds(500) - m_animationTimeElapsed) : sf::Time::Zero;
+        return std::min(doubleClickTime, Widget::timeUntilNextUpdate());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         // Draw the background
@@ -982,10 +1057,6 @@ namespace tgui
 
         const sf::View& view = target.getView();
 
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
         Padding padding = getRenderer()->getScaledPadding();
 
         // Get the global position
@@ -998,23 +1069,8 @@ namespace tgui
         if ((m_scroll != nullptr) && (m_scroll->getLowValue() < m_scroll->getMaximum()))
             bottomRightPosition.x -= m_scroll->getSize().x;
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = std::max(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = std::max(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = std::min(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = std::min(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        Clipping::push(target, topLeftPosition, bottomRightPosition);
 
         // Find out which items are visible
         std::size_t firstItem = 0;
@@ -1039,7 +1095,7 @@ namespace tgui
             if ((m_scroll != nullptr) && (m_scroll->getLowValue() < m_scroll->getMaximum()))
                 back.setPosition({back.getPosition().x, back.getPosition().y - m_scroll->getValue()});
 
-            target.draw(back, states);
+            DrawBatcher::draw(target, back, states);
         }
 
         // Draw the background of the item on which the mouse is standing
@@ -1052,19 +1108,19 @@ namespace tgui
             if ((m_scroll != nullptr) && (m_scroll->getLowValue() < m_scroll->getMaximum()))
                 back.setPosition({back.getPosition().x, back.getPosition().y - m_scroll->getValue()});
 
-            target.draw(back, states);
+            DrawBatcher::draw(target, back, states);
         }
 
         // Draw the items
         for (std::size_t i = firstItem; i < lastItem; ++i)
-            target.draw(m_items[i], states);
+            DrawBatcher::draw(target, m_items[i], states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        Clipping::pop();
 
         // Draw the scrollbar
         if (m_scroll != nullptr)
-            target.draw(*m_scroll, states);
+            DrawBatcher::draw(target, *m_scroll, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1231,9 +1287,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListBoxRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+
+        invalidateWidget();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBoxRenderer::setBackgroundColor(const Color& backgroundColor)
     {
         m_backgroundColor = backgroundColor;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1242,6 +1309,8 @@ namespace tgui
     {
         setTextColorNormal(color);
         setTextColorHover(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1250,6 +1319,8 @@ namespace tgui
     {
         m_textColor = color;
         m_listBox->updateItemColors();
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1258,6 +1329,8 @@ namespace tgui
     {
         m_hoverTextColor = color;
         m_listBox->updateItemColors();
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1265,6 +1338,8 @@ namespace tgui
     void ListBoxRenderer::setHoverBackgroundColor(const Color& hoverBackgroundColor)
     {
         m_hoverBackgroundColor = hoverBackgroundColor;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1272,6 +1347,8 @@ namespace tgui
     void ListBoxRenderer::setSelectedBackgroundColor(const Color& selectedBackgroundColor)
     {
         m_selectedBackgroundColor = selectedBackgroundColor;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1280,6 +1357,8 @@ namespace tgui
     {
         m_selectedTextColor = selectedTextColor;
         m_listBox->updateItemColors();
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1287,6 +1366,8 @@ namespace tgui
     void ListBoxRenderer::setBorderColor(const Color& borderColor)
     {
         m_borderColor = borderColor;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1300,6 +1381,8 @@ namespace tgui
             m_backgroundTexture.setSize(m_listBox->getSize());
             m_backgroundTexture.setColor({m_backgroundTexture.getColor().r, m_backgroundTexture.getColor().g, m_backgroundTexture.getColor().b, static_cast<sf::Uint8>(m_listBox->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1309,6 +1392,8 @@ namespace tgui
         WidgetPadding::setPadding(padding);
 
         m_listBox->updateSize();
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1323,7 +1408,7 @@ namespace tgui
             sf::RectangleShape background(m_listBox->getSize());
             background.setPosition(m_listBox->getPosition());
             background.setFillColor(calcColorOpacity(m_backgroundColor, m_listBox->getOpacity()));
-            target.draw(background, states);
+            DrawBatcher::draw(target, background, states);
         }
 
         // Draw the borders
@@ -1336,22 +1421,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(m_borderColor, m_listBox->getOpacity()));
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
         }
     }
 
@@ -24,11 +24,14 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/MenuBar.hpp>
 
 #include <SFML/OpenGL.hpp>
 
+#include <algorithm>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -37,9 +40,7 @@ namespace tgui
 
     MenuBar::MenuBar()
     {
-        m_callback.widgetType = "MenuBar";
-
-        addSignal<std::vector<sf::String>, sf::String>("MenuItemClicked");
+        setWidgetType(WidgetTypes::MenuBar);
 
         m_renderer = std::make_shared<MenuBarRenderer>(this);
         reload();
@@ -59,6 +60,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> MenuBar::getSignals()
+    {
+        auto signals = Widget::getSignals();
+        signals.insert(signals.end(), {&m_onMenuItemClicked});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBar::setPosition(const Layout2d& position)
     {
         Widget::setPosition(position);
@@ -120,6 +130,7 @@ namespace tgui
 
         // Update the position of the menus
         updatePosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -145,6 +156,7 @@ namespace tgui
                 // Position the new menu item
                 m_menus[i].menuItems.back().setPosition({pos.x + 2 * getRenderer()->m_distanceToSide, pos.y + m_menus[i].menuItems.size() * getSize().y + ((getSize().y - m_menus[i].menuItems.back().getSize().y) / 2.f)});
 
+                invalidate();
                 return true;
             }
 
@@ -165,6 +177,9 @@ namespace tgui
             // If this is the menu then remove it
             if (m_menus[i].text.getText() == menu)
             {
+                // The area of the removed menu has to be redrawn
+                invalidate();
+
                 m_menus.erase(m_menus.begin() + i);
 
                 // The menu was removed, so it can't remain open
@@ -196,6 +211,9 @@ namespace tgui
                     // If this is the menu item then remove it
                     if (m_menus[i].menuItems[j].getText() == menuItem)
                     {
+                        // The area of the removed menu item has to be redrawn
+                        invalidate();
+
                         m_menus[i].menuItems.erase(m_menus[i].menuItems.begin() + j);
 
                         // The item can't still be selected
@@ -218,6 +236,7 @@ namespace tgui
 
     void MenuBar::removeAllMenus()
     {
+        invalidate();
         m_menus.clear();
     }
 
@@ -225,6 +244,8 @@ namespace tgui
 
     void MenuBar::setTextSize(unsigned int size)
     {
+        invalidate();
+
         m_textSize = size;
 
         for (unsigned int i = 0; i < m_menus.size(); ++i)
@@ -237,13 +258,16 @@ namespace tgui
 
         // Update the position of the items
         updatePosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void MenuBar::setMinimumSubMenuWidth(float minimumWidth)
     {
+        invalidate();
         m_minimumSubMenuWidth = minimumWidth;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -284,6 +308,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::FloatRect MenuBar::getDrawnArea() const
+    {
+        // The area also has to contain the menus that are closed, because they have to be erased after closing them
+        sf::FloatRect area = Widget::getDrawnArea();
+
+        float left = 0;
+        for (const auto& menu : m_menus)
+        {
+            float width = m_minimumSubMenuWidth;
+            for (const auto& menuItem : menu.menuItems)
+                width = std::max(width, menuItem.getSize().x + (3 * getRenderer()->m_distanceToSide));
+
+            area.width = std::max(area.width, left + width);
+            area.height = std::max(area.height, getSize().y * (menu.menuItems.size() + 1));
+
+            left += menu.text.getSize().x + (2 * getRenderer()->m_distanceToSide);
+        }
+
+        return area;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool MenuBar::mouseOnWidget(float x, float y) const
     {
         // Check if the mouse is on top of the menu bar
@@ -333,6 +380,8 @@ namespace tgui
                     // Close the menu when it was already open
                     if (m_visibleMenu == static_cast<int>(i))
                     {
+                        invalidate();
+
                         if (m_menus[m_visibleMenu].selectedMenuItem != -1)
                         {
                             m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setTextColor(calcColorOpacity(getRenderer()->m_textColor, getOpacity()));
@@ -348,6 +397,7 @@ namespace tgui
                     {
                         m_menus[i].text.setTextColor(calcColorOpacity(getRenderer()->m_selectedTextColor, getOpacity()));
                         m_visibleMenu = static_cast<int>(i);
+                        invalidate();
                     }
 
                     break;
@@ -374,7 +424,7 @@ namespace tgui
                     m_callback.index = m_visibleMenu;
                     m_callback.text = m_menus[m_visibleMenu].menuItems[selectedMenuItem].getText();
 
-                    sendSignal("MenuItemClicked",
+                    sendSignal(m_onMenuItemClicked,
                                std::vector<sf::String>{m_menus[m_visibleMenu].text.getText(), m_menus[m_visibleMenu].menuItems[selectedMenuItem].getText()},
                                m_menus[m_visibleMenu].menuItems[selectedMenuItem].getText());
 
@@ -412,6 +462,7 @@ namespace tgui
                             {
                                 m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setTextColor(calcColorOpacity(getRenderer()->m_textColor, getOpacity()));
                                 m_menus[m_visibleMenu].selectedMenuItem = -1;
+                                invalidate();
                             }
                         }
                         else // The menu isn't open yet
@@ -424,6 +475,7 @@ namespace tgui
                             {
                                 m_menus[i].text.setTextColor(calcColorOpacity(getRenderer()->m_selectedTextColor, getOpacity()));
                                 m_visibleMenu = static_cast<int>(i);
+                                invalidate();
                             }
                         }
                         break;
@@ -446,6 +498,7 @@ namespace tgui
                 // Mark the item below the mouse as selected
                 m_menus[m_visibleMenu].selectedMenuItem = selectedMenuItem;
                 m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setTextColor(calcColorOpacity(getRenderer()->m_selectedTextColor, getOpacity()));
+                invalidate();
             }
         }
     }
@@ -469,6 +522,7 @@ namespace tgui
         {
             m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setTextColor(calcColorOpacity(getRenderer()->m_textColor, getOpacity()));
             m_menus[m_visibleMenu].selectedMenuItem = -1;
+            invalidate();
         }
 
         Widget::mouseLeftWidget();
@@ -481,6 +535,8 @@ namespace tgui
         // Check if there is still a menu open
         if (m_visibleMenu != -1)
         {
+            invalidate();
+
             // If an item in that menu was selected then unselect it first
             if (m_menus[m_visibleMenu].selectedMenuItem != -1)
             {
@@ -522,13 +578,13 @@ namespace tgui
         // Draw the texts of the menus
         for (unsigned int i = 0; i < m_menus.size(); ++i)
         {
-            target.draw(m_menus[i].text, states);
+            DrawBatcher::draw(target, m_menus[i].text, states);
 
             // Draw the menu items when the menu is open
             if (m_visibleMenu == static_cast<int>(i))
             {
                 for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
-                    target.draw(m_menus[i].menuItems[j], states);
+                    DrawBatcher::draw(target, m_menus[i].menuItems[j], states);
             }
         }
     }
@@ -651,6 +707,8 @@ namespace tgui
     void MenuBarRenderer::setBackgroundColor(const Color& backgroundColor)
     {
         m_backgroundColor = backgroundColor;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -669,6 +727,8 @@ namespace tgui
 
             m_menuBar->m_menus[i].text.setTextColor(calcColorOpacity(m_textColor, m_menuBar->getOpacity()));
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -676,6 +736,8 @@ namespace tgui
     void MenuBarRenderer::setSelectedBackgroundColor(const Color& selectedBackgroundColor)
     {
         m_selectedBackgroundColor = selectedBackgroundColor;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -689,6 +751,8 @@ namespace tgui
             if (m_menuBar->m_menus[m_menuBar->m_visibleMenu].selectedMenuItem != -1)
                 m_menuBar->m_menus[m_menuBar->m_visibleMenu].menuItems[m_menuBar->m_menus[m_menuBar->m_visibleMenu].selectedMenuItem].setTextColor(calcColorOpacity(m_selectedTextColor, m_menuBar->getOpacity()));
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -696,6 +760,8 @@ namespace tgui
     void MenuBarRenderer::setDistanceToSide(float distanceToSide)
     {
         m_distanceToSide = distanceToSide;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -709,6 +775,8 @@ namespace tgui
             m_backgroundTexture.setSize(m_menuBar->getSize());
             m_backgroundTexture.setColor({m_backgroundTexture.getColor().r, m_backgroundTexture.getColor().g, m_backgroundTexture.getColor().b, static_cast<sf::Uint8>(m_menuBar->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -722,6 +790,8 @@ namespace tgui
             m_itemBackgroundTexture.setSize(m_menuBar->getSize());
             m_itemBackgroundTexture.setColor({m_itemBackgroundTexture.getColor().r, m_itemBackgroundTexture.getColor().g, m_itemBackgroundTexture.getColor().b, static_cast<sf::Uint8>(m_menuBar->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -735,6 +805,8 @@ namespace tgui
             m_selectedItemBackgroundTexture.setSize(m_menuBar->getSize());
             m_selectedItemBackgroundTexture.setColor({m_selectedItemBackgroundTexture.getColor().r, m_selectedItemBackgroundTexture.getColor().g, m_selectedItemBackgroundTexture.getColor().b, static_cast<sf::Uint8>(m_menuBar->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -754,7 +826,7 @@ namespace tgui
             sf::RectangleShape background{m_menuBar->getSize()};
             background.setPosition({m_menuBar->getPosition()});
             background.setFillColor(calcColorOpacity(m_backgroundColor, m_menuBar->getOpacity()));
-            target.draw(background, states);
+            DrawBatcher::draw(target, background, states);
         }
 
         // Draw the menu backgrounds
@@ -811,7 +883,7 @@ namespace tgui
                     sf::RectangleShape background{{m_menuBar->m_menus[i].text.getSize().x + 2*m_distanceToSide, m_menuBar->getSize().y}};
                     background.setPosition({positionX, m_menuBar->getPosition().y});
                     background.setFillColor(calcColorOpacity(m_selectedBackgroundColor, m_menuBar->getOpacity()));
-                    target.draw(background, states);
+                    DrawBatcher::draw(target, background, states);
 
                     background.setSize({menuWidth, m_menuBar->getSize().y});
                     for (unsigned int j = 0; j < m_menuBar->m_menus[i].menuItems.size(); ++j)
@@ -823,7 +895,7 @@ namespace tgui
                         else
                             background.setFillColor(calcColorOpacity(m_backgroundColor, m_menuBar->getOpacity()));
 
-                        target.draw(background, states);
+                        DrawBatcher::draw(target, background, states);
                     }
                 }
             }
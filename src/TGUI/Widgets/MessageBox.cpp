@@ -34,9 +34,7 @@ namespace tgui
 
     MessageBox::MessageBox()
     {
-        m_callback.widgetType = "MessageBox";
-
-        addSignal<sf::String>("ButtonPressed");
+        setWidgetType(WidgetTypes::MessageBox);
 
         m_renderer = std::make_shared<MessageBoxRenderer>(this);
         reload();
@@ -53,7 +51,8 @@ namespace tgui
         ChildWindow      {messageBoxToCopy},
         m_loadedThemeFile(messageBoxToCopy.m_loadedThemeFile), // Did not compile in VS2013 when using braces
         m_buttonClassName(messageBoxToCopy.m_buttonClassName), // Did not compile in VS2013 when using braces
-        m_textSize       {messageBoxToCopy.m_textSize}
+        m_textSize       {messageBoxToCopy.m_textSize},
+        m_onButtonPressed{messageBoxToCopy.m_onButtonPressed}
     {
         m_label = Label::copy(messageBoxToCopy.m_label);
         add(m_label, "#TGUI_INTERNAL$MessageBoxText#");
@@ -62,7 +61,7 @@ namespace tgui
         {
             Button::Ptr button = Button::copy(*it);
             button->disconnectAll();
-            button->connect("Pressed", [=]() { m_callback.text = button->getText(); sendSignal("ButtonPressed", button->getText()); });
+            button->connect("Pressed", [=]() { m_callback.text = button->getText(); sendSignal(m_onButtonPressed, button->getText()); });
 
             m_buttons.push_back(button);
         }
@@ -82,6 +81,7 @@ namespace tgui
             std::swap(m_buttons,         temp.m_buttons);
             std::swap(m_label,           temp.m_label);
             std::swap(m_textSize,        temp.m_textSize);
+            std::swap(m_onButtonPressed, temp.m_onButtonPressed);
         }
 
         return *this;
@@ -99,6 +99,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> MessageBox::getSignals()
+    {
+        auto signals = ChildWindow::getSignals();
+        signals.insert(signals.end(), {&m_onButtonPressed});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MessageBox::setFont(const Font& font)
     {
         ChildWindow::setFont(font);
@@ -145,7 +154,7 @@ namespace tgui
 
         button->setTextSize(m_textSize);
         button->setText(caption);
-        button->connect("Pressed", [=](){ m_callback.text = caption; sendSignal("ButtonPressed", caption); });
+        button->connect("Pressed", [=](){ m_callback.text = caption; sendSignal(m_onButtonPressed, caption); });
 
         add(button, "#TGUI_INTERNAL$MessageBoxButton$" + caption + "#");
         m_buttons.push_back(button);
@@ -305,6 +314,8 @@ namespace tgui
     void MessageBoxRenderer::setTextColor(const Color& color)
     {
         m_messageBox->m_label->setTextColor(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
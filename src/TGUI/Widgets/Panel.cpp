@@ -23,8 +23,8 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <SFML/OpenGL.hpp>
-
+#include <TGUI/Clipping.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,11 +35,7 @@ namespace tgui
 
     Panel::Panel(const Layout2d& size)
     {
-        m_callback.widgetType = "Panel";
-
-        addSignal<sf::Vector2f>("MousePressed");
-        addSignal<sf::Vector2f>("MouseReleased");
-        addSignal<sf::Vector2f>("Clicked");
+        setWidgetType(WidgetTypes::Panel);
 
         m_renderer = std::make_shared<PanelRenderer>(this);
         reload();
@@ -66,6 +62,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> Panel::getSignals()
+    {
+        auto signals = Container::getSignals();
+        signals.insert(signals.end(), {&m_onMousePressed, &m_onMouseReleased, &m_onClicked});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Panel::mouseOnWidget(float x, float y) const
     {
         return sf::FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(x, y);
@@ -73,6 +78,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Panel::getMouseArea(sf::FloatRect& area) const
+    {
+        area = {getPosition().x, getPosition().y, getSize().x, getSize().y};
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Panel::leftMousePressed(float x, float y)
     {
         if (mouseOnWidget(x, y))
@@ -81,7 +94,7 @@ namespace tgui
 
             m_callback.mouse.x = static_cast<int>(x - getPosition().x);
             m_callback.mouse.y = static_cast<int>(y - getPosition().y);
-            sendSignal("MousePressed", sf::Vector2f{x - getPosition().x, y - getPosition().y});
+            sendSignal(m_onMousePressed, sf::Vector2f{x - getPosition().x, y - getPosition().y});
         }
 
         Container::leftMousePressed(x, y);
@@ -95,10 +108,10 @@ namespace tgui
         {
             m_callback.mouse.x = static_cast<int>(x - getPosition().x);
             m_callback.mouse.y = static_cast<int>(y - getPosition().y);
-            sendSignal("MouseReleased", sf::Vector2f{x - getPosition().x, y - getPosition().y});
+            sendSignal(m_onMouseReleased, sf::Vector2f{x - getPosition().x, y - getPosition().y});
 
             if (m_mouseDown)
-                sendSignal("Clicked", sf::Vector2f{x - getPosition().x, y - getPosition().y});
+                sendSignal(m_onClicked, sf::Vector2f{x - getPosition().x, y - getPosition().y});
         }
 
         m_mouseDown = false;
@@ -112,33 +125,14 @@ namespace tgui
     {
         const sf::View& view = target.getView();
 
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
         // Get the global position
         sf::Vector2f topLeftPosition = {((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
                                         ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top)};
         sf::Vector2f bottomRightPosition = {(getAbsolutePosition().x + getSize().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
                                             (getAbsolutePosition().y + getSize().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top)};
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = std::max(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = std::max(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = std::min(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = std::min(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        Clipping::push(target, topLeftPosition, bottomRightPosition);
 
         // Set the position
         states.transform.translate(getPosition());
@@ -148,14 +142,14 @@ namespace tgui
         {
             sf::RectangleShape background(getSize());
             background.setFillColor(calcColorOpacity(m_backgroundColor, getOpacity()));
-            target.draw(background, states);
+            DrawBatcher::draw(target, background, states);
         }
 
         // Draw the widgets
         drawWidgetContainer(&target, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        Clipping::pop();
 
         // Draw the borders around the panel
         if (getRenderer()->m_borders != Borders{0, 0, 0, 0})
@@ -167,22 +161,22 @@ namespace tgui
             sf::RectangleShape border({borders.left, size.y + borders.top});
             border.setPosition(-borders.left, -borders.top);
             border.setFillColor(calcColorOpacity(getRenderer()->m_borderColor, getOpacity()));
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw top border
             border.setSize({size.x + borders.right, borders.top});
             border.setPosition(0, -borders.top);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw right border
             border.setSize({borders.right, size.y + borders.bottom});
             border.setPosition(size.x, 0);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw bottom border
             border.setSize({size.x + borders.left, borders.bottom});
             border.setPosition(-borders.left, size.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
         }
     }
 
@@ -257,9 +251,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void PanelRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+
+        invalidateWidget();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void PanelRenderer::setBackgroundColor(const Color& color)
     {
         m_panel->setBackgroundColor(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -267,6 +272,8 @@ namespace tgui
     void PanelRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Widgets/Picture.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,9 +34,8 @@ namespace tgui
 
     Picture::Picture()
     {
-        m_callback.widgetType = "Picture";
+        setWidgetType(WidgetTypes::Picture);
 
-        addSignal("DoubleClicked");
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -61,6 +61,8 @@ namespace tgui
         m_loadedFilename = getResourcePath() + filename;
 
         setTexture(Texture{filename}, fullyClickable);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -76,6 +78,8 @@ namespace tgui
         m_texture.setSize(getSize());
         m_texture.setPosition(getPosition());
         m_texture.setColor({m_texture.getColor().r, m_texture.getColor().g, m_texture.getColor().b, static_cast<sf::Uint8>(m_opacity * 255)});
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,6 +94,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> Picture::getSignals()
+    {
+        auto signals = ClickableWidget::getSignals();
+        signals.insert(signals.end(), {&m_onDoubleClicked});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Picture::setPosition(const Layout2d& position)
     {
         Widget::setPosition(position);
@@ -156,12 +169,13 @@ namespace tgui
 
                 m_callback.mouse.x = static_cast<int>(x - getPosition().x);
                 m_callback.mouse.y = static_cast<int>(y - getPosition().y);
-                sendSignal("DoubleClicked", sf::Vector2f{x - getPosition().x, y - getPosition().y});
+                sendSignal(m_onDoubleClicked);
             }
             else // This is the first click
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestUpdates();
             }
         }
     }
@@ -182,6 +196,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Picture::isUpdateNeeded() const
+    {
+        return m_possibleDoubleClick || Widget::isUpdateNeeded();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Picture::timeUntilNextUpdate() const
+    {
+        // The gui has to wake up when the time for the second click runs out
+        if (!m_possibleDoubleClick)
+            return Widget::timeUntilNextUpdate();
+
+        const sf::Time doubleClickTime = (m_animationTimeElapsed < sf::milliseconds(500)) ? (sf::milliseconds(500) - m_animationTimeElapsed) : sf::Time::Zero;
+        return std::min(doubleClickTime, Widget::timeUntilNextUpdate());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Picture::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         target.draw(m_texture, states);
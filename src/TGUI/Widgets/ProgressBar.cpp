@@ -23,12 +23,12 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <TGUI/Clipping.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Widgets/ProgressBar.hpp>
 #include <TGUI/Loading/Theme.hpp>
 
-#include <SFML/OpenGL.hpp>
-
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -37,10 +37,7 @@ namespace tgui
 
     ProgressBar::ProgressBar()
     {
-        m_callback.widgetType = "ProgressBar";
-
-        addSignal<int>("ValueChanged");
-        addSignal<int>("Full");
+        setWidgetType(WidgetTypes::ProgressBar);
 
         m_renderer = std::make_shared<ProgressBarRenderer>(this);
         reload();
@@ -60,6 +57,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> ProgressBar::getSignals()
+    {
+        auto signals = ClickableWidget::getSignals();
+        signals.insert(signals.end(), {&m_onValueChanged, &m_onFull});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ProgressBar::setPosition(const Layout2d& position)
     {
         Widget::setPosition(position);
@@ -69,7 +75,6 @@ namespace tgui
         getRenderer()->m_textureFront.setPosition(getRenderer()->m_textureBack.getPosition()
                                                   + ((getRenderer()->m_textureBack.getSize() - getRenderer()->m_textureFront.getSize()) / 2.0f));
 
-
         m_textBack.setPosition(getPosition().x + (getSize().x - m_textBack.getSize().x) / 2.0f,
                                getPosition().y + (getSize().y - m_textBack.getSize().y) / 2.0f);
         m_textFront.setPosition(m_textBack.getPosition());
@@ -155,6 +160,8 @@ namespace tgui
 
         // Recalculate the size of the front image (the size of the part that will be drawn)
         recalculateSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -174,6 +181,8 @@ namespace tgui
 
         // Recalculate the size of the front image (the size of the part that will be drawn)
         recalculateSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -191,13 +200,15 @@ namespace tgui
             m_value = value;
 
             m_callback.value = static_cast<int>(m_value);
-            sendSignal("ValueChanged", m_value);
+            sendSignal(m_onValueChanged, m_value);
 
             if (m_value == m_maximum)
-                sendSignal("Full", m_value);
+                sendSignal(m_onFull, m_value);
 
             // Recalculate the size of the front image (the size of the part that will be drawn)
             recalculateSize();
+
+            invalidate();
         }
     }
 
@@ -246,6 +257,8 @@ namespace tgui
 
         // Reposition the text
         updatePosition();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -257,6 +270,8 @@ namespace tgui
 
         // Call setText to reposition the text
         setText(getText());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -266,6 +281,8 @@ namespace tgui
         m_fillDirection = direction;
 
         recalculateSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -497,10 +514,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ProgressBarRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+
+        invalidateWidget();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ProgressBarRenderer::setTextColor(const Color& color)
     {
         setTextColorBack(color);
         setTextColorFront(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -509,6 +537,8 @@ namespace tgui
     {
         m_textColorBack = color;
         m_progressBar->m_textBack.setTextColor(calcColorOpacity(m_textColorBack, m_progressBar->getOpacity()));
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -517,6 +547,8 @@ namespace tgui
     {
         m_textColorFront = color;
         m_progressBar->m_textFront.setTextColor(calcColorOpacity(m_textColorFront, m_progressBar->getOpacity()));
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -524,6 +556,8 @@ namespace tgui
     void ProgressBarRenderer::setBackgroundColor(const Color& color)
     {
         m_backgroundColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -531,6 +565,8 @@ namespace tgui
     void ProgressBarRenderer::setForegroundColor(const Color& color)
     {
         m_foregroundColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -538,6 +574,8 @@ namespace tgui
     void ProgressBarRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -554,6 +592,8 @@ namespace tgui
             if (m_textureFront.isLoaded())
                 m_progressBar->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -568,6 +608,8 @@ namespace tgui
 
             m_textureFront.setColor({m_textureFront.getColor().r, m_textureFront.getColor().g, m_textureFront.getColor().b, static_cast<sf::Uint8>(m_progressBar->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -585,7 +627,7 @@ namespace tgui
             sf::RectangleShape back(m_progressBar->getSize());
             back.setPosition(m_progressBar->getPosition());
             back.setFillColor(calcColorOpacity(m_backgroundColor, m_progressBar->getOpacity()));
-            target.draw(back, states);
+            DrawBatcher::draw(target, back, states);
 
             sf::Vector2f frontPosition = m_progressBar->getPosition();
             if (m_progressBar->getFillDirection() == ProgressBar::FillDirection::RightToLeft)
@@ -596,25 +638,16 @@ namespace tgui
             sf::RectangleShape front({m_progressBar->m_frontRect.width, m_progressBar->m_frontRect.height});
             front.setPosition(frontPosition);
             front.setFillColor(calcColorOpacity(m_foregroundColor, m_progressBar->getOpacity()));
-            target.draw(front, states);
+            DrawBatcher::draw(target, front, states);
         }
 
         // Draw the text
         if (m_progressBar->m_textBack.getText() != "")
         {
             if (m_progressBar->m_textBack.getTextColor() == m_progressBar->m_textFront.getTextColor())
-                target.draw(m_progressBar->m_textBack, states);
+                DrawBatcher::draw(target, m_progressBar->m_textBack, states);
             else
             {
-                // Get the old clipping area
-                GLint scissor[4];
-                glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-                // Calculate the scale factor of the view
-                const sf::View& view = target.getView();
-                float scaleViewX = target.getSize().x / view.getSize().x;
-                float scaleViewY = target.getSize().y / view.getSize().y;
-
                 sf::FloatRect backRect;
                 sf::FloatRect frontRect;
                 frontRect.width = m_progressBar->m_frontRect.width;
@@ -715,42 +748,21 @@ namespace tgui
                     }
                 }
 
-                // Calculate the clipping area for the back text
-                GLint scissorLeft = std::max(static_cast<GLint>(backRect.left * scaleViewX), scissor[0]);
-                GLint scissorTop = std::max(static_cast<GLint>(backRect.top * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-                GLint scissorRight = std::min(static_cast<GLint>((backRect.left + backRect.width) * scaleViewX), scissor[0] + scissor[2]);
-                GLint scissorBottom = std::min(static_cast<GLint>((backRect.top + backRect.height) * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-                if (scissorRight < scissorLeft)
-                    scissorRight = scissorLeft;
-                else if (scissorBottom < scissorTop)
-                    scissorTop = scissorBottom;
-
-                // Set the clipping area
-                glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+                // Set the clipping area for the back text
+                Clipping::push(target, {backRect.left, backRect.top}, {backRect.left + backRect.width, backRect.top + backRect.height});
 
                 // Draw the back text
-                target.draw(m_progressBar->m_textBack, states);
-
-                // Calculate the clipping area for the front text
-                scissorLeft = std::max(static_cast<GLint>(frontRect.left * scaleViewX), scissor[0]);
-                scissorTop = std::max(static_cast<GLint>(frontRect.top * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-                scissorRight = std::min(static_cast<GLint>((frontRect.left + frontRect.width) * scaleViewX), scissor[0] + scissor[2]);
-                scissorBottom = std::min(static_cast<GLint>((frontRect.top + frontRect.height) * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-                if (scissorRight < scissorLeft)
-                    scissorRight = scissorLeft;
-                else if (scissorBottom < scissorTop)
-                    scissorTop = scissorBottom;
+                DrawBatcher::draw(target, m_progressBar->m_textBack, states);
 
-                // Set the clipping area
-                glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+                // Set the clipping area for the front text
+                Clipping::pop();
+                Clipping::push(target, {frontRect.left, frontRect.top}, {frontRect.left + frontRect.width, frontRect.top + frontRect.height});
 
                 // Draw the front text
-                target.draw(m_progressBar->m_textFront, states);
+                DrawBatcher::draw(target, m_progressBar->m_textFront, states);
 
                 // Reset the old clipping area
-                glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+                Clipping::pop();
             }
         }
 
@@ -764,22 +776,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(m_borderColor, m_progressBar->getOpacity()));
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
         }
     }
 
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
 
@@ -40,10 +41,7 @@ namespace tgui
 
     RadioButton::RadioButton()
     {
-        m_callback.widgetType = "RadioButton";
-
-        addSignal<int>("Checked");
-        addSignal<int>("Unchecked");
+        setWidgetType(WidgetTypes::RadioButton);
 
         m_renderer = std::make_shared<RadioButtonRenderer>(this);
         reload();
@@ -63,6 +61,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> RadioButton::getSignals()
+    {
+        auto signals = ClickableWidget::getSignals();
+        signals.insert(signals.end(), {&m_onChecked, &m_onUnchecked});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void RadioButton::setPosition(const Layout2d& position)
     {
         ClickableWidget::setPosition(position);
@@ -140,7 +147,9 @@ namespace tgui
             m_checked = true;
 
             m_callback.checked = true;
-            sendSignal("Checked", m_checked);
+            sendSignal(m_onChecked, m_checked);
+
+            invalidate();
         }
     }
 
@@ -153,7 +162,9 @@ namespace tgui
             m_checked = false;
 
             m_callback.checked = false;
-            sendSignal("Unchecked", m_checked);
+            sendSignal(m_onUnchecked, m_checked);
+
+            invalidate();
         }
     }
 
@@ -172,6 +183,8 @@ namespace tgui
 
         // Reposition the text
         updatePosition();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -183,6 +196,8 @@ namespace tgui
 
         // Call setText to reposition the text
         setText(m_text.getText());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -236,6 +251,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool RadioButton::getMouseArea(sf::FloatRect& area) const
+    {
+        // The text can also be clicked, so the area isn't limited to the size of the widget
+        return Widget::getMouseArea(area);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void RadioButton::leftMouseReleased(float x, float y)
     {
         bool mouseDown = m_mouseDown;
@@ -291,8 +314,13 @@ namespace tgui
 
             // The widget can only be focused when there is an image available for this phase
             if (getRenderer()->m_textureFocused.isLoaded())
+            {
                 m_allowFocus = true;
 
+                if (m_parent)
+                    m_parent->focusOrderChanged();
+            }
+
             if (force)
             {
                 if (getRenderer()->m_textureUnchecked.isLoaded())
@@ -326,7 +354,7 @@ namespace tgui
         getRenderer()->draw(target, states);
 
         // Draw the text
-        target.draw(m_text, states);
+        DrawBatcher::draw(target, m_text, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -516,10 +544,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void RadioButtonRenderer::setPadding(const Padding& padding)
+    {
+        WidgetPadding::setPadding(padding);
+
+        invalidateWidget();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void RadioButtonRenderer::setTextColor(const Color& color)
     {
         setTextColorNormal(color);
         setTextColorHover(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -530,6 +569,8 @@ namespace tgui
 
         if (!m_radioButton->m_mouseHover)
             m_radioButton->m_text.setTextColor(calcColorOpacity(m_textColorNormal, m_radioButton->getOpacity()));
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -540,6 +581,8 @@ namespace tgui
 
         if (m_radioButton->m_mouseHover)
             m_radioButton->m_text.setTextColor(calcColorOpacity(m_textColorHover, m_radioButton->getOpacity()));
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -548,6 +591,8 @@ namespace tgui
     {
         setBackgroundColorNormal(color);
         setBackgroundColorHover(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -555,6 +600,8 @@ namespace tgui
     void RadioButtonRenderer::setBackgroundColorNormal(const Color& color)
     {
         m_backgroundColorNormal = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -562,6 +609,8 @@ namespace tgui
     void RadioButtonRenderer::setBackgroundColorHover(const Color& color)
     {
         m_backgroundColorHover = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -570,6 +619,8 @@ namespace tgui
     {
         setForegroundColorNormal(color);
         setForegroundColorHover(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -577,6 +628,8 @@ namespace tgui
     void RadioButtonRenderer::setForegroundColorNormal(const Color& color)
     {
         m_foregroundColorNormal = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -584,6 +637,8 @@ namespace tgui
     void RadioButtonRenderer::setForegroundColorHover(const Color& color)
     {
         m_foregroundColorHover = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -592,6 +647,8 @@ namespace tgui
     {
         setCheckColorNormal(color);
         setCheckColorHover(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -599,6 +656,8 @@ namespace tgui
     void RadioButtonRenderer::setCheckColorNormal(const Color& color)
     {
         m_checkColorNormal = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -606,6 +665,8 @@ namespace tgui
     void RadioButtonRenderer::setCheckColorHover(const Color& color)
     {
         m_checkColorHover = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -620,6 +681,8 @@ namespace tgui
             if (m_textureUnchecked.isLoaded() && m_textureChecked.isLoaded())
                 m_radioButton->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -634,6 +697,8 @@ namespace tgui
             if (m_textureUnchecked.isLoaded() && m_textureChecked.isLoaded())
                 m_radioButton->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -648,6 +713,8 @@ namespace tgui
             if (m_textureUnchecked.isLoaded() && m_textureChecked.isLoaded())
                 m_radioButton->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -662,6 +729,8 @@ namespace tgui
             if (m_textureUnchecked.isLoaded() && m_textureChecked.isLoaded())
                 m_radioButton->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -675,6 +744,8 @@ namespace tgui
             m_textureFocused.setPosition(m_radioButton->getPosition());
             m_textureFocused.setColor({m_textureFocused.getColor().r, m_textureFocused.getColor().g, m_textureFocused.getColor().b, static_cast<sf::Uint8>(m_radioButton->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -722,7 +793,7 @@ namespace tgui
                 circle.setOutlineColor(calcColorOpacity(m_backgroundColorNormal, m_radioButton->getOpacity()));
             }
 
-            target.draw(circle, states);
+            DrawBatcher::draw(target, circle, states);
 
             // Draw the check if the radio button is checked
             if (m_radioButton->m_checked)
@@ -736,7 +807,7 @@ namespace tgui
                 else
                     check.setFillColor(calcColorOpacity(m_checkColorNormal, m_radioButton->getOpacity()));
 
-                target.draw(check, states);
+                DrawBatcher::draw(target, check, states);
             }
         }
     }
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Loading/Theme.hpp>
 
@@ -34,11 +35,9 @@ namespace tgui
 
     Scrollbar::Scrollbar()
     {
-        m_callback.widgetType = "Scrollbar";
+        setWidgetType(WidgetTypes::Scrollbar);
         m_draggableWidget = true;
 
-        addSignal<int>("ValueChanged");
-
         m_renderer = std::make_shared<ScrollbarRenderer>(this);
         reload();
 
@@ -57,6 +56,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> Scrollbar::getSignals()
+    {
+        auto signals = Widget::getSignals();
+        signals.insert(signals.end(), {&m_onValueChanged});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Scrollbar::setPosition(const Layout2d& position)
     {
         Widget::setPosition(position);
@@ -242,6 +250,8 @@ namespace tgui
 
         // Recalculate the size and position of the thumb image
         updateSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -259,10 +269,12 @@ namespace tgui
             m_value = value;
 
             m_callback.value = static_cast<int>(m_value);
-            sendSignal("ValueChanged", static_cast<int>(m_value));
+            sendSignal(m_onValueChanged, static_cast<int>(m_value));
 
             // Recalculate the size and position of the thumb image
             updateSize();
+
+            invalidate();
         }
     }
 
@@ -281,6 +293,8 @@ namespace tgui
 
         // Recalculate the size and position of the thumb image
         updateSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -315,6 +329,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Scrollbar::getMouseArea(sf::FloatRect& area) const
+    {
+        area = {getPosition().x, getPosition().y, getSize().x, getSize().y};
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Scrollbar::leftMousePressed(float x, float y)
     {
         m_mouseDown = true;
@@ -363,6 +385,8 @@ namespace tgui
         // Refresh the scrollbar value
         if (!m_mouseDownOnArrow)
             mouseMoved(x, y);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -443,7 +467,10 @@ namespace tgui
 
         // The thumb might have been dragged between two values
         if (m_mouseDown)
+        {
             updatePosition();
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -453,6 +480,8 @@ namespace tgui
         if (!m_mouseHover)
             mouseEnteredWidget();
 
+        const Part oldHoverPart = m_mouseHoverOverPart;
+
         // Check if the mouse button went down on top of the track (or thumb)
         if (m_mouseDown && !m_mouseDownOnArrow)
         {
@@ -619,12 +648,18 @@ namespace tgui
             m_mouseHoverOverPart = Part::ArrowUp;
         else if (sf::FloatRect{m_arrowDown.left, m_arrowDown.top, m_arrowDown.width, m_arrowDown.height}.contains(x, y))
             m_mouseHoverOverPart = Part::ArrowDown;
+
+        // The thumb follows the mouse while it is dragged, even when the value doesn't change
+        if ((m_mouseDown && !m_mouseDownOnArrow) || (m_mouseHoverOverPart != oldHoverPart))
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Scrollbar::mouseWheelMoved(int delta, int x, int y)
     {
+        const Part oldHoverPart = m_mouseHoverOverPart;
+
         if (static_cast<int>(m_value) - static_cast<int>(delta * m_scrollAmount) < 0)
             setValue(0);
         else
@@ -639,6 +674,9 @@ namespace tgui
             m_mouseHoverOverPart = Part::ArrowUp;
         else if (sf::FloatRect{m_arrowDown.left, m_arrowDown.top, m_arrowDown.width, m_arrowDown.height}.contains(static_cast<float>(x), static_cast<float>(y)))
             m_mouseHoverOverPart = Part::ArrowDown;
+
+        if (m_mouseHoverOverPart != oldHoverPart)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -655,7 +693,10 @@ namespace tgui
     {
         // The thumb might have been dragged between two values
         if (m_mouseDown)
+        {
             updatePosition();
+            invalidate();
+        }
 
         Widget::mouseNoLongerDown();
     }
@@ -925,6 +966,8 @@ namespace tgui
     {
         setTrackColorNormal(color);
         setTrackColorHover(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -932,6 +975,8 @@ namespace tgui
     void ScrollbarRenderer::setTrackColorNormal(const Color& color)
     {
         m_trackColorNormal = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -939,6 +984,8 @@ namespace tgui
     void ScrollbarRenderer::setTrackColorHover(const Color& color)
     {
         m_trackColorHover = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -947,6 +994,8 @@ namespace tgui
     {
         setThumbColorNormal(color);
         setThumbColorHover(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -954,6 +1003,8 @@ namespace tgui
     void ScrollbarRenderer::setThumbColorNormal(const Color& color)
     {
         m_thumbColorNormal = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -961,6 +1012,8 @@ namespace tgui
     void ScrollbarRenderer::setThumbColorHover(const Color& color)
     {
         m_thumbColorHover = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -969,6 +1022,8 @@ namespace tgui
     {
         setArrowBackgroundColorNormal(color);
         setArrowBackgroundColorHover(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -976,6 +1031,8 @@ namespace tgui
     void ScrollbarRenderer::setArrowBackgroundColorNormal(const Color& color)
     {
         m_arrowBackgroundColorNormal = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -983,6 +1040,8 @@ namespace tgui
     void ScrollbarRenderer::setArrowBackgroundColorHover(const Color& color)
     {
         m_arrowBackgroundColorHover = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -991,6 +1050,8 @@ namespace tgui
     {
         setArrowColorNormal(color);
         setArrowColorHover(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -998,6 +1059,8 @@ namespace tgui
     void ScrollbarRenderer::setArrowColorNormal(const Color& color)
     {
         m_arrowColorNormal = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1005,6 +1068,8 @@ namespace tgui
     void ScrollbarRenderer::setArrowColorHover(const Color& color)
     {
         m_arrowColorHover = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1019,6 +1084,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_scrollbar->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1033,6 +1100,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_scrollbar->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1047,6 +1116,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_scrollbar->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1061,6 +1132,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_scrollbar->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1075,6 +1148,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_scrollbar->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1089,6 +1164,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_scrollbar->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1103,6 +1180,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_scrollbar->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1117,6 +1196,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_scrollbar->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1159,7 +1240,7 @@ namespace tgui
                 else
                     track.setFillColor(calcColorOpacity(m_trackColorNormal, m_scrollbar->getOpacity()));
 
-                target.draw(track, states);
+                DrawBatcher::draw(target, track, states);
             }
 
             // Draw the thumb
@@ -1172,7 +1253,7 @@ namespace tgui
                 else
                     thumb.setFillColor(calcColorOpacity(m_thumbColorNormal, m_scrollbar->getOpacity()));
 
-                target.draw(thumb, states);
+                DrawBatcher::draw(target, thumb, states);
             }
 
             // Draw the up arrow
@@ -1204,8 +1285,8 @@ namespace tgui
                     arrow.setPoint(2, {arrowBack.getPosition().x + (arrowBack.getSize().x * 4/5), arrowBack.getPosition().y + (arrowBack.getSize().y * 4/5)});
                 }
 
-                target.draw(arrowBack, states);
-                target.draw(arrow, states);
+                DrawBatcher::draw(target, arrowBack, states);
+                DrawBatcher::draw(target, arrow, states);
             }
 
             // Draw the down arrow
@@ -1237,8 +1318,8 @@ namespace tgui
                     arrow.setPoint(2, {arrowBack.getPosition().x + (arrowBack.getSize().x / 5), arrowBack.getPosition().y + (arrowBack.getSize().y * 4/5)});
                 }
 
-                target.draw(arrowBack, states);
-                target.draw(arrow, states);
+                DrawBatcher::draw(target, arrowBack, states);
+                DrawBatcher::draw(target, arrow, states);
             }
         }
     }
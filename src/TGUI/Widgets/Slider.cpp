@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Widgets/Slider.hpp>
 #include <TGUI/Loading/Theme.hpp>
 
@@ -34,11 +35,9 @@ namespace tgui
 
     Slider::Slider()
     {
-        m_callback.widgetType = "Slider";
+        setWidgetType(WidgetTypes::Slider);
         m_draggableWidget = true;
 
-        addSignal<int>("ValueChanged");
-
         m_renderer = std::make_shared<SliderRenderer>(this);
         reload();
 
@@ -57,6 +56,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> Slider::getSignals()
+    {
+        auto signals = Widget::getSignals();
+        signals.insert(signals.end(), {&m_onValueChanged});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Slider::setPosition(const Layout2d& position)
     {
         Widget::setPosition(position);
@@ -190,6 +198,8 @@ namespace tgui
 
         // Recalculate the position of the thumb image
         updatePosition();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -212,6 +222,8 @@ namespace tgui
 
         // Recalculate the position of the thumb image
         updatePosition();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -229,10 +241,12 @@ namespace tgui
             m_value = value;
 
             m_callback.value = m_value;
-            sendSignal("ValueChanged", m_value);
+            sendSignal(m_onValueChanged, m_value);
 
             // Recalculate the position of the thumb image
             updatePosition();
+
+            invalidate();
         }
     }
 
@@ -257,6 +271,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::FloatRect Slider::getDrawnArea() const
+    {
+        // The thumb is centered on the track and reaches half its length beyond the ends of the track.
+        // The borders of the thumb have the same size as those of the track, so they are covered by extending the area.
+        sf::FloatRect area = Widget::getDrawnArea();
+
+        sf::Vector2f thumbOverflow;
+        if (m_verticalScroll)
+            thumbOverflow = {std::max(0.f, (m_thumb.width - getSize().x) / 2.f), m_thumb.height / 2.f};
+        else
+            thumbOverflow = {m_thumb.width / 2.f, std::max(0.f, (m_thumb.height - getSize().y) / 2.f)};
+
+        area.left -= thumbOverflow.x;
+        area.top -= thumbOverflow.y;
+        area.width += 2 * thumbOverflow.x;
+        area.height += 2 * thumbOverflow.y;
+        return area;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Slider::mouseOnWidget(float x, float y) const
     {
         // Check if the mouse is on top of the thumb
@@ -286,7 +321,10 @@ namespace tgui
     {
         // The thumb might have been dragged between two values
         if (m_mouseDown)
+        {
             updatePosition();
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -299,6 +337,8 @@ namespace tgui
         // Check if the mouse button is down
         if (m_mouseDown)
         {
+            const sf::Vector2f oldThumbPosition{m_thumb.left, m_thumb.top};
+
             // Check in which direction the slider goes
             if (m_verticalScroll)
             {
@@ -352,6 +392,10 @@ namespace tgui
                 getRenderer()->m_textureThumbNormal.setPosition({m_thumb.left, m_thumb.top});
                 getRenderer()->m_textureThumbHover.setPosition({m_thumb.left, m_thumb.top});
             }
+
+            // The thumb follows the mouse even when the value didn't change
+            if (oldThumbPosition != sf::Vector2f{m_thumb.left, m_thumb.top})
+                invalidate();
         }
         else // Normal mouse move
         {
@@ -391,7 +435,10 @@ namespace tgui
     {
         // The thumb might have been dragged between two values
         if (m_mouseDown)
+        {
             updatePosition();
+            invalidate();
+        }
 
         Widget::mouseNoLongerDown();
     }
@@ -587,10 +634,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void SliderRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+
+        invalidateWidget();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void SliderRenderer::setTrackColor(const Color& color)
     {
         setTrackColorNormal(color);
         setTrackColorHover(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -598,6 +656,8 @@ namespace tgui
     void SliderRenderer::setTrackColorNormal(const Color& color)
     {
         m_trackColorNormal = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -605,6 +665,8 @@ namespace tgui
     void SliderRenderer::setTrackColorHover(const Color& color)
     {
         m_trackColorHover = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -613,6 +675,8 @@ namespace tgui
     {
         setThumbColorNormal(color);
         setThumbColorHover(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -620,6 +684,8 @@ namespace tgui
     void SliderRenderer::setThumbColorNormal(const Color& color)
     {
         m_thumbColorNormal = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -627,6 +693,8 @@ namespace tgui
     void SliderRenderer::setThumbColorHover(const Color& color)
     {
         m_thumbColorHover = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -634,6 +702,8 @@ namespace tgui
     void SliderRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -653,6 +723,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded())
                 m_slider->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -667,6 +739,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded())
                 m_slider->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -681,6 +755,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded())
                 m_slider->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -695,6 +771,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded())
                 m_slider->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -719,7 +797,7 @@ namespace tgui
             else
                 track.setFillColor(calcColorOpacity(m_trackColorNormal, m_slider->getOpacity()));
 
-            target.draw(track, states);
+            DrawBatcher::draw(target, track, states);
         }
 
         // Draw the borders around the track and thumb
@@ -734,22 +812,22 @@ namespace tgui
                 sf::RectangleShape border({m_borders.left, size[i].y + m_borders.top});
                 border.setPosition(position[i].x - m_borders.left, position[i].y - m_borders.top);
                 border.setFillColor(calcColorOpacity(m_borderColor, m_slider->getOpacity()));
-                target.draw(border, states);
+                DrawBatcher::draw(target, border, states);
 
                 // Draw top border
                 border.setSize({size[i].x + m_borders.right, m_borders.top});
                 border.setPosition(position[i].x, position[i].y - m_borders.top);
-                target.draw(border, states);
+                DrawBatcher::draw(target, border, states);
 
                 // Draw right border
                 border.setSize({m_borders.right, size[i].y + m_borders.bottom});
                 border.setPosition(position[i].x + size[i].x, position[i].y);
-                target.draw(border, states);
+                DrawBatcher::draw(target, border, states);
 
                 // Draw bottom border
                 border.setSize({size[i].x + m_borders.left, m_borders.bottom});
                 border.setPosition(position[i].x - m_borders.left, position[i].y + size[i].y);
-                target.draw(border, states);
+                DrawBatcher::draw(target, border, states);
             }
         }
 
@@ -771,7 +849,7 @@ namespace tgui
             else
                 thumb.setFillColor(calcColorOpacity(m_thumbColorNormal, m_slider->getOpacity()));
 
-            target.draw(thumb, states);
+            DrawBatcher::draw(target, thumb, states);
         }
     }
 
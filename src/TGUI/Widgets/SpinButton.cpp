@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/SpinButton.hpp>
 
@@ -35,9 +36,7 @@ namespace tgui
 
     SpinButton::SpinButton()
     {
-        m_callback.widgetType = "SpinButton";
-
-        addSignal<int>("ValueChanged");
+        setWidgetType(WidgetTypes::SpinButton);
 
         m_renderer = std::make_shared<SpinButtonRenderer>(this);
         reload();
@@ -57,6 +56,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> SpinButton::getSignals()
+    {
+        auto signals = ClickableWidget::getSignals();
+        signals.insert(signals.end(), {&m_onValueChanged});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void SpinButton::setPosition(const Layout2d& position)
     {
         Widget::setPosition(position);
@@ -118,6 +126,8 @@ namespace tgui
         // When the value is below the minimum then adjust it
         if (m_value < m_minimum)
             setValue(m_minimum);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -133,6 +143,8 @@ namespace tgui
         // When the value is above the maximum then adjust it
         if (m_value > m_maximum)
             setValue(m_maximum);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -150,7 +162,9 @@ namespace tgui
             m_value = value;
 
             m_callback.value = m_value;
-            sendSignal("ValueChanged", value);
+            sendSignal(m_onValueChanged, value);
+
+            invalidate();
         }
     }
 
@@ -176,6 +190,8 @@ namespace tgui
         }
 
         updateSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -267,6 +283,8 @@ namespace tgui
 
     void SpinButton::mouseMoved(float x, float y)
     {
+        const bool oldMouseHoverOnTopArrow = m_mouseHoverOnTopArrow;
+
         // Check if the mouse is on top of the upper/right arrow
         if (m_verticalScroll)
         {
@@ -283,6 +301,10 @@ namespace tgui
                 m_mouseHoverOnTopArrow = false;
         }
 
+        // The hover image moves to the other arrow
+        if (m_mouseHoverOnTopArrow != oldMouseHoverOnTopArrow)
+            invalidate();
+
         if (!m_mouseHover)
             mouseEnteredWidget();
     }
@@ -494,10 +516,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void SpinButtonRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+
+        invalidateWidget();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void SpinButtonRenderer::setBackgroundColor(const Color& color)
     {
         setBackgroundColorNormal(color);
         setBackgroundColorHover(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -505,6 +538,8 @@ namespace tgui
     void SpinButtonRenderer::setBackgroundColorNormal(const Color& color)
     {
         m_backgroundColorNormal = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -512,6 +547,8 @@ namespace tgui
     void SpinButtonRenderer::setBackgroundColorHover(const Color& color)
     {
         m_backgroundColorHover = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -520,6 +557,8 @@ namespace tgui
     {
         setArrowColorNormal(color);
         setArrowColorHover(color);
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -527,6 +566,8 @@ namespace tgui
     void SpinButtonRenderer::setArrowColorNormal(const Color& color)
     {
         m_arrowColorNormal = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -534,6 +575,8 @@ namespace tgui
     void SpinButtonRenderer::setArrowColorHover(const Color& color)
     {
         m_arrowColorHover = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -541,6 +584,8 @@ namespace tgui
     void SpinButtonRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -555,6 +600,8 @@ namespace tgui
             if (m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_spinButton->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -569,6 +616,8 @@ namespace tgui
             if (m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_spinButton->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -583,6 +632,8 @@ namespace tgui
             if (m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_spinButton->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -597,6 +648,8 @@ namespace tgui
             if (m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_spinButton->updateSize();
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -606,6 +659,8 @@ namespace tgui
         m_spaceBetweenArrows = space;
 
         m_spinButton->updateSize();
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -662,8 +717,8 @@ namespace tgui
                 arrow.setPoint(2, {arrowBack.getPosition().x + (arrowBack.getSize().x * 4/5), arrowBack.getPosition().y + (arrowBack.getSize().y * 4/5)});
             }
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            DrawBatcher::draw(target, arrowBack, states);
+            DrawBatcher::draw(target, arrow, states);
 
             if (m_spinButton->m_mouseHover && !m_spinButton->m_mouseHoverOnTopArrow)
             {
@@ -693,8 +748,8 @@ namespace tgui
                 arrow.setPoint(2, {arrowBack.getPosition().x + (arrowBack.getSize().x / 5), arrowBack.getPosition().y + (arrowBack.getSize().y * 4/5)});
             }
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            DrawBatcher::draw(target, arrowBack, states);
+            DrawBatcher::draw(target, arrow, states);
         }
 
         // Draw the space between the arrows if needed
@@ -713,7 +768,7 @@ namespace tgui
             }
 
             space.setFillColor(calcColorOpacity(m_borderColor, m_spinButton->getOpacity()));
-            target.draw(space, states);
+            DrawBatcher::draw(target, space, states);
         }
 
         // Draw the borders around the spin button
@@ -723,22 +778,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(m_borderColor, m_spinButton->getOpacity()));
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
         }
     }
 
@@ -23,12 +23,12 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <TGUI/Clipping.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/Tab.hpp>
 
-#include <SFML/OpenGL.hpp>
-
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -39,9 +39,7 @@ namespace tgui
 
     Tab::Tab()
     {
-        m_callback.widgetType = "Tab";
-
-        addSignal<sf::String>("TabSelected");
+        setWidgetType(WidgetTypes::Tab);
 
         m_renderer = std::make_shared<TabRenderer>(this);
         reload();
@@ -61,6 +59,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> Tab::getSignals()
+    {
+        auto signals = Widget::getSignals();
+        signals.insert(signals.end(), {&m_onTabSelected});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Tab::setPosition(const Layout2d& position)
     {
         Widget::setPosition(position);
@@ -171,6 +178,8 @@ namespace tgui
         if (m_selectedTab >= static_cast<int>(index))
             m_selectedTab++;
 
+        invalidate();
+
         // If the tab has to be selected then do so
         if (selectTab)
             select(index);
@@ -193,6 +202,9 @@ namespace tgui
         if (index >= m_tabTexts.size())
             return false;
 
+        // The tab might become narrower, so the area that the tabs covered before has to be redrawn as well
+        invalidate();
+
         // Update the width
         {
             m_width -= m_tabWidth[index];
@@ -215,6 +227,7 @@ namespace tgui
 
         // Recalculate the positions of the tabs
         updatePosition();
+        invalidate();
         return true;
     }
 
@@ -250,10 +263,11 @@ namespace tgui
         // Select the tab
         m_selectedTab = static_cast<int>(index);
         m_tabTexts[m_selectedTab].setTextColor(calcColorOpacity(getRenderer()->m_selectedTextColor, getOpacity()));
+        invalidate();
 
         // Send the callback
         m_callback.text = m_tabTexts[index].getText();
-        sendSignal("TabSelected", m_tabTexts[index].getText());
+        sendSignal(m_onTabSelected, m_tabTexts[index].getText());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -264,6 +278,7 @@ namespace tgui
             m_tabTexts[m_selectedTab].setTextColor(calcColorOpacity(getRenderer()->m_textColor, getOpacity()));
 
         m_selectedTab = -1;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -288,6 +303,9 @@ namespace tgui
         if (index > m_tabTexts.size() - 1)
             return;
 
+        // The tabs become narrower, so the area that they covered before has to be redrawn
+        invalidate();
+
         if (getRenderer()->m_textureNormal.isLoaded() && getRenderer()->m_textureSelected.isLoaded())
         {
             auto texturesNormalIt = getRenderer()->m_texturesNormal.begin();
@@ -320,6 +338,8 @@ namespace tgui
 
     void Tab::removeAll()
     {
+        invalidate();
+
         m_tabTexts.clear();
         m_tabWidth.clear();
         m_selectedTab = -1;
@@ -361,6 +381,8 @@ namespace tgui
 
     void Tab::setTabHeight(float height)
     {
+        invalidate();
+
         m_tabHeight = height;
 
         if (getRenderer()->m_textureNormal.isLoaded() && getRenderer()->m_textureSelected.isLoaded())
@@ -380,6 +402,8 @@ namespace tgui
         // Recalculate the size when auto sizing
         if (m_requestedTextSize == 0)
             setTextSize(0);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -459,6 +483,8 @@ namespace tgui
 
     void Tab::recalculateTabsWidth()
     {
+        invalidate();
+
         m_width = 0;
 
         auto textureNormalIt = getRenderer()->m_texturesNormal.begin();
@@ -487,6 +513,7 @@ namespace tgui
 
         // Recalculate the positions of the tabs
         updatePosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -522,7 +549,6 @@ namespace tgui
         // Draw the background
         getRenderer()->draw(target, states);
 
-        GLint scissor[4];
         float accumulatedTabWidth = 0;
 
         // Draw the text
@@ -536,42 +562,24 @@ namespace tgui
             // Check if clipping is required for this text
             if (clippingRequired)
             {
-                // Get the old clipping area
-                glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
                 const sf::View& view = target.getView();
 
-                // Calculate the scale factor of the view
-                float scaleViewX = target.getSize().x / view.getSize().x;
-                float scaleViewY = target.getSize().y / view.getSize().y;
-
                 // Get the global position
                 sf::Vector2f topLeftPosition = {((getAbsolutePosition().x + accumulatedTabWidth + getRenderer()->m_distanceToSide + (view.getSize().x / 2.f) - view.getCenter().x) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
                                                 ((getAbsolutePosition().y + (view.getSize().y / 2.f) - view.getCenter().y) * view.getViewport().height) + (view.getSize().y * view.getViewport().top)};
                 sf::Vector2f bottomRightPosition = {((getAbsolutePosition().x + accumulatedTabWidth + m_tabWidth[i] - getRenderer()->m_distanceToSide - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
                                                     ((getAbsolutePosition().y + ((m_tabHeight + m_tabTexts[i].getSize().y) / 2.f) - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top)};
 
-                // Calculate the clipping area
-                GLint scissorLeft = std::max(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-                GLint scissorTop = std::max(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-                GLint scissorRight = std::min(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-                GLint scissorBottom = std::min(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-                if (scissorRight < scissorLeft)
-                    scissorRight = scissorLeft;
-                else if (scissorBottom < scissorTop)
-                    scissorTop = scissorBottom;
-
                 // Set the clipping area
-                glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+                Clipping::push(target, topLeftPosition, bottomRightPosition);
             }
 
             // Draw the text
-            target.draw(m_tabTexts[i], states);
+            DrawBatcher::draw(target, m_tabTexts[i], states);
 
             // Reset the old clipping area when needed
             if (clippingRequired)
-                glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+                Clipping::pop();
 
             accumulatedTabWidth += m_tabWidth[i] + ((getRenderer()->getBorders().left + getRenderer()->getBorders().right) / 2.0f);
         }
@@ -707,6 +715,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TabRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+
+        invalidateWidget();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TabRenderer::setTextColor(const Color& color)
     {
         m_textColor = color;
@@ -716,6 +733,8 @@ namespace tgui
 
         if (m_tab->m_selectedTab >= 0)
             m_tab->m_tabTexts[m_tab->m_selectedTab].setTextColor(calcColorOpacity(m_selectedTextColor, m_tab->getOpacity()));
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -726,6 +745,8 @@ namespace tgui
 
         if (m_tab->m_selectedTab >= 0)
             m_tab->m_tabTexts[m_tab->m_selectedTab].setTextColor(calcColorOpacity(m_selectedTextColor, m_tab->getOpacity()));
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -735,6 +756,8 @@ namespace tgui
         m_distanceToSide = distanceToSide;
 
         m_tab->recalculateTabsWidth();
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -742,6 +765,8 @@ namespace tgui
     void TabRenderer::setBackgroundColor(const Color& color)
     {
         m_backgroundColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -749,6 +774,8 @@ namespace tgui
     void TabRenderer::setSelectedBackgroundColor(const Color& color)
     {
         m_selectedBackgroundColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -756,6 +783,8 @@ namespace tgui
     void TabRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -781,6 +810,8 @@ namespace tgui
                 m_tab->recalculateTabsWidth();
             }
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -806,6 +837,8 @@ namespace tgui
                 m_tab->recalculateTabsWidth();
             }
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -837,7 +870,7 @@ namespace tgui
                 else
                     background.setFillColor(calcColorOpacity(m_backgroundColor, m_tab->getOpacity()));
 
-                target.draw(background, states);
+                DrawBatcher::draw(target, background, states);
             }
 
             // If there are borders then also draw them between the tabs
@@ -846,7 +879,7 @@ namespace tgui
                 sf::RectangleShape border({(m_borders.left + m_borders.right / 2.0f), m_tab->m_tabHeight});
                 border.setPosition(positionX + m_tab->m_tabWidth[i], m_tab->getPosition().y);
                 border.setFillColor(calcColorOpacity(m_borderColor, m_tab->getOpacity()));
-                target.draw(border, states);
+                DrawBatcher::draw(target, border, states);
             }
 
             // Position the next tab
@@ -863,22 +896,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(m_borderColor, m_tab->getOpacity()));
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
         }
     }
 
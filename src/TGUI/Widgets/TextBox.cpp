@@ -23,14 +23,15 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <TGUI/Clipping.hpp>
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
 
-#include <SFML/OpenGL.hpp>
-
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
@@ -42,11 +43,9 @@ namespace tgui
 
     TextBox::TextBox()
     {
-        m_callback.widgetType = "TextBox";
+        setWidgetType(WidgetTypes::TextBox);
         m_draggableWidget = true;
 
-        addSignal<sf::String>("TextChanged");
-
         m_renderer = std::make_shared<TextBoxRenderer>(this);
         reload();
 
@@ -76,7 +75,8 @@ namespace tgui
         m_selectionRects     (scrollbarToCopy.m_selectionRects), // Did not compile in VS2013 when using braces
         m_scroll             {Scrollbar::copy(scrollbarToCopy.m_scroll)},
         m_possibleDoubleClick{scrollbarToCopy.m_possibleDoubleClick},
-        m_readOnly           {scrollbarToCopy.m_readOnly}
+        m_readOnly           {scrollbarToCopy.m_readOnly},
+        m_onTextChanged      {scrollbarToCopy.m_onTextChanged}
     {
     }
 
@@ -109,6 +109,7 @@ namespace tgui
             std::swap(m_scroll,              temp.m_scroll);
             std::swap(m_possibleDoubleClick, temp.m_possibleDoubleClick);
             std::swap(m_readOnly,            temp.m_readOnly);
+            std::swap(m_onTextChanged,       temp.m_onTextChanged);
         }
 
         return *this;
@@ -126,6 +127,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Signal*> TextBox::getSignals()
+    {
+        auto signals = Widget::getSignals();
+        signals.insert(signals.end(), {&m_onTextChanged});
+        return signals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::setPosition(const Layout2d& position)
     {
         // When the position is changed we just have to move the stuff. Otherwise it means we have to recalculate things.
@@ -356,6 +366,8 @@ namespace tgui
         m_text = text;
 
         rearrangeText(false);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -363,6 +375,8 @@ namespace tgui
     void TextBox::addText(const sf::String& text)
     {
         setText(m_text + text);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -395,6 +409,8 @@ namespace tgui
             m_lineHeight = 0;
 
         updateSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -411,6 +427,8 @@ namespace tgui
             m_text.erase(m_maxChars, sf::String::InvalidPos);
             rearrangeText(false);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -423,6 +441,8 @@ namespace tgui
             updateSize();
         else
             rearrangeText(false);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -437,6 +457,8 @@ namespace tgui
     void TextBox::setReadOnly(bool readOnly)
     {
         m_readOnly = readOnly;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -480,6 +502,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool TextBox::getMouseArea(sf::FloatRect& area) const
+    {
+        area = {getPosition().x, getPosition().y, getSize().x, getSize().y};
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::leftMousePressed(float x, float y)
     {
         // Set the mouse down flag
@@ -499,6 +529,7 @@ namespace tgui
             {
                 m_scroll->leftMousePressed(x, y);
                 clickedOnTextBox = false;
+                invalidate();
             }
 
             // If the value of the scrollbar has changed then update the text
@@ -623,6 +654,7 @@ namespace tgui
 
                 // If the next click comes soon enough then it will be a double click
                 m_possibleDoubleClick = true;
+                requestUpdates();
             }
 
             // Update the texts
@@ -631,6 +663,7 @@ namespace tgui
             // The caret should be visible
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+            invalidate();
         }
     }
 
@@ -680,6 +713,8 @@ namespace tgui
 
                     updatePosition();
                 }
+
+                invalidate();
             }
         }
     }
@@ -694,9 +729,15 @@ namespace tgui
         // The mouse has moved so a double click is no longer possible
         m_possibleDoubleClick = false;
 
+        // Only redraw the text box when the mouse changed what is shown
+        bool changed = false;
+
         // If there is a scrollbar then pass the event
         if (m_scroll != nullptr)
         {
+            const bool oldScrollbarHover = m_scroll->m_mouseHover;
+            const auto oldScrollbarHoverPart = m_scroll->m_mouseHoverOverPart;
+
             // Check if you are dragging the thumb of the scrollbar
             if (m_scroll->m_mouseDown)
             {
@@ -709,6 +750,10 @@ namespace tgui
                 // If the value of the scrollbar has changed then update the text
                 if (oldValue != m_scroll->getValue())
                     updatePosition();
+
+                // The thumb follows the mouse even when the value didn't change
+                if (!m_scroll->m_mouseDownOnArrow)
+                    changed = true;
             }
             else // You are just moving the mouse
             {
@@ -716,6 +761,9 @@ namespace tgui
                 if (m_scroll->mouseOnWidget(x, y))
                     m_scroll->mouseMoved(x, y);
             }
+
+            if ((m_scroll->m_mouseHover != oldScrollbarHover) || (m_scroll->m_mouseHoverOverPart != oldScrollbarHoverPart))
+                changed = true;
         }
 
         // If the mouse is held down then you are selecting text
@@ -726,6 +774,7 @@ namespace tgui
             {
                 m_selEnd = caretPosition;
                 updateSelectionTexts();
+                changed = true;
             }
 
             // Check if the caret is located above or below the view
@@ -735,14 +784,19 @@ namespace tgui
                 {
                     m_scroll->setValue(static_cast<unsigned int>(m_selEnd.y * m_lineHeight));
                     updatePosition();
+                    changed = true;
                 }
                 else if (m_selEnd.y + 1 >= m_topLine + m_visibleLines)
                 {
                     m_scroll->setValue(static_cast<unsigned int>(((m_selEnd.y + 1) * m_lineHeight) - m_scroll->getLowValue()));
                     updatePosition();
+                    changed = true;
                 }
             }
         }
+
+        if (changed)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -752,8 +806,11 @@ namespace tgui
         if (m_mouseHover)
             mouseLeftWidget();
 
-        if (m_scroll != nullptr)
+        if ((m_scroll != nullptr) && m_scroll->m_mouseHover)
+        {
             m_scroll->m_mouseHover = false;
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -762,8 +819,11 @@ namespace tgui
     {
         Widget::mouseNoLongerDown();
 
-        if (m_scroll != nullptr)
+        if ((m_scroll != nullptr) && m_scroll->m_mouseDown)
+        {
             m_scroll->m_mouseDown = false;
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1081,7 +1141,7 @@ namespace tgui
                 m_animationTimeElapsed = {};
 
                 m_callback.text = m_text;
-                sendSignal("TextChanged", m_text);
+                sendSignal(m_onTextChanged, m_text);
                 break;
             }
 
@@ -1115,7 +1175,7 @@ namespace tgui
                     deleteSelectedCharacters();
 
                 m_callback.text = m_text;
-                sendSignal("TextChanged", m_text);
+                sendSignal(m_onTextChanged, m_text);
                 break;
             }
 
@@ -1169,7 +1229,7 @@ namespace tgui
                         rearrangeText(true);
 
                         m_callback.text = m_text;
-                        sendSignal("TextChanged", m_text);
+                        sendSignal(m_onTextChanged, m_text);
                     }
                 }
 
@@ -1183,6 +1243,7 @@ namespace tgui
         // The caret should be visible again
         m_caretVisible = true;
         m_animationTimeElapsed = {};
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1240,9 +1301,10 @@ namespace tgui
         // The caret should be visible again
         m_caretVisible = true;
         m_animationTimeElapsed = {};
+        invalidate();
 
         m_callback.text = m_text;
-        sendSignal("TextChanged", m_text);
+        sendSignal(m_onTextChanged, m_text);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1274,6 +1336,7 @@ namespace tgui
         }
 
         updatePosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1284,6 +1347,11 @@ namespace tgui
         sf::Keyboard::setVirtualKeyboardVisible(true);
     #endif
 
+        // The caret didn't blink while the widget was unfocused, it is shown right away when the widget gets focused
+        m_caretVisible = true;
+        m_animationTimeElapsed = {};
+        requestUpdates();
+
         Widget::widgetFocused();
     }
 
@@ -1716,6 +1784,7 @@ namespace tgui
 
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
+            invalidate();
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
@@ -1724,6 +1793,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool TextBox::isUpdateNeeded() const
+    {
+        return m_focused || m_possibleDoubleClick || Widget::isUpdateNeeded();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time TextBox::timeUntilNextUpdate() const
+    {
+        // The caret time also ends the double click time, because the widget is focused while waiting for a second click
+        if (!m_focused)
+            return Widget::timeUntilNextUpdate();
+
+        const sf::Time caretTime = (m_animationTimeElapsed < sf::milliseconds(500)) ? (sf::milliseconds(500) - m_animationTimeElapsed) : sf::Time::Zero;
+        return std::min(caretTime, Widget::timeUntilNextUpdate());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setBorders(2, 2, 2, 2);
@@ -1749,10 +1837,6 @@ namespace tgui
     {
         const sf::View& view = target.getView();
 
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
         Padding padding = getRenderer()->getScaledPadding();
 
         // Get the global position
@@ -1764,23 +1848,8 @@ namespace tgui
         // Draw the background and borders
         getRenderer()->draw(target, states);
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = std::max(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = std::max(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = std::min(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = std::min(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        Clipping::push(target, topLeftPosition, bottomRightPosition);
 
         // Draw the background of the selected text
         for (auto& selectionRect : m_selectionRects)
@@ -1788,17 +1857,17 @@ namespace tgui
             sf::RectangleShape rect{{selectionRect.width, selectionRect.height}};
             rect.setPosition({selectionRect.left, selectionRect.top});
             rect.setFillColor(calcColorOpacity(getRenderer()->m_selectedTextBgrColor, getOpacity()));
-            target.draw(rect, states);
+            DrawBatcher::draw(target, rect, states);
         }
 
         // Draw the text
-        target.draw(m_textBeforeSelection, states);
+        DrawBatcher::draw(target, m_textBeforeSelection, states);
         if (m_selStart != m_selEnd)
         {
-            target.draw(m_textSelection1, states);
-            target.draw(m_textSelection2, states);
-            target.draw(m_textAfterSelection1, states);
-            target.draw(m_textAfterSelection2, states);
+            DrawBatcher::draw(target, m_textSelection1, states);
+            DrawBatcher::draw(target, m_textSelection2, states);
+            DrawBatcher::draw(target, m_textAfterSelection1, states);
+            DrawBatcher::draw(target, m_textAfterSelection2, states);
         }
 
         // Only draw the caret if it has a width
@@ -1810,16 +1879,16 @@ namespace tgui
                 sf::RectangleShape caret({getRenderer()->m_caretWidth, static_cast<float>(m_lineHeight)});
                 caret.setPosition(m_caretPosition.x - (getRenderer()->m_caretWidth * 0.5f), static_cast<float>(m_caretPosition.y));
                 caret.setFillColor(calcColorOpacity(getRenderer()->m_caretColor, getOpacity()));
-                target.draw(caret, states);
+                DrawBatcher::draw(target, caret, states);
             }
         }
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        Clipping::pop();
 
         // Draw the scrollbar if there is one
         if (m_scroll != nullptr)
-            target.draw(*m_scroll, states);
+            DrawBatcher::draw(target, *m_scroll, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1973,9 +2042,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBoxRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+
+        invalidateWidget();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBoxRenderer::setBackgroundColor(const Color& color)
     {
         m_backgroundColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1986,6 +2066,8 @@ namespace tgui
         m_textBox->m_textBeforeSelection.setColor(calcColorOpacity(m_textColor, m_textBox->getOpacity()));
         m_textBox->m_textAfterSelection1.setColor(calcColorOpacity(m_textColor, m_textBox->getOpacity()));
         m_textBox->m_textAfterSelection2.setColor(calcColorOpacity(m_textColor, m_textBox->getOpacity()));
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1995,6 +2077,8 @@ namespace tgui
         m_selectedTextColor = color;
         m_textBox->m_textSelection1.setColor(calcColorOpacity(m_selectedTextColor, m_textBox->getOpacity()));
         m_textBox->m_textSelection2.setColor(calcColorOpacity(m_selectedTextColor, m_textBox->getOpacity()));
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2002,6 +2086,8 @@ namespace tgui
     void TextBoxRenderer::setSelectedTextBackgroundColor(const Color& color)
     {
         m_selectedTextBgrColor = color;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2009,6 +2095,8 @@ namespace tgui
     void TextBoxRenderer::setBorderColor(const Color& borderColor)
     {
         m_borderColor = borderColor;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2016,6 +2104,8 @@ namespace tgui
     void TextBoxRenderer::setCaretColor(const Color& caretColor)
     {
         m_caretColor = caretColor;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2023,6 +2113,8 @@ namespace tgui
     void TextBoxRenderer::setCaretWidth(float width = 2)
     {
         m_caretWidth = width;
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2036,6 +2128,8 @@ namespace tgui
             m_backgroundTexture.setSize(m_textBox->getSize());
             m_backgroundTexture.setColor({m_backgroundTexture.getColor().r, m_backgroundTexture.getColor().g, m_backgroundTexture.getColor().b, static_cast<sf::Uint8>(m_textBox->getOpacity() * 255)});
         }
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2044,6 +2138,8 @@ namespace tgui
     {
         WidgetPadding::setPadding(padding);
         m_textBox->updateSize();
+
+        invalidateWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2058,7 +2154,7 @@ namespace tgui
             sf::RectangleShape background(m_textBox->getSize());
             background.setPosition(m_textBox->getPosition());
             background.setFillColor(calcColorOpacity(m_backgroundColor, m_textBox->getOpacity()));
-            target.draw(background, states);
+            DrawBatcher::draw(target, background, states);
         }
 
         // Draw the borders
@@ -2071,22 +2167,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(m_borderColor, m_textBox->getOpacity()));
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            DrawBatcher::draw(target, border, states);
         }
     }
 
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Widgets/devel/RichTextLabel.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -79,7 +80,7 @@ namespace tgui
 
     RichTextLabel::RichTextLabel()
     {
-        m_callback.widgetType = "RichTextLabel";
+        setWidgetType(WidgetTypes::RichTextLabel);
 
         m_background.setFillColor(sf::Color::Transparent);
 
@@ -393,10 +394,10 @@ namespace tgui
     void RichTextLabel::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         if (m_background.getFillColor() != sf::Color::Transparent)
-            target.draw(m_background, states);
+            DrawBatcher::draw(target, m_background, states);
 
         for(std::size_t i = 0; i < m_texts.size(); ++i)
-            target.draw(m_texts[i], states);
+            DrawBatcher::draw(target, m_texts[i], states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <TGUI/DrawBatcher.hpp>
 #include <TGUI/Widgets/devel/Table.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,7 +34,7 @@ namespace tgui
 
     Table::Table()
     {
-        m_callback.widgetType = "Table";
+        setWidgetType(WidgetTypes::Table);
 
 /// TODO
 /*
@@ -120,6 +121,18 @@ namespace tgui
         insert(m_widgets.size(), widget, widgetName);
     }
 
+    void Table::addWidgets(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames)
+    {
+        if (!widgetNames.empty() && (widgetNames.size() != widgets.size()))
+            throw Exception{"The amount of widget names passed to addWidgets has to be the same as the amount of widgets."};
+
+        // Every widget has to be wrapped separately
+        for (std::size_t i = 0; i < widgets.size(); ++i)
+            add(widgets[i], widgetNames.empty() ? sf::String{} : widgetNames[i]);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Table::addRow(const std::vector<std::string>& columns)
@@ -283,20 +296,20 @@ namespace tgui
         {
             sf::RectangleShape background(getSize());
             background.setFillColor(m_backgroundColor);
-            target.draw(background, states);
+            DrawBatcher::draw(target, background, states);
         }
 
         // Draw the widgets
-        target.draw(*m_header, states);
+        DrawBatcher::draw(target, *m_header, states);
         drawWidgetContainer(&target, states);
 
 /// TODO
 /*
-        target.draw(m_tableBorder, states);
-        //target.draw(m_headerSeparator, states);
+        DrawBatcher::draw(target, m_tableBorder, states);
+        //DrawBatcher::draw(target, m_headerSeparator, states);
 */
         for (std::size_t i = 0; i < m_columnsDelimitators.size(); ++i)
-            target.draw(m_columnsDelimitators[i], states);
+            DrawBatcher::draw(target, m_columnsDelimitators[i], states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,7 +31,7 @@ namespace tgui
 {
     TableRow::TableRow()
     {
-        m_callback.widgetType = "TableRow";
+        setWidgetType(WidgetTypes::TableRow);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -84,6 +84,18 @@ namespace tgui
         HorizontalLayout::insert(m_widgets.size(), createItem(widget, m_align), widgetName);
     }
 
+    void TableRow::addWidgets(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames)
+    {
+        if (!widgetNames.empty() && (widgetNames.size() != widgets.size()))
+            throw Exception{"The amount of widget names passed to addWidgets has to be the same as the amount of widgets."};
+
+        // Every widget has to be wrapped separately
+        for (std::size_t i = 0; i < widgets.size(); ++i)
+            add(widgets[i], widgetNames.empty() ? sf::String{} : widgetNames[i]);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TableRow::add(const tgui::Widget::Ptr& widget, TableItem::HorizontalAlign align, const sf::String& widgetName)
@@ -0,0 +1,106 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Clipping.hpp>
+
+#include <thread>
+
+TEST_CASE("[Clipping]") {
+    sf::RenderTexture target;
+    target.create(200, 100);
+
+    REQUIRE(tgui::Clipping::getArea() == sf::IntRect());
+
+    tgui::Clipping::beginDrawing(target, 0, 0, 200, 100);
+    REQUIRE(tgui::Clipping::getArea() == sf::IntRect(0, 0, 200, 100));
+
+    SECTION("nested areas") {
+        tgui::Clipping::push(target, {10, 20}, {110, 70});
+        REQUIRE(tgui::Clipping::getArea() == sf::IntRect(10, 20, 100, 50));
+
+        tgui::Clipping::push(target, {50, 0}, {300, 60});
+        REQUIRE(tgui::Clipping::getArea() == sf::IntRect(50, 20, 60, 40));
+
+        tgui::Clipping::pop();
+        REQUIRE(tgui::Clipping::getArea() == sf::IntRect(10, 20, 100, 50));
+
+        // Nothing is visible when the area lies outside the current area
+        tgui::Clipping::push(target, {300, 300}, {400, 400});
+        REQUIRE(tgui::Clipping::getArea().width == 0);
+        REQUIRE(tgui::Clipping::getArea().height == 0);
+        tgui::Clipping::pop();
+
+        tgui::Clipping::pop();
+        REQUIRE(tgui::Clipping::getArea() == sf::IntRect(0, 0, 200, 100));
+    }
+
+    SECTION("scaled view") {
+        target.setView(sf::View{{0, 0, 100, 50}});
+        tgui::Clipping::push(target, {10, 10}, {20, 20});
+        REQUIRE(tgui::Clipping::getArea() == sf::IntRect(20, 20, 20, 20));
+        tgui::Clipping::pop();
+    }
+
+    SECTION("partial scissor box") {
+        // The scissor box is given in OpenGL coordinates, with the origin in the bottom left corner
+        tgui::Clipping::beginDrawing(target, 10, 30, 100, 50);
+        REQUIRE(tgui::Clipping::getArea() == sf::IntRect(10, 20, 100, 50));
+        tgui::Clipping::endDrawing();
+    }
+
+    SECTION("render texture") {
+        // The areas that were pushed for the other target are ignored
+        tgui::Clipping::push(target, {10, 20}, {110, 70});
+        tgui::Clipping::beginDrawing(target, {50, 10, 100, 80});
+        REQUIRE(tgui::Clipping::getArea() == sf::IntRect(50, 10, 100, 80));
+        tgui::Clipping::endDrawing();
+        REQUIRE(tgui::Clipping::getArea() == sf::IntRect(10, 20, 100, 50));
+        tgui::Clipping::pop();
+    }
+
+    SECTION("separate stack per thread") {
+        // A gui that is drawn on another thread doesn't see or change the areas of this thread
+        sf::IntRect areaBefore;
+        sf::IntRect areaWhileDrawing;
+        sf::IntRect areaAfter;
+        std::thread thread{[&](){
+                areaBefore = tgui::Clipping::getArea();
+                tgui::Clipping::beginDrawing(target, 0, 0, 50, 50);
+                areaWhileDrawing = tgui::Clipping::getArea();
+                tgui::Clipping::endDrawing();
+                areaAfter = tgui::Clipping::getArea();
+            }};
+        thread.join();
+
+        REQUIRE(areaBefore == sf::IntRect());
+        REQUIRE(areaWhileDrawing == sf::IntRect(0, 50, 50, 50));
+        REQUIRE(areaAfter == sf::IntRect());
+        REQUIRE(tgui::Clipping::getArea() == sf::IntRect(0, 0, 200, 100));
+    }
+
+    tgui::Clipping::endDrawing();
+    REQUIRE(tgui::Clipping::getArea() == sf::IntRect());
+}
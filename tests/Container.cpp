@@ -25,6 +25,113 @@
 #include "Tests.hpp"
 #include <TGUI/TGUI.hpp>
 
+namespace
+{
+    // Gives access to the function that finds the widget below the mouse
+    class HitTestPanel : public tgui::Panel
+    {
+    public:
+        using tgui::Container::mouseOnWhichWidget;
+    };
+
+    // Counts the mouse events that it receives
+    class MouseTestWidget : public tgui::ClickableWidget
+    {
+    public:
+        MouseTestWidget(bool draggable)
+        {
+            m_draggableWidget = draggable;
+            setSize(50, 50);
+        }
+
+        virtual void mouseMoved(float x, float y) override
+        {
+            moveCount++;
+            tgui::ClickableWidget::mouseMoved(x, y);
+        }
+
+        virtual void mouseNoLongerDown() override
+        {
+            mouseNoLongerDownCount++;
+            tgui::ClickableWidget::mouseNoLongerDown();
+        }
+
+        unsigned int moveCount = 0;
+        unsigned int mouseNoLongerDownCount = 0;
+    };
+
+    // Counts how many times it gets updated
+    class UpdateTestWidget : public tgui::ClickableWidget
+    {
+    public:
+        UpdateTestWidget()
+        {
+            m_updatedEveryFrame = false;
+        }
+
+        void startWork()
+        {
+            working = true;
+            requestUpdates();
+        }
+
+        virtual void update(sf::Time elapsedTime) override
+        {
+            updateCount++;
+            tgui::ClickableWidget::update(elapsedTime);
+        }
+
+        virtual bool isUpdateNeeded() const override
+        {
+            return working || tgui::ClickableWidget::isUpdateNeeded();
+        }
+
+        bool working = false;
+        unsigned int updateCount = 0;
+    };
+
+    // Custom widget that only overrides update, like widgets did before they had to request updates
+    class LegacyUpdateWidget : public tgui::ClickableWidget
+    {
+    public:
+        virtual void update(sf::Time elapsedTime) override
+        {
+            updateCount++;
+            tgui::ClickableWidget::update(elapsedTime);
+        }
+
+        unsigned int updateCount = 0;
+    };
+
+    // Custom widget that keeps itself updated by requesting updates from its update function
+    class SelfUpdatingWidget : public tgui::ClickableWidget
+    {
+    public:
+        SelfUpdatingWidget()
+        {
+            m_updatedEveryFrame = false;
+        }
+
+        void startUpdating()
+        {
+            keepUpdating = true;
+            requestUpdates();
+        }
+
+        virtual void update(sf::Time elapsedTime) override
+        {
+            updateCount++;
+            tgui::ClickableWidget::update(elapsedTime);
+
+            if (keepUpdating)
+                requestUpdates();
+        }
+
+        bool keepUpdating = false;
+        unsigned int updateCount = 0;
+    };
+}
+
 TEST_CASE("[Container]") {
     auto container = std::make_shared<tgui::Gui>();
 
@@ -184,6 +291,93 @@ TEST_CASE("[Container]") {
         REQUIRE(container->getWidgetName(widget3) == "w003");
     }
 
+    SECTION("name index") {
+        SECTION("duplicate names") {
+            auto w6 = std::make_shared<tgui::Button>();
+            container->add(w6, "w1");
+            REQUIRE(container->get("w1") == widget1);
+
+            widget1->moveToFront();
+            REQUIRE(container->get("w1") == w6);
+
+            REQUIRE(container->setWidgetName(w6, "w6"));
+            REQUIRE(container->get("w1") == widget1);
+            REQUIRE(container->get("w6") == w6);
+            REQUIRE(container->getWidgetName(w6) == "w6");
+
+            REQUIRE(container->remove(widget1));
+            REQUIRE(container->get("w1") == nullptr);
+            REQUIRE(container->getWidgetName(widget3) == "w3");
+        }
+
+        SECTION("recursive with duplicate names") {
+            // The widgets inside a container are searched before the widgets behind the container
+            widget2->add(std::make_shared<tgui::Button>(), "w3");
+            REQUIRE(container->get("w3", true) == widget2->get("w3"));
+
+            widget3->moveToBack();
+            REQUIRE(container->get("w3", true) == widget3);
+
+            widget2->moveToBack();
+            REQUIRE(container->get("w3", true) == widget2->get("w3"));
+        }
+
+        SECTION("global name index") {
+            REQUIRE(!container->isGlobalNameIndexEnabled());
+            container->setGlobalNameIndexEnabled(true);
+            REQUIRE(container->isGlobalNameIndexEnabled());
+
+            REQUIRE(container->get("w0", true) == nullptr);
+            REQUIRE(container->get("w1", true) == widget1);
+            REQUIRE(container->get("w4", true) == widget4);
+            REQUIRE(widget2->get("w5", true) == widget5);
+            REQUIRE(widget2->get("w1", true) == nullptr);
+
+            // Widgets added to a container inside the gui
+            auto panel = std::make_shared<tgui::Panel>();
+            auto w6 = std::make_shared<tgui::Button>();
+            panel->add(w6, "w6");
+            widget2->add(panel, "panel");
+            REQUIRE(container->get("w6", true) == w6);
+            REQUIRE(container->get("panel", true) == panel);
+
+            auto w7 = std::make_shared<tgui::Button>();
+            panel->add(w7, "w7");
+            REQUIRE(container->get("w7", true) == w7);
+
+            // Renaming
+            REQUIRE(panel->setWidgetName(w7, "w8"));
+            REQUIRE(container->get("w7", true) == nullptr);
+            REQUIRE(container->get("w8", true) == w7);
+
+            // Duplicate names still return the first widget
+            widget2->add(std::make_shared<tgui::Button>(), "w3");
+            REQUIRE(container->get("w3", true) == widget2->get("w3"));
+            widget2->moveToFront();
+            REQUIRE(container->get("w3", true) == widget3);
+
+            // Moving a container to another parent
+            REQUIRE(widget2->remove(panel));
+            REQUIRE(container->get("w6", true) == nullptr);
+            REQUIRE(panel->get("w6", true) == w6);
+
+            auto otherPanel = std::make_shared<tgui::Panel>();
+            otherPanel->add(panel);
+            REQUIRE(container->get("w6", true) == nullptr);
+            container->add(otherPanel);
+            REQUIRE(container->get("w6", true) == w6);
+            REQUIRE(otherPanel->get("w8", true) == w7);
+            REQUIRE(widget2->get("w8", true) == nullptr);
+
+            container->removeAllWidgets();
+            REQUIRE(container->get("w1", true) == nullptr);
+            REQUIRE(container->get("w6", true) == nullptr);
+
+            container->setGlobalNameIndexEnabled(false);
+            REQUIRE(!container->isGlobalNameIndexEnabled());
+        }
+    }
+
     SECTION("focus") {
         auto editBox1 = std::make_shared<tgui::EditBox>();
         tgui::EditBox::Ptr editBox2 = std::make_shared<tgui::EditBox>();
@@ -225,6 +419,108 @@ TEST_CASE("[Container]") {
         REQUIRE(!editBox3->isFocused());
     }
 
+    SECTION("bulk operations") {
+        container->removeAllWidgets();
+
+        auto editBox1 = std::make_shared<tgui::EditBox>();
+        auto editBox2 = std::make_shared<tgui::EditBox>();
+        auto editBox3 = std::make_shared<tgui::EditBox>();
+        auto editBox4 = std::make_shared<tgui::EditBox>();
+
+        SECTION("addWidgets") {
+            container->addWidgets({editBox1, editBox2, editBox3}, {"e1", "e2", "e3"});
+            REQUIRE(container->getWidgets().size() == 3);
+            REQUIRE(container->getWidgets()[1] == editBox2);
+            REQUIRE(container->getWidgetNames()[2] == "e3");
+            REQUIRE(container->get("e1") == editBox1);
+            REQUIRE(editBox3->getParent() != nullptr);
+
+            container->addWidgets({editBox4});
+            REQUIRE(container->getWidgets().size() == 4);
+            REQUIRE(container->getWidgetNames()[3] == "");
+
+            REQUIRE_THROWS_AS(container->addWidgets({editBox1, editBox2}, {"e1"}), tgui::Exception);
+        }
+
+        SECTION("removeIf") {
+            container->addWidgets({editBox1, editBox2, editBox3, editBox4}, {"e1", "e2", "e3", "e4"});
+            container->focusWidget(editBox2);
+
+            std::size_t calls = 0;
+            REQUIRE(container->removeIf([&](const tgui::Widget::Ptr& widget){ calls++; return widget == editBox1 || widget == editBox3; }) == 2);
+            REQUIRE(calls == 4);
+            REQUIRE(container->getWidgets().size() == 2);
+            REQUIRE(container->getWidgets()[0] == editBox2);
+            REQUIRE(container->getWidgets()[1] == editBox4);
+            REQUIRE(container->getWidgetNames()[1] == "e4");
+            REQUIRE(container->get("e3") == nullptr);
+            REQUIRE(container->get("e4") == editBox4);
+            REQUIRE(editBox1->getParent() == nullptr);
+
+            // The focused widget keeps its focus when it isn't removed
+            REQUIRE(editBox2->isFocused());
+            container->focusNextWidget();
+            REQUIRE(editBox4->isFocused());
+
+            // The focused widget loses its focus when it is removed
+            REQUIRE(container->removeIf([&](const tgui::Widget::Ptr& widget){ return widget == editBox4; }) == 1);
+            REQUIRE(!editBox4->isFocused());
+            REQUIRE(container->removeIf([](const tgui::Widget::Ptr&){ return false; }) == 0);
+            REQUIRE(container->getWidgets().size() == 1);
+        }
+
+        SECTION("reorder") {
+            container->addWidgets({editBox1, editBox2, editBox3}, {"e1", "e2", "e3"});
+            container->focusWidget(editBox1);
+
+            container->reorder({2, 0, 1});
+            REQUIRE(container->getWidgets()[0] == editBox3);
+            REQUIRE(container->getWidgets()[1] == editBox1);
+            REQUIRE(container->getWidgets()[2] == editBox2);
+            REQUIRE(container->getWidgetNames()[0] == "e3");
+            REQUIRE(container->getWidgetNames()[2] == "e2");
+
+            // The focus stays on the same widget
+            REQUIRE(editBox1->isFocused());
+            container->focusNextWidget();
+            REQUIRE(editBox2->isFocused());
+
+            REQUIRE_THROWS_AS(container->reorder({0, 1}), tgui::Exception);
+            REQUIRE_THROWS_AS(container->reorder({0, 1, 1}), tgui::Exception);
+            REQUIRE_THROWS_AS(container->reorder({0, 1, 3}), tgui::Exception);
+            REQUIRE(container->getWidgets()[0] == editBox3);
+        }
+
+        SECTION("moveWidgetToBack") {
+            auto panel = std::make_shared<tgui::Panel>();
+            panel->addWidgets({editBox1, editBox2, editBox3});
+            editBox1->focus();
+
+            editBox3->moveToBack();
+            REQUIRE(panel->getWidgets()[0] == editBox3);
+            REQUIRE(panel->getWidgets()[1] == editBox1);
+            REQUIRE(editBox1->isFocused());
+            panel->focusNextWidget();
+            REQUIRE(editBox2->isFocused());
+        }
+
+        SECTION("BoxLayout") {
+            auto layout = std::make_shared<tgui::HorizontalLayout>();
+            layout->addWidgets({editBox1, editBox2, editBox3});
+            layout->setRatio(editBox1, 2);
+            layout->setRatio(editBox3, 3);
+
+            layout->removeIf([&](const tgui::Widget::Ptr& widget){ return widget == editBox2; });
+            REQUIRE(layout->getWidgets().size() == 2);
+            REQUIRE(layout->getRatio(editBox1) == 2);
+            REQUIRE(layout->getRatio(editBox3) == 3);
+
+            layout->reorder({1, 0});
+            REQUIRE(layout->getRatio(0) == 3);
+            REQUIRE(layout->getRatio(1) == 2);
+        }
+    }
+
     SECTION("setOpacity") {
         REQUIRE(container->getOpacity() == 1);
 
@@ -236,4 +532,324 @@ TEST_CASE("[Container]") {
         REQUIRE(widget4->getOpacity() == 0.7f);
         REQUIRE(widget5->getOpacity() == 0.7f);
     }
+
+    SECTION("mouse down") {
+        auto root = std::make_shared<tgui::Panel>();
+        root->setSize(800, 600);
+
+        auto panel = std::make_shared<tgui::Panel>();
+        panel->setPosition(100, 100);
+        panel->setSize(400, 400);
+        root->add(panel);
+
+        auto draggable = std::make_shared<MouseTestWidget>(true);
+        auto other = std::make_shared<MouseTestWidget>(false);
+        other->setPosition(100, 0);
+        panel->add(draggable);
+        panel->add(other);
+
+        auto outside = std::make_shared<MouseTestWidget>(false);
+        outside->setPosition(600, 0);
+        root->add(outside);
+
+        // The widget keeps receiving mouse moves while it is being dragged, even when the mouse leaves the panel
+        root->leftMousePressed(110, 110);
+        root->mouseMoved(610, 10);
+        REQUIRE(draggable->moveCount == 1);
+        REQUIRE(outside->moveCount == 0);
+
+        // Only the widget on which the mouse went down is told that the mouse was released
+        root->leftMouseReleased(610, 10);
+        root->mouseNoLongerDown();
+        REQUIRE(draggable->mouseNoLongerDownCount == 1);
+        REQUIRE(other->mouseNoLongerDownCount == 0);
+        REQUIRE(outside->mouseNoLongerDownCount == 0);
+
+        root->mouseMoved(610, 10);
+        REQUIRE(draggable->moveCount == 1);
+        REQUIRE(outside->moveCount == 1);
+
+        // Widgets that aren't draggable don't receive moves when the mouse isn't on top of them
+        root->leftMousePressed(610, 10);
+        root->mouseMoved(10, 10);
+        REQUIRE(outside->moveCount == 1);
+
+        // The widget on which the mouse went down before is told about the next release as well
+        root->leftMouseReleased(10, 10);
+        root->mouseNoLongerDown();
+        REQUIRE(outside->mouseNoLongerDownCount == 1);
+        REQUIRE(draggable->mouseNoLongerDownCount == 2);
+        REQUIRE(other->mouseNoLongerDownCount == 0);
+
+        root->leftMouseReleased(10, 10);
+        root->mouseNoLongerDown();
+        REQUIRE(outside->mouseNoLongerDownCount == 2);
+        REQUIRE(draggable->mouseNoLongerDownCount == 2);
+
+        // Removed widgets are forgotten
+        root->leftMousePressed(610, 10);
+        root->remove(outside);
+        root->leftMouseReleased(10, 10);
+        root->mouseNoLongerDown();
+        REQUIRE(outside->mouseNoLongerDownCount == 2);
+    }
+
+    SECTION("spatial index") {
+        auto panel = std::make_shared<HitTestPanel>();
+        panel->setSize(800, 600);
+
+        REQUIRE(!panel->isSpatialIndexEnabled());
+        REQUIRE(panel->getSpatialIndexCellSize() == 64);
+        REQUIRE_THROWS_AS(panel->setSpatialIndexCellSize(0), tgui::Exception);
+
+        std::vector<tgui::Button::Ptr> buttons;
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            auto button = std::make_shared<tgui::Button>();
+            button->setPosition(static_cast<float>((i % 10) * 50), static_cast<float>((i / 10) * 40));
+            button->setSize(60, 50); // Overlaps with the neighbouring buttons
+            panel->add(button);
+            buttons.push_back(button);
+        }
+
+        // A check box can also be clicked on its text, which lies outside its size
+        auto checkBox = std::make_shared<tgui::CheckBox>();
+        checkBox->setPosition(700, 500);
+        checkBox->setSize(20, 20);
+        checkBox->setText("Check me");
+        panel->add(checkBox);
+
+        // The results have to be identical with and without the index
+        auto requireSameResults = [&]{
+                std::vector<tgui::Widget::Ptr> expected;
+                panel->setSpatialIndexEnabled(false);
+                for (float y = -5; y < 560; y += 7)
+                {
+                    for (float x = -5; x < 800; x += 7)
+                        expected.push_back(panel->mouseOnWhichWidget(x, y));
+                }
+
+                panel->setSpatialIndexEnabled(true);
+                std::size_t i = 0;
+                bool identical = true;
+                for (float y = -5; y < 560; y += 7)
+                {
+                    for (float x = -5; x < 800; x += 7)
+                        identical = identical && (panel->mouseOnWhichWidget(x, y) == expected[i++]);
+                }
+                REQUIRE(identical);
+            };
+
+        panel->setSpatialIndexEnabled(true);
+        REQUIRE(panel->isSpatialIndexEnabled());
+        REQUIRE(panel->mouseOnWhichWidget(55, 45) == buttons[11]);
+        REQUIRE(panel->mouseOnWhichWidget(45, 35) == buttons[0]);
+        REQUIRE(panel->mouseOnWhichWidget(730, 510) == checkBox);
+        REQUIRE(panel->mouseOnWhichWidget(790, 590) == nullptr);
+        requireSameResults();
+
+        buttons[0]->moveToFront();
+        REQUIRE(panel->mouseOnWhichWidget(55, 45) == buttons[0]);
+        buttons[0]->moveToBack();
+        REQUIRE(panel->mouseOnWhichWidget(55, 45) == buttons[11]);
+
+        buttons[11]->setPosition(600, 400);
+        REQUIRE(panel->mouseOnWhichWidget(605, 405) == buttons[11]);
+        REQUIRE(panel->mouseOnWhichWidget(55, 45) == buttons[10]);
+        requireSameResults();
+
+        buttons[10]->setSize(600, 500);
+        REQUIRE(panel->mouseOnWhichWidget(550, 45) == buttons[10]);
+        requireSameResults();
+
+        panel->remove(buttons[10]);
+        REQUIRE(panel->mouseOnWhichWidget(55, 45) == buttons[1]);
+        requireSameResults();
+
+        buttons[1]->disable();
+        REQUIRE(panel->mouseOnWhichWidget(55, 45) == nullptr);
+        buttons[1]->hide();
+        REQUIRE(panel->mouseOnWhichWidget(55, 45) == buttons[0]);
+        requireSameResults();
+
+        panel->setSpatialIndexCellSize(25);
+        REQUIRE(panel->getSpatialIndexCellSize() == 25);
+        REQUIRE(panel->isSpatialIndexEnabled());
+        requireSameResults();
+
+        auto copy = std::make_shared<HitTestPanel>(*panel);
+        REQUIRE(copy->isSpatialIndexEnabled());
+        REQUIRE(copy->getSpatialIndexCellSize() == 25);
+        REQUIRE(copy->mouseOnWhichWidget(605, 405) != nullptr);
+
+        panel->removeAllWidgets();
+        REQUIRE(panel->mouseOnWhichWidget(605, 405) == nullptr);
+    }
+
+    SECTION("updates") {
+        auto outerPanel = std::make_shared<tgui::Panel>();
+        auto innerPanel = std::make_shared<tgui::Panel>();
+        auto widget = std::make_shared<UpdateTestWidget>();
+        auto otherWidget = std::make_shared<UpdateTestWidget>();
+        outerPanel->add(innerPanel);
+        outerPanel->add(otherWidget);
+        innerPanel->add(widget);
+
+        tgui::Widget::Ptr root = outerPanel;
+        root->update(sf::milliseconds(10));
+        REQUIRE(widget->updateCount == 0);
+        REQUIRE(otherWidget->updateCount == 0);
+
+        // Only the widget that requested updates is updated, through the panel that contains it
+        widget->startWork();
+        root->update(sf::milliseconds(10));
+        root->update(sf::milliseconds(10));
+        REQUIRE(widget->updateCount == 2);
+        REQUIRE(otherWidget->updateCount == 0);
+
+        // Hidden widgets aren't updated until they are shown again
+        innerPanel->hide();
+        root->update(sf::milliseconds(10));
+        REQUIRE(widget->updateCount == 2);
+        innerPanel->show();
+        root->update(sf::milliseconds(10));
+        REQUIRE(widget->updateCount == 3);
+
+        // The widget is updated one last time after it no longer needs updates
+        widget->working = false;
+        root->update(sf::milliseconds(10));
+        root->update(sf::milliseconds(10));
+        REQUIRE(widget->updateCount == 4);
+
+        // Animations keep the widget updated until they are finished
+        otherWidget->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(100));
+        REQUIRE(otherWidget->getOpacity() == 0);
+        root->update(sf::milliseconds(200));
+        REQUIRE(otherWidget->getOpacity() == 1);
+        root->update(sf::milliseconds(10));
+        REQUIRE(otherWidget->updateCount == 1);
+
+        // A widget that still needs updates keeps them when it is moved to another container
+        widget->startWork();
+        innerPanel->remove(widget);
+        root->update(sf::milliseconds(10));
+        REQUIRE(widget->updateCount == 4);
+        outerPanel->add(widget);
+        root->update(sf::milliseconds(10));
+        REQUIRE(widget->updateCount == 5);
+    }
+
+    SECTION("updates of custom widgets") {
+        auto panel = std::make_shared<tgui::Panel>();
+        auto legacyWidget = std::make_shared<LegacyUpdateWidget>();
+        auto widget = std::make_shared<SelfUpdatingWidget>();
+        panel->add(legacyWidget);
+        panel->add(widget);
+
+        // Custom widgets are updated every frame unless they request their own updates
+        tgui::Widget::Ptr root = panel;
+        root->update(sf::milliseconds(10));
+        root->update(sf::milliseconds(10));
+        REQUIRE(legacyWidget->updateCount == 2);
+        REQUIRE(widget->updateCount == 0);
+
+        legacyWidget->hide();
+        root->update(sf::milliseconds(10));
+        REQUIRE(legacyWidget->updateCount == 2);
+        legacyWidget->show();
+        root->update(sf::milliseconds(10));
+        REQUIRE(legacyWidget->updateCount == 3);
+
+        // Requesting updates again from the update function keeps the widget updated
+        widget->startUpdating();
+        root->update(sf::milliseconds(10));
+        root->update(sf::milliseconds(10));
+        root->update(sf::milliseconds(10));
+        REQUIRE(widget->updateCount == 3);
+
+        widget->keepUpdating = false;
+        root->update(sf::milliseconds(10));
+        root->update(sf::milliseconds(10));
+        REQUIRE(widget->updateCount == 4);
+    }
+
+    SECTION("render cache") {
+        sf::RenderTexture target;
+        target.create(200, 200);
+        tgui::Gui gui{target};
+
+        auto panel = std::make_shared<tgui::Panel>(150, 150);
+        auto button = std::make_shared<tgui::Button>();
+        panel->add(button);
+        gui.add(panel);
+
+        REQUIRE(!panel->isRenderCacheEnabled());
+        gui.draw();
+        REQUIRE(panel->getRenderCacheStats().redraws == 0);
+
+        panel->setRenderCacheEnabled(true);
+        REQUIRE(panel->isRenderCacheEnabled());
+
+        // The widgets are only drawn again after they changed
+        gui.draw();
+        gui.draw();
+        REQUIRE(panel->getRenderCacheStats().redraws == 1);
+        REQUIRE(panel->getRenderCacheStats().hits == 1);
+
+        button->setPosition(10, 10);
+        gui.draw();
+        REQUIRE(panel->getRenderCacheStats().redraws == 2);
+
+        button->getRenderer()->setProperty("TextColor", sf::Color::Red);
+        gui.draw();
+        REQUIRE(panel->getRenderCacheStats().redraws == 3);
+
+        button->hide();
+        gui.draw();
+        button->show();
+        gui.draw();
+        REQUIRE(panel->getRenderCacheStats().redraws == 5);
+
+        // Calling a renderer function directly also invalidates the widget
+        button->getRenderer()->setTextColor(sf::Color::Green);
+        gui.draw();
+        REQUIRE(panel->getRenderCacheStats().redraws == 6);
+
+        // Moving the panel itself doesn't change the cached image
+        panel->setPosition(20, 20);
+        gui.draw();
+        REQUIRE(panel->getRenderCacheStats().redraws == 6);
+
+        // Changing the items of a widget invalidates it
+        auto listBox = std::make_shared<tgui::ListBox>();
+        panel->add(listBox);
+        gui.draw();
+        REQUIRE(panel->getRenderCacheStats().redraws == 7);
+        listBox->addItem("Item");
+        gui.draw();
+        REQUIRE(panel->getRenderCacheStats().redraws == 8);
+        listBox->setSelectedItem("Item");
+        gui.draw();
+        REQUIRE(panel->getRenderCacheStats().redraws == 9);
+        listBox->getRenderer()->setBorders({1, 1, 1, 1});
+        gui.draw();
+        REQUIRE(panel->getRenderCacheStats().redraws == 10);
+        panel->remove(listBox);
+        gui.draw();
+        REQUIRE(panel->getRenderCacheStats().redraws == 11);
+
+        // Changes inside nested containers reach the outer cache
+        auto innerPanel = std::make_shared<tgui::Panel>(50, 50);
+        panel->add(innerPanel);
+        gui.draw();
+        REQUIRE(panel->getRenderCacheStats().redraws == 12);
+        innerPanel->add(std::make_shared<tgui::Button>());
+        gui.draw();
+        REQUIRE(panel->getRenderCacheStats().redraws == 13);
+        REQUIRE(panel->getRenderCacheStats().hits == 2);
+
+        panel->setRenderCacheEnabled(false);
+        gui.draw();
+        REQUIRE(panel->getRenderCacheStats().redraws == 13);
+    }
 }
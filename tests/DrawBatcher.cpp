@@ -0,0 +1,148 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+#include <TGUI/DrawBatcher.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+
+#include <thread>
+
+TEST_CASE("[DrawBatcher]") {
+    sf::RenderTexture target;
+    target.create(200, 100);
+
+    tgui::Texture texture1{"resources/image.png"};
+    tgui::Texture texture2{"resources/image.png"};
+    sf::Texture sfmlTexture;
+    sfmlTexture.loadFromFile("resources/image.png");
+    tgui::Texture otherTexture;
+    otherTexture.load(sfmlTexture);
+    texture2.setPosition(50, 20);
+
+    sf::RectangleShape shape;
+
+    REQUIRE(!tgui::DrawBatcher::isEnabled());
+
+    SECTION("disabled") {
+        tgui::DrawBatcher::beginDrawing();
+        target.draw(texture1);
+        target.draw(texture2);
+        tgui::DrawBatcher::endDrawing();
+
+        REQUIRE(tgui::DrawBatcher::getStats().drawCalls == 2);
+        REQUIRE(tgui::DrawBatcher::getStats().batchedDraws == 0);
+    }
+
+    SECTION("enabled") {
+        tgui::DrawBatcher::setEnabled(true);
+        REQUIRE(tgui::DrawBatcher::isEnabled());
+
+        SECTION("same texture") {
+            tgui::DrawBatcher::beginDrawing();
+            target.draw(texture1);
+            target.draw(texture2);
+            REQUIRE(tgui::DrawBatcher::getStats().drawCalls == 0);
+            tgui::DrawBatcher::endDrawing();
+
+            REQUIRE(tgui::DrawBatcher::getStats().drawCalls == 1);
+            REQUIRE(tgui::DrawBatcher::getStats().batchedDraws == 1);
+
+            // Every textured quad becomes two separate triangles
+            REQUIRE(tgui::DrawBatcher::getStats().batchedVertices == 12);
+        }
+
+        SECTION("different textures") {
+            tgui::DrawBatcher::beginDrawing();
+            target.draw(texture1);
+            target.draw(otherTexture);
+            target.draw(texture2);
+            tgui::DrawBatcher::endDrawing();
+
+            REQUIRE(tgui::DrawBatcher::getStats().drawCalls == 3);
+            REQUIRE(tgui::DrawBatcher::getStats().batchedDraws == 0);
+        }
+
+        SECTION("other drawables keep the order") {
+            tgui::DrawBatcher::beginDrawing();
+            target.draw(texture1);
+            tgui::DrawBatcher::draw(target, shape);
+            REQUIRE(tgui::DrawBatcher::getStats().drawCalls == 2);
+            target.draw(texture2);
+            tgui::DrawBatcher::endDrawing();
+
+            REQUIRE(tgui::DrawBatcher::getStats().drawCalls == 3);
+        }
+
+        SECTION("nested drawing") {
+            tgui::DrawBatcher::beginDrawing();
+            target.draw(texture1);
+            tgui::DrawBatcher::beginDrawing();
+            target.draw(texture2);
+            tgui::DrawBatcher::endDrawing();
+            REQUIRE(tgui::DrawBatcher::getStats().drawCalls == 0);
+            tgui::DrawBatcher::endDrawing();
+
+            REQUIRE(tgui::DrawBatcher::getStats().drawCalls == 1);
+        }
+
+        SECTION("separate state per thread") {
+            tgui::DrawBatcher::beginDrawing();
+            target.draw(texture1);
+
+            bool enabledInThread = true;
+            std::size_t drawCallsInThread = 1;
+            std::thread thread{[&](){
+                    enabledInThread = tgui::DrawBatcher::isEnabled();
+                    drawCallsInThread = tgui::DrawBatcher::getStats().drawCalls;
+                    tgui::DrawBatcher::flush();
+                }};
+            thread.join();
+            REQUIRE(!enabledInThread);
+            REQUIRE(drawCallsInThread == 0);
+
+            // Flushing on the other thread didn't draw the batch of this thread
+            REQUIRE(tgui::DrawBatcher::getStats().drawCalls == 0);
+            tgui::DrawBatcher::endDrawing();
+            REQUIRE(tgui::DrawBatcher::getStats().drawCalls == 1);
+        }
+
+        SECTION("widgets in gui") {
+            tgui::Gui gui{target};
+            auto picture1 = std::make_shared<tgui::Picture>("resources/image.png");
+            auto picture2 = std::make_shared<tgui::Picture>("resources/image.png");
+            picture2->setPosition(60, 40);
+            gui.add(picture1);
+            gui.add(picture2);
+
+            gui.draw();
+            REQUIRE(tgui::DrawBatcher::getStats().drawCalls == 1);
+            REQUIRE(tgui::DrawBatcher::getStats().batchedDraws == 1);
+        }
+
+        tgui::DrawBatcher::setEnabled(false);
+    }
+}
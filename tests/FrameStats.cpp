@@ -0,0 +1,119 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/DrawBatcher.hpp>
+#include <TGUI/FrameStats.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+
+#ifdef TGUI_ENABLE_FRAME_STATS
+namespace
+{
+    sf::Event createMouseButtonEvent(sf::Event::EventType type, int x, int y)
+    {
+        sf::Event event;
+        event.type = type;
+        event.mouseButton.button = sf::Mouse::Left;
+        event.mouseButton.x = x;
+        event.mouseButton.y = y;
+        return event;
+    }
+}
+#endif
+
+TEST_CASE("[FrameStats]") {
+    sf::RenderTexture target;
+    target.create(200, 100);
+    tgui::Gui gui{target};
+
+    auto picture1 = std::make_shared<tgui::Picture>("resources/image.png");
+    picture1->setSize(50, 50);
+    gui.add(picture1);
+
+    auto picture2 = std::make_shared<tgui::Picture>("resources/image.png");
+    picture2->setSize(50, 50);
+    picture2->setPosition(300, 0);
+    gui.add(picture2);
+
+    SECTION("culling") {
+        gui.draw();
+        const std::size_t drawCallsWithCulling = tgui::DrawBatcher::getStats().drawCalls;
+
+        picture2->setPosition(100, 0);
+        gui.draw();
+        REQUIRE(tgui::DrawBatcher::getStats().drawCalls > drawCallsWithCulling);
+
+        // Widgets that only touch the visible area with their edge are still drawn
+        picture2->setPosition(200, 0);
+        gui.draw();
+        REQUIRE(tgui::DrawBatcher::getStats().drawCalls > drawCallsWithCulling);
+    }
+
+#ifdef TGUI_ENABLE_FRAME_STATS
+    SECTION("collected") {
+        gui.draw();
+
+        tgui::FrameStats stats = gui.getFrameStats();
+        REQUIRE(stats.widgetsDrawn == 1);
+        REQUIRE(stats.widgetsCulled == 1);
+        REQUIRE(stats.drawCalls == 1);
+        REQUIRE(stats.vertices > 0);
+        REQUIRE(stats.textureBinds == 1);
+        REQUIRE(stats.scissorChanges >= 1);
+        REQUIRE(stats.updateCalls == 1);
+        REQUIRE(stats.signalsEmitted == 0);
+        REQUIRE(stats.updateTime <= stats.drawTime);
+
+        // Everything that happens between two draw calls belongs to the frame
+        unsigned int clickCount = 0;
+        picture1->connect("Clicked", [&]{ clickCount++; });
+        gui.handleEvent(createMouseButtonEvent(sf::Event::MouseButtonPressed, 10, 10));
+        gui.handleEvent(createMouseButtonEvent(sf::Event::MouseButtonReleased, 10, 10));
+        picture2->setPosition(tgui::bindRight(picture1), 0);
+        picture1->setSize(60, 50);
+        gui.draw();
+
+        stats = gui.getFrameStats();
+        REQUIRE(clickCount == 1);
+        REQUIRE(stats.signalsEmitted >= 1);
+        REQUIRE(stats.layoutRecalculations >= 1);
+        REQUIRE(stats.widgetsDrawn == 2);
+        REQUIRE(stats.widgetsCulled == 0);
+
+        gui.draw();
+        stats = gui.getFrameStats();
+        REQUIRE(stats.signalsEmitted == 0);
+        REQUIRE(stats.layoutRecalculations == 0);
+        REQUIRE(stats.handleEventTime == sf::Time::Zero);
+    }
+#else
+    SECTION("not collected") {
+        gui.draw();
+        REQUIRE(gui.getFrameStats().drawCalls == 0);
+        REQUIRE(gui.getFrameStats().drawTime == sf::Time::Zero);
+    }
+#endif
+}
@@ -0,0 +1,432 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Animation.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/ListBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Slider.hpp>
+#include <TGUI/Widgets/ToolTip.hpp>
+
+namespace
+{
+    // Remembers the mouse moves that it receives
+    class MoveTestWidget : public tgui::ClickableWidget
+    {
+    public:
+        virtual void mouseMoved(float x, float y) override
+        {
+            positions.push_back({x, y});
+            tgui::ClickableWidget::mouseMoved(x, y);
+        }
+
+        std::vector<sf::Vector2f> positions;
+    };
+
+    sf::Event createMouseMovedEvent(int x, int y)
+    {
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = x;
+        event.mouseMove.y = y;
+        return event;
+    }
+
+    sf::Event createMouseButtonEvent(sf::Event::EventType type, int x, int y)
+    {
+        sf::Event event;
+        event.type = type;
+        event.mouseButton.button = sf::Mouse::Left;
+        event.mouseButton.x = x;
+        event.mouseButton.y = y;
+        return event;
+    }
+
+    sf::Event createTabKeyEvent(bool shift)
+    {
+        sf::Event event;
+        event.type = sf::Event::KeyReleased;
+        event.key.code = sf::Keyboard::Tab;
+        event.key.alt = false;
+        event.key.control = false;
+        event.key.shift = shift;
+        event.key.system = false;
+        return event;
+    }
+}
+
+TEST_CASE("[Gui]") {
+    sf::RenderTexture texture;
+    texture.create(200, 200);
+    tgui::Gui gui{texture};
+
+    SECTION("handleEvents") {
+        auto widget = std::make_shared<MoveTestWidget>();
+        widget->setSize(100, 100);
+        gui.add(widget);
+
+        unsigned int clickCount = 0;
+        widget->connect("Clicked", [&]{ clickCount++; });
+
+        std::vector<sf::Event> events = {
+            createMouseMovedEvent(10, 10),
+            createMouseMovedEvent(20, 20),
+            createMouseMovedEvent(30, 30),
+            createMouseButtonEvent(sf::Event::MouseButtonPressed, 30, 30),
+            createMouseMovedEvent(40, 40),
+            createMouseMovedEvent(50, 50),
+            createMouseButtonEvent(sf::Event::MouseButtonReleased, 50, 50),
+            createMouseMovedEvent(60, 60)
+        };
+
+        std::vector<sf::Event::EventType> handledTypes;
+        REQUIRE(gui.handleEvents(events, [&](const sf::Event& event){ handledTypes.push_back(event.type); }) == 3);
+
+        // Only the last move before every other event is handled, the press and release stay in order
+        REQUIRE(handledTypes.size() == 5);
+        REQUIRE(handledTypes[0] == sf::Event::MouseMoved);
+        REQUIRE(handledTypes[1] == sf::Event::MouseButtonPressed);
+        REQUIRE(handledTypes[2] == sf::Event::MouseMoved);
+        REQUIRE(handledTypes[3] == sf::Event::MouseButtonReleased);
+        REQUIRE(handledTypes[4] == sf::Event::MouseMoved);
+
+        REQUIRE(widget->positions.size() == 3);
+        REQUIRE(widget->positions[0] == sf::Vector2f(30, 30));
+        REQUIRE(widget->positions[1] == sf::Vector2f(50, 50));
+        REQUIRE(widget->positions[2] == sf::Vector2f(60, 60));
+        REQUIRE(clickCount == 1);
+
+        REQUIRE(gui.handleEvents(std::vector<sf::Event>{}) == 0);
+    }
+
+    SECTION("focus chain") {
+        auto editBox1 = std::make_shared<tgui::EditBox>();
+        auto editBox2 = std::make_shared<tgui::EditBox>();
+        auto editBox3 = std::make_shared<tgui::EditBox>();
+        auto editBox4 = std::make_shared<tgui::EditBox>();
+        auto panel = std::make_shared<tgui::Panel>();
+        panel->add(editBox2);
+        panel->add(editBox3);
+
+        gui.add(editBox1);
+        gui.add(panel);
+        gui.add(editBox4);
+        gui.add(std::make_shared<tgui::ClickableWidget>());
+
+        // The tab key walks through the widgets inside the panel before continuing with the widgets after it
+        REQUIRE(gui.handleEvent(createTabKeyEvent(false)));
+        REQUIRE(editBox1->isFocused());
+        REQUIRE(gui.handleEvent(createTabKeyEvent(false)));
+        REQUIRE(editBox2->isFocused());
+        REQUIRE(panel->isFocused());
+        REQUIRE(!editBox1->isFocused());
+        REQUIRE(gui.handleEvent(createTabKeyEvent(false)));
+        REQUIRE(editBox3->isFocused());
+        REQUIRE(!editBox2->isFocused());
+        REQUIRE(gui.handleEvent(createTabKeyEvent(false)));
+        REQUIRE(editBox4->isFocused());
+        REQUIRE(!editBox3->isFocused());
+        REQUIRE(!panel->isFocused());
+        REQUIRE(gui.handleEvent(createTabKeyEvent(false)));
+        REQUIRE(editBox1->isFocused());
+
+        REQUIRE(gui.handleEvent(createTabKeyEvent(true)));
+        REQUIRE(editBox4->isFocused());
+        gui.focusPreviousWidget();
+        REQUIRE(editBox3->isFocused());
+
+        // Hidden containers are skipped
+        panel->hide();
+        REQUIRE(!editBox3->isFocused());
+        gui.focusNextWidget();
+        REQUIRE(editBox1->isFocused());
+        gui.focusNextWidget();
+        REQUIRE(editBox4->isFocused());
+        gui.focusNextWidget();
+        REQUIRE(editBox1->isFocused());
+
+        // Disabled widgets are skipped and the tab index goes before the order in which widgets were added
+        panel->show();
+        editBox3->disable();
+        editBox4->setTabIndex(-1);
+        gui.unfocusWidgets();
+        gui.focusNextWidget();
+        REQUIRE(editBox4->isFocused());
+        gui.focusNextWidget();
+        REQUIRE(editBox1->isFocused());
+        gui.focusNextWidget();
+        REQUIRE(editBox2->isFocused());
+        gui.focusNextWidget();
+        REQUIRE(editBox4->isFocused());
+
+        // When a container is focused then the next widget is the first one inside it
+        gui.remove(editBox1);
+        gui.focusWidget(panel);
+        REQUIRE(!editBox4->isFocused());
+        gui.focusNextWidget();
+        REQUIRE(editBox2->isFocused());
+        gui.focusNextWidget();
+        REQUIRE(editBox4->isFocused());
+
+        // Nothing changes when the focused widget is the only one that can be focused
+        editBox2->disable();
+        REQUIRE(!gui.handleEvent(createTabKeyEvent(false)));
+        REQUIRE(editBox4->isFocused());
+    }
+
+    SECTION("partial redraw") {
+        sf::RenderTexture target;
+        target.create(200, 200);
+        tgui::Gui gui{target};
+
+        auto editBox = std::make_shared<tgui::EditBox>();
+        editBox->setSize(100, 20);
+        gui.add(editBox);
+
+        REQUIRE(!gui.isPartialRedrawEnabled());
+        REQUIRE(gui.isDirty());
+        gui.draw();
+        REQUIRE(!gui.isDirty());
+
+        gui.setPartialRedrawEnabled(true);
+        REQUIRE(gui.isPartialRedrawEnabled());
+        REQUIRE(gui.isDirty());
+        gui.draw();
+        REQUIRE(!gui.isDirty());
+
+        editBox->setPosition(50, 50);
+        REQUIRE(gui.isDirty());
+        gui.draw();
+        REQUIRE(!gui.isDirty());
+
+        // The caret only makes the gui dirty when it appears or disappears
+        editBox->focus();
+        gui.draw();
+        gui.updateTime(sf::milliseconds(100));
+        REQUIRE(!gui.isDirty());
+        gui.updateTime(sf::milliseconds(500));
+        REQUIRE(gui.isDirty());
+        gui.draw();
+        REQUIRE(!gui.isDirty());
+
+        editBox->setText("Text");
+        REQUIRE(gui.isDirty());
+        gui.draw();
+
+        editBox->getRenderer()->setTextColor(sf::Color::Red);
+        REQUIRE(gui.isDirty());
+        gui.draw();
+
+        auto listBox = std::make_shared<tgui::ListBox>();
+        gui.add(listBox);
+        gui.draw();
+        REQUIRE(!gui.isDirty());
+        listBox->addItem("Item");
+        REQUIRE(gui.isDirty());
+        gui.draw();
+
+        auto slider = std::make_shared<tgui::Slider>();
+        gui.add(slider);
+        gui.draw();
+        slider->setValue(slider->getMaximum());
+        REQUIRE(gui.isDirty());
+        gui.draw();
+
+        editBox->hide();
+        REQUIRE(gui.isDirty());
+        gui.draw();
+
+        // Changing the view requires drawing everything again
+        gui.setView(sf::View{{0, 0, 100, 100}});
+        REQUIRE(gui.isDirty());
+        gui.draw();
+        REQUIRE(!gui.isDirty());
+
+        gui.setPartialRedrawEnabled(false);
+        gui.draw();
+        REQUIRE(!gui.isDirty());
+    }
+
+    SECTION("mouse moves") {
+        sf::RenderTexture target;
+        target.create(200, 200);
+        tgui::Gui gui{target};
+        gui.setPartialRedrawEnabled(true);
+
+        auto button = std::make_shared<tgui::Button>();
+        button->setPosition(0, 0);
+        button->setSize(100, 40);
+        gui.add(button);
+
+        auto listBox = std::make_shared<tgui::ListBox>();
+        listBox->setPosition(0, 100);
+        listBox->setSize(100, 100);
+        listBox->setItemHeight(20);
+        listBox->addItem("Item 1");
+        listBox->addItem("Item 2");
+        gui.add(listBox);
+        gui.draw();
+
+        // Entering the button changes how it looks, moving on top of it doesn't
+        gui.handleEvent(createMouseMovedEvent(10, 10));
+        REQUIRE(gui.isDirty());
+        gui.draw();
+        gui.handleEvent(createMouseMovedEvent(20, 15));
+        gui.handleEvent(createMouseMovedEvent(50, 30));
+        REQUIRE(!gui.isDirty());
+
+        gui.handleEvent(createMouseMovedEvent(10, 105));
+        REQUIRE(gui.isDirty());
+        gui.draw();
+
+        // Only moving to another item changes the list box
+        gui.handleEvent(createMouseMovedEvent(20, 110));
+        gui.handleEvent(createMouseMovedEvent(30, 115));
+        REQUIRE(!gui.isDirty());
+        gui.handleEvent(createMouseMovedEvent(30, 125));
+        REQUIRE(gui.isDirty());
+        gui.draw();
+
+        // Pressing the button does change it
+        gui.handleEvent(createMouseMovedEvent(10, 10));
+        gui.draw();
+        gui.handleEvent(createMouseButtonEvent(sf::Event::MouseButtonPressed, 10, 10));
+        REQUIRE(gui.isDirty());
+        gui.draw();
+        gui.handleEvent(createMouseMovedEvent(20, 20));
+        REQUIRE(!gui.isDirty());
+        gui.handleEvent(createMouseButtonEvent(sf::Event::MouseButtonReleased, 20, 20));
+        REQUIRE(gui.isDirty());
+    }
+
+    SECTION("idle detection") {
+        sf::RenderTexture target;
+        target.create(200, 200);
+        tgui::Gui gui{target};
+
+        auto editBox = std::make_shared<tgui::EditBox>();
+        editBox->setSize(100, 20);
+        gui.add(editBox);
+
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+        REQUIRE(!gui.needsRedraw());
+        REQUIRE(gui.timeUntilNextUpdate() > sf::seconds(3600));
+
+        // The blinking caret has to be drawn again every half second
+        editBox->focus();
+        gui.draw();
+        REQUIRE(gui.timeUntilNextUpdate() <= sf::milliseconds(500));
+        gui.updateTime(sf::milliseconds(400));
+        REQUIRE(!gui.needsRedraw());
+        REQUIRE(gui.timeUntilNextUpdate() <= sf::milliseconds(100));
+        gui.updateTime(sf::milliseconds(100));
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+        REQUIRE(gui.timeUntilNextUpdate() > sf::milliseconds(400));
+
+        editBox->unfocus();
+        gui.draw();
+        REQUIRE(!gui.needsRedraw());
+        REQUIRE(gui.timeUntilNextUpdate() > sf::seconds(3600));
+
+        // Running animations change the gui every frame
+        editBox->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(100));
+        gui.draw();
+        REQUIRE(gui.needsRedraw());
+        REQUIRE(gui.timeUntilNextUpdate() == sf::Time::Zero);
+        gui.updateTime(sf::milliseconds(200));
+        gui.draw();
+        REQUIRE(!gui.needsRedraw());
+
+        // The tool tip appears after the mouse stayed on the widget for a while
+        auto toolTip = std::make_shared<tgui::Label>();
+        toolTip->setText("Tool tip");
+        editBox->setToolTip(toolTip);
+        gui.handleEvent(createMouseMovedEvent(10, 10));
+        gui.draw();
+        REQUIRE(!gui.needsRedraw());
+        REQUIRE(gui.timeUntilNextUpdate() <= tgui::ToolTip::getTimeToDisplay());
+        gui.updateTime(tgui::ToolTip::getTimeToDisplay());
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+        REQUIRE(gui.timeUntilNextUpdate() > sf::seconds(3600));
+
+        // Posted tasks and deferred layouts are handled when drawing
+        gui.post([]{});
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+        REQUIRE(!gui.needsRedraw());
+
+        gui.setLayoutUpdatesDeferred(true);
+        auto otherWidget = std::make_shared<tgui::EditBox>();
+        gui.add(otherWidget);
+        otherWidget->setPosition(tgui::bindRight(editBox), 0);
+        gui.draw();
+        REQUIRE(!gui.needsRedraw());
+        editBox->setPosition(60, 0);
+        REQUIRE(gui.timeUntilNextUpdate() == sf::Time::Zero);
+        gui.draw();
+        REQUIRE(!gui.needsRedraw());
+        REQUIRE(otherWidget->getPosition().x == 160);
+        gui.setLayoutUpdatesDeferred(false);
+    }
+
+    SECTION("double click time") {
+        sf::RenderTexture target;
+        target.create(200, 200);
+        tgui::Gui gui{target};
+
+        auto label = std::make_shared<tgui::Label>();
+        label->setText("Text");
+        label->setPosition(0, 0);
+        label->setSize(100, 20);
+        gui.add(label);
+        gui.draw();
+
+        unsigned int doubleClickCount = 0;
+        label->connect("DoubleClicked", [&]{ doubleClickCount++; });
+
+        // The gui has to wake up when the time for the second click runs out
+        gui.handleEvent(createMouseButtonEvent(sf::Event::MouseButtonPressed, 10, 10));
+        gui.handleEvent(createMouseButtonEvent(sf::Event::MouseButtonReleased, 10, 10));
+        REQUIRE(gui.timeUntilNextUpdate() <= sf::milliseconds(500));
+
+        // A second click that comes too late isn't a double click, even when no frame was drawn in between
+        sf::sleep(sf::milliseconds(600));
+        gui.handleEvent(createMouseButtonEvent(sf::Event::MouseButtonPressed, 10, 10));
+        gui.handleEvent(createMouseButtonEvent(sf::Event::MouseButtonReleased, 10, 10));
+        REQUIRE(doubleClickCount == 0);
+
+        gui.handleEvent(createMouseButtonEvent(sf::Event::MouseButtonPressed, 10, 10));
+        gui.handleEvent(createMouseButtonEvent(sf::Event::MouseButtonReleased, 10, 10));
+        REQUIRE(doubleClickCount == 1);
+    }
+}
@@ -245,6 +245,38 @@ TEST_CASE("[Layouts]") {
             REQUIRE(button3->getPosition() == sf::Vector2f(60, 75));
             button1->setPosition(60, 75);
             REQUIRE(button3->getPosition() == sf::Vector2f(90, 112.5f));
+
+            // Identical expressions share the same layout
+            auto quarterWidth1 = bindWidth(panel) * 0.25f;
+            auto quarterWidth2 = bindWidth(panel) * 0.25f;
+            auto halfWidth = bindWidth(panel) * 0.5f;
+            REQUIRE(bindWidth(panel).getImpl() == bindWidth(panel).getImpl());
+            REQUIRE(bindWidth(panel).getImpl() != bindHeight(panel).getImpl());
+            REQUIRE(quarterWidth1.getImpl() == quarterWidth2.getImpl());
+            REQUIRE(quarterWidth1.getImpl() != halfWidth.getImpl());
+            REQUIRE(bindWidth(button1).getImpl() != bindWidth(button2).getImpl());
+
+            button1->setSize(quarterWidth1, bindHeight(panel));
+            button2->setSize(quarterWidth2, bindHeight(panel) * 0.25f);
+            panel->setSize(400, 100);
+            REQUIRE(quarterWidth1.getValue() == 100);
+            REQUIRE(halfWidth.getValue() == 200);
+            REQUIRE(button1->getSize() == sf::Vector2f(100, 100));
+            REQUIRE(button2->getSize() == sf::Vector2f(100, 25));
+
+            // Layouts can outlive the widget that they are bound to and the other way around
+            auto button4 = std::make_shared<tgui::Button>();
+            button4->setSize(50, 40);
+            auto layout = std::make_shared<Layout>(bindWidth(button4) + bindStr("parent.height"));
+            REQUIRE(layout->getValue() == 50);
+            button4->setSize(60, 40);
+            REQUIRE(layout->getValue() == 60);
+            layout = nullptr;
+            button4->setSize(70, 40);
+
+            Layout width = bindWidth(button4);
+            button4 = nullptr;
+            REQUIRE(width.getValue() == 70);
         }
     }
 
@@ -487,6 +519,39 @@ TEST_CASE("[Layouts]") {
             button3->setSize({"then.size"});
             REQUIRE(button3->getSize() == sf::Vector2f(200, 50));
 
+            auto button5 = std::make_shared<tgui::Button>();
+            button5->setSize({"max(b6.w, 10) + min(range(0, 100, b1.h), 20)"}, 20);
+            REQUIRE(button5->getSize().x == 10);
+            panel->add(button5);
+            REQUIRE(button5->getSize().x == 30);
+
+            auto button6 = std::make_shared<tgui::Button>();
+            button6->setSize(60, 20);
+            panel->add(button6, "b6");
+            button1->setSize(300, 15);
+            REQUIRE(button5->getSize().x == 75);
+
+            // Layouts that depend on the same widget are updated in the order in which they were bound
+            std::vector<tgui::Button::Ptr> dependents;
+            std::vector<unsigned int> updateOrder;
+            for (unsigned int i = 0; i < 8; ++i)
+            {
+                auto dependent = std::make_shared<tgui::Button>();
+                panel->add(dependent);
+                dependent->setPosition({"b6.width + " + tgui::to_string(i)}, 0);
+                dependent->connect("PositionChanged", [&updateOrder, i]{ updateOrder.push_back(i); });
+                dependents.push_back(dependent);
+            }
+
+            // Destroy half of the layouts so that the list of dependencies gets compacted
+            for (unsigned int i = 0; i < 8; i += 2)
+                dependents[i]->setPosition(0, 0);
+
+            updateOrder.clear();
+            button6->setSize(100, 20);
+            REQUIRE(updateOrder == std::vector<unsigned int>({1, 3, 5, 7}));
+            REQUIRE(dependents[7]->getPosition() == sf::Vector2f(107, 0));
+
             SECTION("Gui") {
                 sf::RenderTexture texture;
                 texture.create(20, 15);
@@ -534,6 +599,37 @@ TEST_CASE("[Layouts]") {
         }
     }
 
+    SECTION("Deferred updates") {
+        sf::RenderTexture texture;
+        texture.create(20, 15);
+        tgui::Gui gui{texture};
+        gui.setLayoutUpdatesDeferred(true);
+        REQUIRE(gui.getLayoutUpdatesDeferred());
+
+        auto panel = std::make_shared<tgui::Panel>();
+        panel->setSize(200, 100);
+        gui.add(panel);
+
+        auto button = std::make_shared<tgui::Button>();
+        button->setSize(bindWidth(panel) / 2, {"parent.height - 10"});
+        panel->add(button);
+        REQUIRE(button->getSize() == sf::Vector2f(100, 90));
+
+        panel->setSize(400, 300);
+        REQUIRE(button->getSize() == sf::Vector2f(100, 90));
+
+        gui.flushLayouts();
+        REQUIRE(button->getSize() == sf::Vector2f(200, 290));
+
+        panel->setSize(300, 200);
+        gui.setLayoutUpdatesDeferred(false);
+        REQUIRE(!gui.getLayoutUpdatesDeferred());
+        REQUIRE(button->getSize() == sf::Vector2f(150, 190));
+
+        panel->setSize(100, 50);
+        REQUIRE(button->getSize() == sf::Vector2f(50, 40));
+    }
+
     SECTION("Bug Fixes") {
         SECTION("Setting negative size and reverting back to positive (https://github.com/texus/TGUI/issues/54)") {
             tgui::Panel::Ptr panel = std::make_shared<tgui::Panel>();
@@ -71,7 +71,7 @@ TEST_CASE("[Theme]") {
             REQUIRE(tgui::ThemeTest::getWidgets(theme).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).begin()->first == "button");
-            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).begin()->second == "button");
+            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).begin()->second == tgui::WidgetTypes::Button);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme).empty());
 
             button = nullptr;
@@ -90,7 +90,7 @@ TEST_CASE("[Theme]") {
             REQUIRE(tgui::ThemeTest::getWidgets(theme).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).begin()->first == "button");
-            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).begin()->second == "button");
+            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).begin()->second == tgui::WidgetTypes::Button);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme).begin()->first == "button");
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme).begin()->second.size() > 0);
@@ -145,7 +145,7 @@ TEST_CASE("[Theme]") {
             REQUIRE(tgui::ThemeTest::getWidgets(theme1).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme1).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme1).begin()->first == "button1");
-            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme1).begin()->second == "button");
+            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme1).begin()->second == tgui::WidgetTypes::Button);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme1).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme1).begin()->first == "button1");
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme1).begin()->second.size() == 1);
@@ -162,7 +162,7 @@ TEST_CASE("[Theme]") {
             REQUIRE(tgui::ThemeTest::getWidgets(theme1).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme1).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme1).begin()->first == "button1");
-            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme1).begin()->second == "button");
+            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme1).begin()->second == tgui::WidgetTypes::Button);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme1).size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme1).begin()->first == "button1");
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme1).begin()->second.size() == 1);
@@ -193,9 +193,9 @@ TEST_CASE("[Theme]") {
             REQUIRE(tgui::ThemeTest::getWidgets(theme)[button2.get()] == "button2");
             REQUIRE(tgui::ThemeTest::getWidgets(theme)[button3.get()] == "button3");
             REQUIRE(tgui::ThemeTest::getWidgetTypes(theme).size() == 3);
-            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme)["button1"] == "button");
-            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme)["button2"] == "button");
-            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme)["button3"] == "button");
+            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme)["button1"] == tgui::WidgetTypes::Button);
+            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme)["button2"] == tgui::WidgetTypes::Button);
+            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme)["button3"] == tgui::WidgetTypes::Button);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme).size() == 3);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme)["button1"].size() == 1);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme)["button2"].size() == 1);
@@ -212,7 +212,7 @@ TEST_CASE("[Theme]") {
             REQUIRE(tgui::ThemeTest::getWidgets(theme)[button1.get()] == "button2");
             REQUIRE(tgui::ThemeTest::getWidgets(theme)[button2.get()] == "button2");
             REQUIRE(tgui::ThemeTest::getWidgets(theme)[button3.get()] == "button3");
-            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme)["button1"] == "button");
+            REQUIRE(tgui::ThemeTest::getWidgetTypes(theme)["button1"] == tgui::WidgetTypes::Button);
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme)["button1"]["textcolor"] == "rgb(255, 0, 0)");
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme)["button2"]["textcolor"] == "rgb(0, 255, 0)");
             REQUIRE(button1->getRenderer()->getProperty("TextColor").getColor() == sf::Color(0, 255, 0));
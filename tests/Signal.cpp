@@ -24,6 +24,34 @@
 
 #include "Tests.hpp"
 #include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+#include <thread>
+
+namespace
+{
+    // Custom widget that still adds its signal by name
+    class NamedSignalWidget : public tgui::ClickableWidget
+    {
+    public:
+        NamedSignalWidget()
+        {
+            addSignal<int>("Custom");
+        }
+
+        void sendCustom(int value)
+        {
+            sendSignal("Custom", value);
+        }
+
+        bool isCustomBound()
+        {
+            return isSignalBound("Custom");
+        }
+    };
+}
 
 TEST_CASE("[Signal]") {
     tgui::Widget::Ptr widget = std::make_shared<tgui::Button>();
@@ -96,4 +124,253 @@ TEST_CASE("[Signal]") {
         widget->setSize(200, 50);
         REQUIRE(i == 2);
     }
+
+    SECTION("parameters") {
+        sf::Vector2f position;
+        widget->connect("positionchanged", [&](sf::Vector2f pos){ position = pos; });
+        widget->setPosition(10, 20);
+        REQUIRE(position == sf::Vector2f(10, 20));
+
+        auto checkBox = std::make_shared<tgui::CheckBox>();
+        int checked = -1;
+        checkBox->connect("Checked Unchecked", [&](int value){ checked = value; });
+        checkBox->check();
+        REQUIRE(checked == 1);
+        checkBox->uncheck();
+        REQUIRE(checked == 0);
+    }
+
+    SECTION("connect and disconnect while sending") {
+        unsigned int calls = 0;
+        unsigned int addedCalls = 0;
+        unsigned int id = 0;
+        id = widget->connect("PositionChanged", [&](){
+                calls++;
+                widget->disconnect(id);
+                widget->connect("PositionChanged", [&](){ addedCalls++; });
+            });
+        widget->connect("PositionChanged", [&](){ calls++; });
+
+        // The function that was connected while sending is only called the next time
+        widget->setPosition(10, 10);
+        REQUIRE(calls == 2);
+        REQUIRE(addedCalls == 0);
+
+        widget->setPosition(20, 20);
+        REQUIRE(calls == 3);
+        REQUIRE(addedCalls == 1);
+
+        unsigned int sizeCalls = 0;
+        widget->connect("SizeChanged", [&](){ sizeCalls++; widget->disconnectAll("SizeChanged"); });
+        widget->connect("SizeChanged", [&](){ sizeCalls++; });
+        widget->setSize(100, 25);
+        REQUIRE(sizeCalls == 1);
+        widget->setSize(200, 50);
+        REQUIRE(sizeCalls == 1);
+    }
+
+    SECTION("handler throws while sending") {
+        auto button = std::make_shared<tgui::Button>();
+
+        bool throwException = true;
+        unsigned int calls = 0;
+        unsigned int id = button->connect("PositionChanged", [&](){
+                calls++;
+                if (throwException)
+                    throw tgui::Exception{"Exception thrown by handler"};
+            });
+
+        REQUIRE_THROWS_AS(button->setPosition(10, 10), tgui::Exception);
+        REQUIRE(calls == 1);
+
+        // The signal is no longer sending after the exception, so it still works normally
+        throwException = false;
+        button->setPosition(20, 20);
+        REQUIRE(calls == 2);
+
+        button->disconnect(id);
+        button->setPosition(30, 30);
+        REQUIRE(calls == 2);
+
+        button->connect("PositionChanged", [&](){ calls++; throw tgui::Exception{"Exception thrown by handler"}; });
+        REQUIRE_THROWS_AS(button->setPosition(40, 40), tgui::Exception);
+        REQUIRE(calls == 3);
+
+        button->disconnectAll("PositionChanged");
+        button->setPosition(50, 50);
+        REQUIRE(calls == 3);
+
+        button->connect("PositionChanged", [&](){ calls++; throw tgui::Exception{"Exception thrown by handler"}; });
+        REQUIRE_THROWS_AS(button->setPosition(60, 60), tgui::Exception);
+        REQUIRE(calls == 4);
+        button = nullptr;
+    }
+
+    SECTION("storage") {
+        tgui::TypedSignal<> signal{"Test"};
+        std::atomic<unsigned int> idCounter{1};
+        tgui::Callback callback;
+
+        // Nothing is stored until a function gets connected
+        REQUIRE(signal.isEmpty());
+        REQUIRE(!signal.isBound());
+        signal.send(callback);
+
+        unsigned int calls = 0;
+        unsigned int id = signal.connect(idCounter, [&](){ calls++; });
+        REQUIRE(!signal.isEmpty());
+        REQUIRE(signal.isBound());
+        signal.send(callback);
+        REQUIRE(calls == 1);
+
+        // The storage is released again when the last function is disconnected
+        REQUIRE(signal.disconnect(id));
+        REQUIRE(signal.isEmpty());
+        REQUIRE(!signal.isBound());
+        REQUIRE(!signal.disconnect(id));
+        signal.send(callback);
+        REQUIRE(calls == 1);
+
+        // Functions that take the callback are bound, but don't make the signal non-empty
+        signal.connectEx(idCounter, [](const tgui::Callback&){});
+        signal.connect(idCounter, [&](){ calls++; });
+        REQUIRE(!signal.isEmpty());
+        REQUIRE(signal.isBound());
+        signal.disconnectAll();
+        REQUIRE(signal.isEmpty());
+        REQUIRE(!signal.isBound());
+        signal.send(callback);
+        REQUIRE(calls == 1);
+
+        // A function that replaces itself while sending keeps the storage alive for the new function
+        unsigned int addedCalls = 0;
+        id = signal.connect(idCounter, [&](){
+                calls++;
+                signal.disconnect(id);
+                REQUIRE(!signal.isBound());
+                signal.connect(idCounter, [&](){ addedCalls++; });
+                REQUIRE(signal.isBound());
+            });
+        signal.send(callback);
+        REQUIRE(calls == 2);
+        REQUIRE(addedCalls == 0);
+        REQUIRE(signal.isBound());
+        signal.send(callback);
+        REQUIRE(calls == 2);
+        REQUIRE(addedCalls == 1);
+
+        signal.disconnectAll();
+        REQUIRE(!signal.isBound());
+
+        // A function can also be connected while sending after all functions were disconnected
+        signal.connect(idCounter, [&](){
+                calls++;
+                signal.disconnectAll();
+                signal.connect(idCounter, [&](){ addedCalls++; });
+            });
+        signal.send(callback);
+        REQUIRE(calls == 3);
+        REQUIRE(addedCalls == 1);
+        signal.send(callback);
+        REQUIRE(calls == 3);
+        REQUIRE(addedCalls == 2);
+    }
+
+    SECTION("widget destroyed while sending") {
+        auto clickableWidget = std::make_shared<tgui::ClickableWidget>();
+        std::weak_ptr<tgui::ClickableWidget> weakWidget = clickableWidget;
+
+        unsigned int calls = 0;
+        clickableWidget->connectEx("Clicked", [](const tgui::Callback&){});
+        clickableWidget->connect("Clicked", [&](){ calls++; clickableWidget = nullptr; });
+        clickableWidget->connect("Clicked", [&](){ calls++; });
+
+        // The remaining functions are no longer called once the widget no longer exists
+        auto widgetPtr = clickableWidget.get();
+        widgetPtr->leftMousePressed(0, 0);
+        widgetPtr->leftMouseReleased(0, 0);
+        REQUIRE(weakWidget.expired());
+        REQUIRE(calls == 1);
+
+        // The function that removed its own widget can still use its captures
+        auto panel = std::make_shared<tgui::Panel>();
+        auto ownWidget = std::make_shared<tgui::ClickableWidget>();
+        panel->add(ownWidget);
+        weakWidget = ownWidget;
+
+        const std::string captured = "captured by value";
+        std::string received;
+        tgui::ClickableWidget* ownWidgetPtr = ownWidget.get();
+        ownWidget->connect("Clicked", [panel, ownWidgetPtr, captured, &received](){
+            panel->remove(ownWidgetPtr->shared_from_this());
+            received = captured;
+        });
+
+        ownWidget = nullptr;
+        ownWidgetPtr->leftMousePressed(0, 0);
+        ownWidgetPtr->leftMouseReleased(0, 0);
+        REQUIRE(weakWidget.expired());
+        REQUIRE(received == "captured by value");
+    }
+
+    SECTION("signal added by name") {
+        auto customWidget = std::make_shared<NamedSignalWidget>();
+        REQUIRE(!customWidget->isCustomBound());
+
+        int received = 0;
+        unsigned int calls = 0;
+        customWidget->connect("Custom", [&](int value){ received = value; });
+        customWidget->connect("custom", [&](){ calls++; });
+        REQUIRE_THROWS_AS(customWidget->connect("Custom", [](bool){}), tgui::Exception);
+        REQUIRE(customWidget->isCustomBound());
+
+        customWidget->sendCustom(5);
+        REQUIRE(received == 5);
+        REQUIRE(calls == 1);
+
+        // The signal is part of the signals of the widget
+        customWidget->connect("All", [&](){ calls++; });
+        customWidget->sendCustom(6);
+        REQUIRE(calls == 3);
+
+        // A copy keeps the signal and its handlers
+        auto copiedWidget = std::make_shared<NamedSignalWidget>(*customWidget);
+        customWidget = nullptr;
+        copiedWidget->sendCustom(7);
+        REQUIRE(received == 7);
+        REQUIRE(calls == 5);
+
+        copiedWidget->disconnectAll();
+        REQUIRE(!copiedWidget->isCustomBound());
+        copiedWidget->sendCustom(8);
+        REQUIRE(received == 7);
+        REQUIRE(calls == 5);
+    }
+
+    SECTION("send from multiple threads") {
+        // Every thread uses its own widgets, the arguments of one thread may not end up in the handlers of the other thread
+        auto sendSignals = [](float offset, bool& correct){
+                auto button = std::make_shared<tgui::Button>();
+                auto panel = std::make_shared<tgui::Panel>();
+                panel->add(button);
+                button->setSize(tgui::bindWidth(panel) / 2, 20);
+
+                float received = 0;
+                button->connect("SizeChanged", [&](sf::Vector2f size){ received = size.x; });
+                for (unsigned int i = 0; i < 2000; ++i)
+                {
+                    panel->setSize(offset + i, 100);
+                    correct = correct && (received == (offset + i) / 2);
+                }
+            };
+
+        bool correct1 = true;
+        bool correct2 = true;
+        std::thread thread1{sendSignals, 0.f, std::ref(correct1)};
+        std::thread thread2{sendSignals, 10000.f, std::ref(correct2)};
+        thread1.join();
+        thread2.join();
+        REQUIRE(correct1);
+        REQUIRE(correct2);
+    }
 }
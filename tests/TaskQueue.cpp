@@ -0,0 +1,129 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/TaskQueue.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Label.hpp>
+
+#include <thread>
+
+TEST_CASE("[TaskQueue]") {
+    tgui::TaskQueue queue;
+    REQUIRE(queue.executeTasks(100) == 0);
+    REQUIRE(queue.getStats().queuedTasks == 0);
+
+    SECTION("order") {
+        std::vector<int> executed;
+        for (int i = 0; i < 5; ++i)
+            queue.post([&executed, i](){ executed.push_back(i); });
+
+        REQUIRE(queue.getStats().queuedTasks == 5);
+        REQUIRE(queue.executeTasks(3) == 3);
+        REQUIRE(executed == std::vector<int>({0, 1, 2}));
+        REQUIRE(queue.getStats().queuedTasks == 2);
+        REQUIRE(queue.getStats().lastExecutedTasks == 3);
+
+        REQUIRE(queue.executeTasks(100) == 2);
+        REQUIRE(executed == std::vector<int>({0, 1, 2, 3, 4}));
+        REQUIRE(queue.getStats().peakQueuedTasks == 5);
+        REQUIRE(queue.getStats().totalExecutedTasks == 5u);
+    }
+
+    SECTION("posting while executing") {
+        unsigned int count = 0;
+        std::function<void()> task = [&](){ count++; queue.post(task); };
+        queue.post(task);
+
+        // The task that gets posted by the task itself is only executed during the next call
+        REQUIRE(queue.executeTasks(100) == 1);
+        REQUIRE(count == 1);
+        REQUIRE(queue.executeTasks(100) == 1);
+        REQUIRE(count == 2);
+    }
+
+    SECTION("multiple threads") {
+        const std::size_t threadCount = 4;
+        const std::size_t tasksPerThread = 10000;
+
+        std::vector<std::vector<std::size_t>> executed(threadCount);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&queue, &executed, t, tasksPerThread](){
+                for (std::size_t i = 0; i < tasksPerThread; ++i)
+                    queue.post([&executed, t, i](){ executed[t].push_back(i); });
+            });
+        }
+
+        // Execute tasks while they are still being posted
+        std::size_t executedTasks = 0;
+        while (executedTasks < threadCount * tasksPerThread)
+            executedTasks += queue.executeTasks(1000);
+
+        for (auto& thread : threads)
+            thread.join();
+
+        REQUIRE(queue.executeTasks(1000) == 0);
+
+        // The tasks of each thread are executed in the order in which that thread posted them
+        for (auto& tasks : executed)
+        {
+            REQUIRE(tasks.size() == tasksPerThread);
+
+            bool inOrder = true;
+            for (std::size_t i = 0; i < tasks.size(); ++i)
+                inOrder = inOrder && (tasks[i] == i);
+
+            REQUIRE(inOrder);
+        }
+    }
+
+    SECTION("gui") {
+        tgui::Gui gui;
+        auto label = std::make_shared<tgui::Label>();
+        gui.add(label);
+
+        std::thread thread([&](){
+            gui.post(label, [](tgui::Label& l){ l.setText("Done"); });
+        });
+        thread.join();
+        REQUIRE(label->getText() == "");
+
+        gui.setMaxTasksPerUpdate(10);
+        REQUIRE(gui.getMaxTasksPerUpdate() == 10);
+        gui.executePostedTasks();
+        REQUIRE(label->getText() == "Done");
+
+        // The widget is not kept alive by the task
+        std::weak_ptr<tgui::Label> weakLabel = label;
+        gui.post(label, [](tgui::Label& l){ l.setText("Destroyed"); });
+        gui.removeAllWidgets();
+        label = nullptr;
+        REQUIRE(weakLabel.expired());
+        gui.executePostedTasks();
+        REQUIRE(gui.getTaskQueueStats().lastExecutedTasks == 1);
+    }
+}
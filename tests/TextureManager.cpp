@@ -46,4 +46,45 @@ TEST_CASE("[TextureManager]") {
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(texture1.getData()));
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(texture1.getData()));
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(texture1.getData()), tgui::Exception);
+
+    SECTION("atlas") {
+        REQUIRE(!tgui::TextureManager::isAtlasEnabled());
+        tgui::TextureManager::setAtlasEnabled(true);
+        REQUIRE(tgui::TextureManager::isAtlasEnabled());
+
+        {
+            tgui::Texture part1{"resources/image.png", {0, 0, 20, 10}};
+            tgui::Texture part2{"resources/image.png", {20, 10, 30, 20}};
+            REQUIRE(part1.getData() != part2.getData());
+            REQUIRE(part1.getData()->atlasTexture != nullptr);
+            REQUIRE(part1.getData()->atlasTexture == part2.getData()->atlasTexture);
+            REQUIRE(part1.getImageSize() == sf::Vector2f(20, 10));
+            REQUIRE(part2.getImageSize() == sf::Vector2f(30, 20));
+
+            auto stats = tgui::TextureManager::getAtlasStats();
+            REQUIRE(stats.pages == 1);
+            REQUIRE(stats.images == 2);
+            REQUIRE(stats.usedPixels == 22 * 12 + 32 * 22);
+            REQUIRE(stats.totalPixels >= stats.usedPixels);
+
+            // The image is surrounded by a copy of its edge
+            const sf::Image page = part2.getData()->atlasTexture->copyToImage();
+            const sf::IntRect rect = part2.getData()->atlasRect;
+            REQUIRE(page.getPixel(rect.left, rect.top) == part2.getData()->image->getPixel(20, 10));
+            REQUIRE(page.getPixel(rect.left - 1, rect.top - 1) == part2.getData()->image->getPixel(20, 10));
+            REQUIRE(page.getPixel(rect.left + rect.width, rect.top + rect.height - 1) == part2.getData()->image->getPixel(49, 29));
+
+            // Smoothing is not possible in the atlas
+            part1.setSize({40, 20});
+            part1.setSmooth(true);
+            REQUIRE(part1.isSmooth());
+            REQUIRE(part1.getData()->atlasTexture == nullptr);
+            REQUIRE(part1.getImageSize() == sf::Vector2f(20, 10));
+            REQUIRE(part1.getSize() == sf::Vector2f(40, 20));
+            REQUIRE(tgui::TextureManager::getAtlasStats().images == 1);
+        }
+
+        REQUIRE(tgui::TextureManager::getAtlasStats().pages == 0);
+        tgui::TextureManager::setAtlasEnabled(false);
+    }
 }
@@ -25,6 +25,18 @@
 #include "Tests.hpp"
 #include <TGUI/TGUI.hpp>
 
+namespace
+{
+    // Custom widget that changes the name of its type without calling setWidgetType
+    struct RenamedButton : public tgui::Button
+    {
+        RenamedButton()
+        {
+            m_callback.widgetType = "RenamedButton";
+        }
+    };
+}
+
 TEST_CASE("[Widget]") {
     tgui::Widget::Ptr widget = std::make_shared<tgui::Button>();
 
@@ -36,6 +48,37 @@ TEST_CASE("[Widget]") {
         REQUIRE(widget->isVisible());
     }
 
+    SECTION("WidgetType") {
+        REQUIRE(widget->getWidgetType() == "Button");
+        REQUIRE(widget->getWidgetTypeId() == tgui::WidgetTypes::Button);
+        REQUIRE(std::make_shared<tgui::Button>(*std::static_pointer_cast<tgui::Button>(widget))->getWidgetTypeId() == tgui::WidgetTypes::Button);
+
+        REQUIRE(tgui::WidgetTypes::getId("button") == tgui::WidgetTypes::Button);
+        REQUIRE(tgui::WidgetTypes::getName(tgui::WidgetTypes::Button) == "Button");
+        REQUIRE(tgui::WidgetTypes::getName(123456) == "Unknown");
+
+        auto customTypeId = tgui::WidgetTypes::getId("CustomWidget");
+        REQUIRE(customTypeId > tgui::WidgetTypes::VerticalLayout);
+        REQUIRE(tgui::WidgetTypes::getId("customwidget") == customTypeId);
+        REQUIRE(tgui::WidgetTypes::getName(customTypeId) == "CustomWidget");
+
+        // The save function of a renamed widget is found by its name instead of the id of its base class
+        unsigned int saveCount = 0;
+        tgui::WidgetSaver::setSaveFunction("RenamedButton", [&](tgui::WidgetConverter renamedButton){
+                saveCount++;
+                return tgui::WidgetSaver::getSaveFunction(tgui::WidgetTypes::Button)(renamedButton);
+            });
+
+        auto panel = std::make_shared<tgui::Panel>();
+        panel->add(std::make_shared<RenamedButton>());
+        panel->add(std::make_shared<tgui::Button>());
+        std::stringstream stream;
+        tgui::WidgetSaver::save(panel, stream);
+        REQUIRE(saveCount == 1);
+
+        tgui::WidgetSaver::setSaveFunction("RenamedButton", nullptr);
+    }
+
     SECTION("Enabled") {
         REQUIRE(widget->isEnabled());
         widget->disable();
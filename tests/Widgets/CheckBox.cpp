@@ -39,6 +39,7 @@ TEST_CASE("[CheckBox]") {
 
     SECTION("WidgetType") {
         REQUIRE(checkBox->getWidgetType() == "CheckBox");
+        REQUIRE(checkBox->getWidgetTypeId() == tgui::WidgetTypes::CheckBox);
     }
 
     SECTION("Checked") {
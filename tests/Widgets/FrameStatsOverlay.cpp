@@ -0,0 +1,70 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "../Tests.hpp"
+#include <TGUI/Widgets/FrameStatsOverlay.hpp>
+
+TEST_CASE("[FrameStatsOverlay]") {
+    tgui::FrameStatsOverlay::Ptr overlay = std::make_shared<tgui::FrameStatsOverlay>();
+    overlay->setFont("resources/DroidSansArmenian.ttf");
+
+    SECTION("WidgetType") {
+        REQUIRE(overlay->getWidgetType() == "FrameStatsOverlay");
+        REQUIRE(overlay->getWidgetTypeId() == tgui::WidgetTypes::FrameStatsOverlay);
+    }
+
+    SECTION("FrameStats") {
+        REQUIRE(overlay->getFrameStats().drawCalls == 0);
+        REQUIRE(overlay->getText().find("Draw calls: 0") != sf::String::InvalidPos);
+
+        tgui::FrameStats stats;
+        stats.drawCalls = 12;
+        stats.widgetsDrawn = 5;
+        stats.widgetsCulled = 3;
+        stats.drawTime = sf::microseconds(1500);
+        overlay->setFrameStats(stats);
+
+        REQUIRE(overlay->getFrameStats().drawCalls == 12);
+        REQUIRE(overlay->getText().find("Draw calls: 12") != sf::String::InvalidPos);
+        REQUIRE(overlay->getText().find("Widgets drawn: 5 (3 culled)") != sf::String::InvalidPos);
+        REQUIRE(overlay->getText().find("Draw time: 1500 us") != sf::String::InvalidPos);
+    }
+
+    SECTION("Mouse events") {
+        overlay->setPosition(10, 10);
+        REQUIRE(!overlay->mouseOnWidget(20, 20));
+    }
+
+    SECTION("Copy") {
+        tgui::FrameStats stats;
+        stats.updateCalls = 7;
+        overlay->setFrameStats(stats);
+
+        auto copy = tgui::FrameStatsOverlay::copy(overlay);
+        REQUIRE(copy->getFrameStats().updateCalls == 7);
+        REQUIRE(copy->getText() == overlay->getText());
+        REQUIRE(tgui::FrameStatsOverlay::copy(nullptr) == nullptr);
+    }
+}
@@ -39,6 +39,7 @@ TEST_CASE("[RadioButton]") {
 
     SECTION("WidgetType") {
         REQUIRE(radioButton->getWidgetType() == "RadioButton");
+        REQUIRE(radioButton->getWidgetTypeId() == tgui::WidgetTypes::RadioButton);
     }
 
     SECTION("Checked") {